@@ -91,6 +91,172 @@ public:
    */
   void setModel(RBAModel* newModel);
 
+  /**
+   * @brief Replaces the model without resetting the arbitration
+   * @param newModel The new model for arbitration
+   * @return false if newModel is nullptr
+   * @details Unlike setModel(), the arbitration state is carried over to newModel.
+   * Requested content states (in request order), scene activity and
+   * property values, current allocations and queued requests are mapped
+   * by name. Elements that do not exist in newModel are dropped.
+   * The model can be loaded on any thread. The switch happens between two
+   * execute() calls, and its pause depends only on the size of the models.
+   * The previous model is no longer referenced when this function returns
+   * and can be deleted by the caller.
+   * newModel must not be referenced by another arbitrator, because it is
+   * prepared for arbitration outside the lock of this arbitrator.
+   * Passing the current model does nothing.
+   *
+   * **Example**
+   *
+   * ```
+   *    rba::RBAJsonParser parser;
+   *    rba::RBAModel* newModel = parser.parse("RBAModel_new.json");
+   *    if(newModel != nullptr) {
+   *        rba::RBAModel* oldModel = const_cast<rba::RBAModel*>(arb->getModel());
+   *        arb->swapModel(newModel);
+   *        delete oldModel;
+   *    }
+   * ```
+   */
+  bool swapModel(RBAModel* newModel);
+
+  /**
+   * @brief Loads the constraints compiled to native code
+   * @param filename File path of the shared object built from
+   * the source that rbaconstraintgen generated for the current model
+   * @return false if the file could not be loaded, or was generated from
+   * another model. The constraints are interpreted in that case.
+   * @details The compiled constraints give the same results as the
+   * interpreted ones. They are used only while no log manager is set,
+   * because they do not output logs.
+   * The plugin belongs to the model. After setModel() or swapModel(),
+   * the plugin of the new model must be loaded again.
+   * Supported on Linux only.
+   *
+   * **Example**
+   *
+   * ```
+   *    $ rbaconstraintgen RBAModel.json rules.cpp
+   *    $ g++ -shared -fPIC -std=c++14 -I<rba include dirs> rules.cpp -o rules.so
+   *
+   *    arb->loadConstraintPlugin("./rules.so");
+   * ```
+   */
+  bool loadConstraintPlugin(const std::string& filename);
+
+  /**
+   * @brief Enables the reordering of the operands of AND and OR
+   * @param adaptive true: enables the reordering
+   * @details The arbitrator measures how often each operand decides
+   * the result of its AND or OR, and how long it takes, and evaluates
+   * the cheap and deciding operands first. Only the constraints that are
+   * satisfied are decided in this way. The other constraints are
+   * evaluated completely, so the arbitration result does not change.
+   * The reordering is not used while a log manager is set.
+   * The learned orders belong to the model and are kept after
+   * setAdaptiveOperandOrder(false).
+   */
+  void setAdaptiveOperandOrder(const bool adaptive);
+
+  /**
+   * @brief Saves the learned operand orders
+   * @param filename File path of the text file to be written
+   * @return false if the file could not be written
+   * @details The file can be loaded by loadOperandOrder(),
+   * for example, to start a vehicle with the orders learned in a test run.
+   */
+  bool saveOperandOrder(const std::string& filename) const;
+
+  /**
+   * @brief Loads the operand orders saved by saveOperandOrder()
+   * @param filename File path of the text file to be read
+   * @return false if the file could not be read
+   * @details The orders of the constraints that are not in the model
+   * are ignored. The reordering is continued from the loaded orders
+   * if it is enabled by setAdaptiveOperandOrder().
+   */
+  bool loadOperandOrder(const std::string& filename);
+
+  /**
+   * @brief Enables the reuse of the constraint results
+   * @param cache true: enables the reuse (default)
+   * @details The arbitrator records the state of the allocatables,
+   * the requests and the previous result that each constraint reads,
+   * and keeps the last results of each constraint with that state.
+   * A constraint whose inputs have the same values as in a kept result
+   * is not evaluated again. The arbitration result does not change.
+   * Disable it to reduce the memory used by the kept results.
+   * The results are not reused while a log manager is set.
+   */
+  void setConstraintCache(const bool cache);
+
+  /**
+   * @brief Enables the reuse of the arbitration result sets
+   * @param pool true: enables the reuse
+   * @details The result sets that arbitration and the returned results
+   * no longer use are kept, and the next result sets are copied into them
+   * instead of being allocated. This reduces the memory allocations of
+   * execute(), for example, for a system where the allocator causes
+   * jitter. Some result sets are created in advance when the reuse is
+   * enabled and when the model is set. The arbitration result does not
+   * change. The kept result sets are released by setObjectPool(false).
+   */
+  void setObjectPool(const bool pool);
+
+  /**
+   * @brief Limits the re-arbitration of an arbitration
+   * @param maxNest The maximum nest level of the re-arbitration.
+   * 0 or less: no limit
+   * @param maxCount The maximum number of the allocatables re-arbitrated
+   * by an arbitration. 0 or less: no limit
+   * @details An allocatable whose constraint fails re-arbitrates the
+   * allocatables of the constraint, and an allocatable whose result
+   * changes re-arbitrates the allocatables it has affected. These
+   * re-arbitrations can nest. When a re-arbitration would exceed a limit,
+   * it is not executed, and the allocatable is arbitrated with the
+   * current results of the other allocatables. The limits bound the time
+   * of arbitration for a model whose re-arbitration goes deep, but with a
+   * limit, the arbitration result may differ from the one without it.
+   * No limit by default.
+   */
+  void setReArbitrationLimit(const std::int32_t maxNest,
+                             const std::int32_t maxCount);
+
+  /**
+   * @brief Bounds the time and the steps of an arbitration
+   * @param maxMicroseconds The maximum time of an arbitration in
+   * microseconds. 0 or less: no limit
+   * @param maxSteps The maximum number of the steps of an arbitration.
+   * A step assigns a content state to an allocatable, checks the
+   * constraints of an allocatable or starts a re-arbitration.
+   * 0 or less: no limit
+   * @details When an arbitration exceeds the budget, it executes no more
+   * re-arbitration and finishes the allocatables being arbitrated.
+   * The allocatables not arbitrated yet keep the result of the previous
+   * arbitration, except for the content states that are no longer
+   * requested. The status of the result is DEGRADED, and the result may
+   * not satisfy the constraints. The time is checked every few steps,
+   * so the arbitration can run slightly longer than the budget.
+   * No budget by default.
+   */
+  void setArbitrationBudget(const std::int32_t maxMicroseconds,
+                            const std::int32_t maxSteps);
+
+  /**
+   * @brief Returns the maximum nest level of the re-arbitration
+   * of the last arbitration
+   * @return The nest level. 0 when no allocatable was re-arbitrated.
+   */
+  std::int32_t getMaxReArbitrationNest() const;
+
+  /**
+   * @brief Returns the number of the allocatables re-arbitrated
+   * by the last arbitration
+   * @return The number of the re-arbitrated allocatables
+   */
+  std::int32_t getReArbitrationCount() const;
+
   /**
    * @brief Returns the model for arbitration
    * @return model The model for arbitration
@@ -221,6 +387,86 @@ public:
   std::unique_ptr<RBAResult> execute(std::list<std::string>& contexts,
 				     bool require=true);
 
+  /**
+   * @brief Executes arbitration and stores the result in a result object
+   * of the caller
+   * @param contextName Context string of arbitration request.
+   * @param require
+   * true : request displaying / outputting content or scene on\n
+   * false : withdraw a request or scene off.
+   * @param result Result of arbitration. A result returned by a former
+   * call can be passed again.
+   * @details
+   * Same as execute(const std::string&,bool), except for the result.\n
+   * If result holds a result of arbitration, it is overwritten and its
+   * memory is reused. Otherwise a new result is stored in it.
+   * The arbitrator keeps its own result instead of a copy of it.
+   * This reduces the copies and the memory allocations of a caller that
+   * discards each result before the next arbitration.
+   * \n
+   * **Exapmle**
+   *
+   * ```
+   *    std::unique_ptr<RBAResult> result;
+   *    arb->execute("CONTENT_A/NORMAL", true, result);
+   *    arb->execute("CONTENT_B/NORMAL", true, result);
+   * ```
+   */
+  void execute(const std::string& contextName, bool require,
+               std::unique_ptr<RBAResult>& result);
+
+  /**
+   * @brief Executes arbitration with multiple requirements and stores the
+   * result in a result object of the caller
+   * @param contexts List of contexts.
+   * @param require
+   * true : request displaying / outputting content or scene on\n
+   * false : withdraw a request or scene off.
+   * @param result Result of arbitration. A result returned by a former
+   * call can be passed again.
+   * @details
+   * Same as execute(std::list<std::string>&,bool), except that the result
+   * is stored in result as execute(const std::string&,bool,std::unique_ptr<RBAResult>&)
+   * does.
+   */
+  void execute(std::list<std::string>& contexts, bool require,
+               std::unique_ptr<RBAResult>& result);
+
+  /**
+   * @brief Returns the result that arbitration with multiple requirements
+   * would give, without changing the state of arbitration
+   * @param contexts List of contexts.
+   * @param require
+   * true : request displaying / outputting content or scene on\n
+   * false : withdraw a request or scene off.
+   * @return The result of the arbitration.
+   * @details
+   * The requests are arbitrated on a copy of the last arbitration result
+   * in the same way as execute(std::list<std::string>&,bool). After that,
+   * the arbitrator has the state before the call, so the next execute()
+   * and cancelArbitration() are not affected by the call. The requests
+   * that are set by setContentState() or setScene() and are not yet
+   * arbitrated are not used by the simulation, and are kept for the next
+   * execute().\n
+   * The simulation is serialized with execute(): it holds the lock of the
+   * arbitrator while it copies the result sets and the states of the
+   * allocatables, arbitrates and restores them, so an execute() on another
+   * thread waits as long as a real arbitration takes. It does not run
+   * alongside the arbitration. For previews that must not delay
+   * execute(), use another arbitrator with its own model.\n
+   * If the status type of the result is UNKNOWN_CONTENT_STATE, a context
+   * is unknown.
+   *
+   * **Exapmle**
+   *
+   * ```
+   *    std::list<std::string> contents = {"CONTENT_A/NORMAL"};
+   *    std::unique_ptr<RBAResult> preview = arb->simulate(contents, true);
+   * ```
+   */
+  std::unique_ptr<RBAResult> simulate(std::list<std::string>& contexts,
+                                      bool require = true);
+
   /**
    * @brief Executes arbitration with a requirement of scene and scene properties.
    * @param sceneName The Scene name of arbitration reauest.\n
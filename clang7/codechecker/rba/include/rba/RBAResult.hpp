@@ -521,6 +521,7 @@ public:
    * @return SUCCESS: Success
    * @return UNKNOWN_CONTENT_STATE: Failed (The reuqest is unknown)
    * @return CANCEL_ERROR: Cancel arbitrration error
+   * @return DEGRADED: Arbitration exceeded its budget
    * @endcond
    */
   virtual RBAResultStatusType getStatusType() const=0;
@@ -48,7 +48,12 @@ enum class RBAResultStatusType : std::uint8_t
   /**
    * @brief Cancel arbitration error
    */
-  CANCEL_ERROR
+  CANCEL_ERROR,
+
+  /**
+   * @brief Arbitration exceeded its budget and the result is degraded
+   */
+  DEGRADED
 
 };
 
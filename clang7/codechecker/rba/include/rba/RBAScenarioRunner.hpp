@@ -0,0 +1,147 @@
+/**
+ * Copyright (c) 2019 DENSO CORPORATION.
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/**
+ * Scenario runner class
+ */
+
+#ifndef RBASCENARIORUNNER_HPP
+#define RBASCENARIORUNNER_HPP
+
+#ifdef _MSC_VER
+#ifdef _WINDLL
+#define DLL_EXPORT __declspec(dllexport)
+#else
+#define DLL_EXPORT __declspec(dllimport)
+#endif
+#else
+#define DLL_EXPORT
+#endif
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace rba
+{
+
+/**
+ * @struct RBAScenarioReport
+ * Result of a scenario run by RBAScenarioRunner.
+ */
+struct RBAScenarioReport
+{
+  /// Name of the scenario
+  std::string name;
+  /// true if every expectation of the scenario was met
+  bool passed {false};
+  /// Index of the first execute step whose expectation was not met,
+  /// -1 if the scenario passed
+  std::int32_t failedStep {-1};
+  /// Description of the first expectation that was not met
+  std::string divergence;
+  /// Time spent to run the scenario in microseconds
+  std::int64_t elapsedMicroseconds {0};
+};
+
+/**
+ * @class RBAScenarioRunner
+ * Runs request scenarios against a model on several threads and checks
+ * the visible and sounding outputs of each arbitration.
+ *
+ * A scenario file is a text file with one command per line.
+ * Empty lines and lines beginning with '#' are ignored.
+ *
+ * ```
+ *    scenario <name>
+ *    execute <context> [on|off]
+ *    property <scene> <property> <value>
+ *    visible <area> <content state|->
+ *    sounding <zone> <content state|->
+ * ```
+ *
+ * "scenario" starts a scenario, which starts from the initial state of
+ * arbitration. "execute" arbitrates a request, "on" when it is omitted.
+ * "property" arbitrates a request of the scene with a property value.
+ * "visible" and "sounding" are expectations on the result of the last
+ * "execute": the area or the zone outputs the content state given by its
+ * unique name ("Content/State"), or nothing for "-".
+ */
+class DLL_EXPORT RBAScenarioRunner
+{
+public:
+  RBAScenarioRunner();
+  RBAScenarioRunner(const RBAScenarioRunner&)=delete;
+  RBAScenarioRunner(const RBAScenarioRunner&&)=delete;
+  RBAScenarioRunner& operator=(const RBAScenarioRunner&)=delete;
+  RBAScenarioRunner& operator=(const RBAScenarioRunner&&)=delete;
+  virtual ~RBAScenarioRunner() noexcept;
+
+public:
+  /**
+   * @brief Loads a model and a scenario file.
+   * @param modelFilename Path of JSON file
+   * @param scenarioFilename Path of the scenario file
+   * @return false if the model or the scenario file cannot be read.
+   * The errors are written to std::cerr.
+   */
+  bool load(const std::string& modelFilename,
+            const std::string& scenarioFilename);
+
+  /**
+   * @brief Runs the loaded scenarios.
+   * @param threads Number of the threads. The number of the cores is
+   * used for 0.
+   * @return Reports of the scenarios in the order of the scenario file.
+   * @details
+   * Each thread has its own model and arbitrator, and takes the next
+   * scenario that no thread has run. The model is parsed once for each
+   * thread, and the arbitration is cleared before each scenario.
+   *
+   * **Example**
+   *
+   * ```
+   *    rba::RBAScenarioRunner runner;
+   *    if(!runner.load("RBAModel.json", "scenarios.txt")) {
+   *        return 1;
+   *    }
+   *    for(const rba::RBAScenarioReport& report : runner.run()) {
+   *        if(!report.passed) {
+   *            std::cout << report.name << ": " << report.divergence << std::endl;
+   *        }
+   *    }
+   * ```
+   */
+  std::vector<RBAScenarioReport> run(const std::uint32_t threads = 0U);
+
+private:
+  class Impl;
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable:4251)
+#endif
+  std::unique_ptr<Impl> impl_;
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+};
+
+}
+
+#endif
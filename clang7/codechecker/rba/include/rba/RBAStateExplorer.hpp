@@ -0,0 +1,176 @@
+/**
+ * Copyright (c) 2019 DENSO CORPORATION.
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/**
+ * State explorer class
+ */
+
+#ifndef RBASTATEEXPLORER_HPP
+#define RBASTATEEXPLORER_HPP
+
+#ifdef _MSC_VER
+#ifdef _WINDLL
+#define DLL_EXPORT __declspec(dllexport)
+#else
+#define DLL_EXPORT __declspec(dllimport)
+#endif
+#else
+#define DLL_EXPORT
+#endif
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace rba
+{
+
+/**
+ * @struct RBAExplorationOption
+ * Parameters of the exploration by RBAStateExplorer.
+ */
+struct RBAExplorationOption
+{
+  /// Number of the random traces. Not used by the exhaustive exploration.
+  std::uint64_t traceCount {1000U};
+  /// Number of the requests of each trace
+  std::uint32_t traceLength {20U};
+  /// true: runs every trace of traceLength requests instead of random
+  /// traces
+  bool exhaustive {false};
+  /// Seed of the random traces. The same seed gives the same traces for
+  /// any number of threads.
+  std::uint64_t seed {1U};
+  /// Scene property values are chosen from 0 to this value
+  std::int32_t maxPropertyValue {3};
+  /// Number of the threads. The number of the cores is used for 0.
+  std::uint32_t threads {0U};
+};
+
+/**
+ * @struct RBAConstraintViolation
+ * Constraint that is not satisfied after a trace.
+ */
+struct RBAConstraintViolation
+{
+  /// Name of the constraint
+  std::string constraint;
+  /// true if the constraint is a runtime constraint
+  bool runtime {false};
+  /// Shortest trace found that fails the constraint, in the format of
+  /// the scenario file of RBAScenarioRunner
+  std::vector<std::string> trace;
+};
+
+/**
+ * @struct RBAExplorationReport
+ * Result of the exploration by RBAStateExplorer.
+ */
+struct RBAExplorationReport
+{
+  /// Number of the traces run
+  std::uint64_t traceCount {0U};
+  /// Number of the requests run
+  std::uint64_t stepCount {0U};
+  /// Constraints failed by a trace, in the order of their names
+  std::vector<RBAConstraintViolation> violations;
+  /// Deepest nest of re-arbitration, and the trace that reaches it
+  std::int32_t deepestNest {0};
+  std::vector<std::string> deepestTrace;
+  /// Longest execution time of a request in microseconds, and the trace
+  /// whose last request takes it
+  std::int64_t slowestMicroseconds {0};
+  std::vector<std::string> slowestTrace;
+};
+
+/**
+ * @class RBAStateExplorer
+ * Explores request sequences of a model to find the constraints that
+ * arbitration does not satisfy and the worst-case inputs.
+ *
+ * A trace starts from the initial state of arbitration and requests,
+ * one by one, a content state on or off, a scene on or off, or a scene
+ * property value. After each request, all constraints, including the
+ * offline constraints, are evaluated on the arbitration state that
+ * RBAResult::satisfiesConstraints() uses. The trace that first fails
+ * a constraint is minimized by delta debugging to a trace that still
+ * fails it.
+ * The nest of re-arbitration and the execution time of each request are
+ * also recorded.
+ */
+class DLL_EXPORT RBAStateExplorer
+{
+public:
+  RBAStateExplorer();
+  RBAStateExplorer(const RBAStateExplorer&)=delete;
+  RBAStateExplorer(const RBAStateExplorer&&)=delete;
+  RBAStateExplorer& operator=(const RBAStateExplorer&)=delete;
+  RBAStateExplorer& operator=(const RBAStateExplorer&&)=delete;
+  virtual ~RBAStateExplorer() noexcept;
+
+public:
+  /**
+   * @brief Loads a model.
+   * @param modelFilename Path of JSON file
+   * @return false if the model cannot be read.
+   */
+  bool load(const std::string& modelFilename);
+
+  /**
+   * @brief Explores the request sequences of the loaded model.
+   * @param option Parameters of the exploration
+   * @return Result of the exploration
+   * @details
+   * The traces are run on the threads, each of which has its own model
+   * and arbitrator. The model is parsed once for each thread.
+   * The exhaustive exploration runs (number of requests)^traceLength
+   * traces, so it is for short traces.
+   *
+   * **Example**
+   *
+   * ```
+   *    rba::RBAStateExplorer explorer;
+   *    if(!explorer.load("RBAModel.json")) {
+   *        return 1;
+   *    }
+   *    rba::RBAExplorationOption option;
+   *    option.traceCount = 10000U;
+   *    rba::RBAExplorationReport report {explorer.explore(option)};
+   *    for(const rba::RBAConstraintViolation& violation : report.violations) {
+   *        std::cout << violation.constraint << std::endl;
+   *    }
+   * ```
+   */
+  RBAExplorationReport explore(const RBAExplorationOption& option);
+
+private:
+  class Impl;
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable:4251)
+#endif
+  std::unique_ptr<Impl> impl_;
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+};
+
+}
+
+#endif
@@ -61,7 +61,7 @@ RBAActiveContents::getReferenceObjectCore(RBAConstraintInfo* info, RBAArbitrator
   }
   else if (lhsObj != nullptr) {
     contentSet_->clear();
-    const RBAAllocatable* const alloc {dynamic_cast<const RBAAllocatable*>(lhsObj->getRawObject())};
+    const RBAAllocatable* const alloc {lhsObj->getRawObject()->toAllocatable()};
 #ifdef RBA_USE_LOG
     if (arb == nullptr) {
       // Follow this path when called from createHierarchy()
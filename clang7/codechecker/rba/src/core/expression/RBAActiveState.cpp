@@ -49,7 +49,7 @@ const RBARuleObject* RBAActiveState::getReferenceObjectCore(
     info->setExceptionBeforeArbitrate(true);
   } else if (ruleObj != nullptr) {
     const RBAContent* const c {
-        dynamic_cast<const RBAContent*>(ruleObj->getRawObject())};
+        ruleObj->getRawObject()->toContent()};
     if (ruleObj->isPrevious()) {
       returnObj = arb->getResult()->getPreActiveState(c);
     } else {
@@ -54,7 +54,7 @@ RBAAllocatedContent::getReferenceObjectCore(RBAConstraintInfo* info,
   const auto ruleObj = getLhsOperand()->getReferenceObject(leftInfo, arb);
   if (ruleObj != nullptr) {
     if (!leftInfo->isExceptionBeforeArbitrate()) {
-      const RBAAllocatable* const alloc {dynamic_cast<const RBAAllocatable*>(ruleObj->getRawObject())};
+      const RBAAllocatable* const alloc {ruleObj->getRawObject()->toAllocatable()};
       if (ruleObj->isPrevious() == true) {
         const auto contentState = arb->getResult()->getDirectPreContentState(alloc);
         if(contentState != nullptr) {
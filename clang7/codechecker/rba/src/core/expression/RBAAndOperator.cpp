@@ -19,6 +19,7 @@
  */
 
 #include "RBAAndOperator.hpp"
+#include "RBAArbitratorImpl.hpp"
 
 #include "RBAExpressionVisitor.hpp"
 #include "RBALogManager.hpp"
@@ -44,6 +45,10 @@ bool
 RBAAndOperator::executeCore(RBAConstraintInfo* info,
                             RBAArbitratorImpl * arb) const
 {
+  // Only the result of the constraint is needed
+  if ((arb != nullptr) && arb->isShortCircuit()) {
+    return executeShortCircuit(info, arb, true);
+  }
   // Add itself to the constraint hierarchy for coverage
   LOG_addHierarchy(LOG_getSymbol());
   
@@ -0,0 +1,111 @@
+/**
+ * Copyright (c) 2019 DENSO CORPORATION.
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Constant expression class definition file
+ */
+
+#include "RBAConstantExpression.hpp"
+#include "RBAModelElementType.hpp"
+#include "RBAExpressionType.hpp"
+
+namespace rba
+{
+
+void
+RBAConstantExpression::setOriginal(RBAExpression* const original)
+{
+  original_ = original;
+}
+
+RBAExpression*
+RBAConstantExpression::getOriginal() const
+{
+  return original_;
+}
+
+void
+RBAConstantExpression::setResult(const bool result)
+{
+  result_ = result;
+}
+
+bool
+RBAConstantExpression::getResult() const
+{
+  return result_;
+}
+
+void
+RBAConstantExpression::setObject(const RBARuleObject* const object)
+{
+  object_ = object;
+}
+
+const RBARuleObject*
+RBAConstantExpression::getObject() const
+{
+  return object_;
+}
+
+RBAModelElementType
+RBAConstantExpression::getModelElementType() const
+{
+  return RBAModelElementType::ConstantExpression;
+}
+
+bool
+RBAConstantExpression::executeCore(RBAConstraintInfo* info,
+                                   RBAArbitratorImpl* arb) const
+{
+  return result_;
+}
+
+const RBARuleObject*
+RBAConstantExpression::getReferenceObjectCore(RBAConstraintInfo* info,
+                                              RBAArbitratorImpl* arb) const
+{
+  return object_;
+}
+
+#ifdef RBA_USE_LOG
+const std::string
+RBAConstantExpression::getExpressionText() const
+{
+  return original_->getExpressionText();
+}
+
+const std::string
+RBAConstantExpression::getCoverageExpressionText() const
+{
+  return original_->getCoverageExpressionText();
+}
+
+void
+RBAConstantExpression::createHierarchy()
+{
+  // The hierarchy of the model is not changed by the optimization
+  original_->createHierarchy();
+}
+
+RBAExpressionType
+RBAConstantExpression::getUnderlyingType() const
+{
+  return original_->getUnderlyingType();
+}
+#endif
+
+}
@@ -0,0 +1,74 @@
+/**
+ * Copyright (c) 2019 DENSO CORPORATION.
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Constant expression class
+ *
+ * Replaces a sub-expression whose value does not depend on the arbitration.
+ * Created by RBAExpressionOptimizer after the model is loaded.
+ * The original expression is kept for the log.
+ */
+
+#ifndef RBACONSTANTEXPRESSION_HPP
+#define RBACONSTANTEXPRESSION_HPP
+
+#include "RBAExpression.hpp"
+
+namespace rba
+{
+
+class DLL_EXPORT RBAConstantExpression : public RBAExpression
+{
+public:
+  RBAConstantExpression()=default;
+  RBAConstantExpression(const RBAConstantExpression&)=delete;
+  RBAConstantExpression(const RBAConstantExpression&&)=delete;
+  RBAConstantExpression& operator=(const RBAConstantExpression&)=delete;
+  RBAConstantExpression& operator=(const RBAConstantExpression&&)=delete;
+  virtual ~RBAConstantExpression()=default;
+
+public:
+  void setOriginal(RBAExpression* const original);
+  RBAExpression* getOriginal() const;
+  void setResult(const bool result);
+  bool getResult() const;
+  void setObject(const RBARuleObject* const object);
+  const RBARuleObject* getObject() const;
+
+  RBAModelElementType getModelElementType() const override;
+  bool executeCore(RBAConstraintInfo* info,
+                   RBAArbitratorImpl* arb) const override;
+  const RBARuleObject* getReferenceObjectCore(RBAConstraintInfo* info,
+                                              RBAArbitratorImpl* arb) const override;
+
+  // Log
+#ifdef RBA_USE_LOG
+  const std::string getExpressionText() const override;
+  const std::string getCoverageExpressionText() const override;
+  void createHierarchy() override;
+  RBAExpressionType getUnderlyingType() const override;
+#endif
+
+ private:
+  RBAExpression* original_ {nullptr};
+  const RBARuleObject* object_ {nullptr};
+  bool result_ {false};
+
+};
+
+}
+
+#endif
@@ -58,7 +58,7 @@ RBAContentValue::getValueCore(RBAConstraintInfo* info, RBAArbitratorImpl* arb) c
     info->setExceptionBeforeArbitrate(true);
   } else {
     if (r != nullptr) {
-      const auto a = dynamic_cast<const RBAAllocatable*>(r->getRawObject());
+      const auto a = r->getRawObject()->toAllocatable();
       if (a != nullptr) {
         if (r->isPrevious()) {
           cs = arb->getResult()->getDirectPreContentState(a);
@@ -58,8 +58,6 @@ RBAExistsOperator::executeCore(RBAConstraintInfo* info,
   // Get rule object and loop
   RBAConstraintInfo* const leftInfo {info->getChild(0U)};
 
-  std::vector<const RBARuleObject*> objs;
-
   const RBARuleObject* const ruleObj {setObj->getReferenceObject(leftInfo, arb)};
   const RBARuleObject* objset {nullptr};
   if (ruleObj != nullptr) { 
@@ -74,40 +72,35 @@ RBAExistsOperator::executeCore(RBAConstraintInfo* info,
     return false;
   }
 
-  if (dynamic_cast<const RBAAllocatableSet*>(objset) != nullptr) {
-    objs.clear();
-    for(const RBAAllocatable* alloc
-	  : dynamic_cast<const RBAAllocatableSet*>(objset)->getLeafAllocatable() ) {
-      objs.push_back(alloc);
-    }
-  }
-  else {
-    objs.clear();
-    for(const auto& cont : dynamic_cast<const RBAContentSet*>(objset)->getLeafContent() ){
-      objs.push_back(cont);
-    }
-  }
-
+  // Bodies that only check the status of the element are evaluated directly
+  const RBAExpression* const check {lambda->getStatusCheck()};
   bool isTrue {false};
   std::uint32_t i {0U};
-  for(const RBARuleObject* const obj : objs) {
-    // Add count to the constraint hierarchy for coverage
-    LOG_addHierarchy("#" + std::to_string(i));
-
-    RBAConstraintInfo* const childInfo {info->getChild(i)};
-    lambda->setRuleObj(obj);
-
-    const bool res {lambda->execute(childInfo, arb)};
-
-    // Remove count from the constraint hierarchy for coverage
-    LOG_removeHierarchy();
-
-    if(childInfo->isExceptionBeforeArbitrate()) {
-      info->setExceptionBeforeArbitrate(true);
-    } else {
-      isTrue = (isTrue || res);
+  const RBAAllocatableSet* const allocatableSet
+    {objset->toAllocatableSet()};
+  if (allocatableSet != nullptr) {
+    for (const RBAAllocatable* const alloc : allocatableSet->getLeafAllocatable()) {
+      RBAConstraintInfo* const childInfo {info->getChild(i)};
+      const bool res {executeLambda(alloc, check, i, childInfo, arb)};
+      if (childInfo->isExceptionBeforeArbitrate()) {
+        info->setExceptionBeforeArbitrate(true);
+      } else {
+        isTrue = (isTrue || res);
+      }
+      i++;
+    }
+  } else {
+    for (const RBAContent* const cont
+           : objset->toContentSet()->getLeafContent()) {
+      RBAConstraintInfo* const childInfo {info->getChild(i)};
+      const bool res {executeLambda(cont, check, i, childInfo, arb)};
+      if (childInfo->isExceptionBeforeArbitrate()) {
+        info->setExceptionBeforeArbitrate(true);
+      } else {
+        isTrue = (isTrue || res);
+      }
+      i++;
     }
-    i++;
   }
 
   if (isTrue == true) {
@@ -22,6 +22,9 @@
 
 #include "RBALetStatement.hpp"
 #include "RBAConstraintInfo.hpp"
+#include "RBAArbitratorImpl.hpp"
+#include "RBAExpressionCache.hpp"
+#include "RBAInputRecorder.hpp"
 #ifdef RBA_USE_LOG
 #include "RBAExpressionType.hpp"
 #endif
@@ -29,6 +32,8 @@
 namespace rba
 {
 
+const std::uint32_t RBAExpression::NO_SHARED_ID {0xFFFFFFFFU};
+
 void RBAExpression::addLetStatement(RBALetStatement* const letStatement)
 {
   letStatements_.push_back(letStatement);
@@ -47,12 +52,30 @@ RBAExpression::execute(RBAConstraintInfo* const info, RBAArbitratorImpl * const
   for (RBALetStatement* const& letStatement : letStatements_) {
     letStatement->setVariable(arb);
   }
+  // An identical expression may have been evaluated in the same check
+  RBAExpressionCache* cache {nullptr};
+  std::size_t inputsBegin {0U};
+  if ((sharedId_ != NO_SHARED_ID) && (arb != nullptr)) {
+    cache = &arb->getExpressionCache();
+    bool cachedResult {false};
+    const RBAConstraintInfo* const cachedInfo
+      {cache->find(sharedId_, this, info, cachedResult)};
+    if (cachedInfo != nullptr) {
+      info->copyResult(*cachedInfo);
+      return cachedResult;
+    }
+    inputsBegin = RBAInputRecorder::getCurrentPosition();
+  }
   const bool result {executeCore(info, arb)};
   if (result) {
     info->setResult(RBAExecuteResult::TRUE);
   } else {
     info->setResult(RBAExecuteResult::FALSE);
   }
+  // The short-circuit evaluation leaves the ConstraintInfo incomplete
+  if ((cache != nullptr) && !arb->isShortCircuit()) {
+    cache->store(sharedId_, this, info, result, inputsBegin);
+  }
   return result;
 }
 
@@ -100,6 +123,19 @@ RBAExpression::getLetStatements() const
 {
   return letStatements_;
 }
+
+void
+RBAExpression::setSharedId(const std::uint32_t newSharedId)
+{
+  sharedId_ = newSharedId;
+}
+
+std::uint32_t
+RBAExpression::getSharedId() const
+{
+  return sharedId_;
+}
+
 std::int32_t
 RBAExpression::getValueCore(RBAConstraintInfo* info, RBAArbitratorImpl * arb) const
 {
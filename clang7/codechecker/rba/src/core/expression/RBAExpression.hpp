@@ -57,6 +57,8 @@ public:
   std::int32_t getValue(RBAConstraintInfo* const info, RBAArbitratorImpl* const arb) const;
   void doAction(RBAConstraintInfo* const info, RBAArbitratorImpl* const arb);
   const std::vector<RBALetStatement*>& getLetStatements() const;
+  void setSharedId(const std::uint32_t newSharedId);
+  std::uint32_t getSharedId() const;
 
   // Log
 #ifdef RBA_USE_LOG
@@ -74,6 +76,10 @@ protected:
                                     RBAArbitratorImpl* arb) const;
   virtual void doActionCore(RBAConstraintInfo* info, RBAArbitratorImpl* arb);
 
+public:
+  // ID of an expression that has no structurally identical expression
+  static const std::uint32_t NO_SHARED_ID;
+
 private:
 #ifdef _MSC_VER
 #pragma warning(push)
@@ -83,6 +89,8 @@ private:
 #ifdef _MSC_VER
 #pragma warning(pop)
 #endif
+  // Identical expressions have the same ID and share the evaluation result
+  std::uint32_t sharedId_ {NO_SHARED_ID};
 
 };
 
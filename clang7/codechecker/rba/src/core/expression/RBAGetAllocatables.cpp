@@ -54,7 +54,7 @@ RBAGetAllocatables::getReferenceObjectCore(RBAConstraintInfo* info,
     {getLhsOperand()->getReferenceObject(leftInfo, arb)};
   const RBAContent* content {nullptr};
   if (ruleObj != nullptr) {
-    content = dynamic_cast<const RBAContent*>(ruleObj->getRawObject());
+    content = ruleObj->getRawObject()->toContent();
   }
 
   if (content == nullptr) {
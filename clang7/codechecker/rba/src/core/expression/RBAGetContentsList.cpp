@@ -53,7 +53,7 @@ RBAGetContentsList::getReferenceObjectCore(RBAConstraintInfo* info,
     {getLhsOperand()->getReferenceObject(leftInfo, arb)};
   const RBAAllocatable* allocatable {nullptr};
   if (ruleObj != nullptr) {
-    allocatable = dynamic_cast<const RBAAllocatable*>(ruleObj->getRawObject());
+    allocatable = ruleObj->getRawObject()->toAllocatable();
   }
   // Indicates whether the content referenced by this constraint expression 
   // is the result of the previous arbitration result.
@@ -52,7 +52,7 @@ bool RBAHasBeenDisplayed::executeCore(RBAConstraintInfo* info,
     info->setExceptionBeforeArbitrate(true);
   } else if (ruleObj != nullptr) {
     const RBAContent* const c {
-        dynamic_cast<const RBAContent*>(ruleObj->getRawObject())};
+        ruleObj->getRawObject()->toContent()};
     if (!ruleObj->isPrevious()) {
       isPassed = arb->getResult()->hasBeenDisplayed(c);
     } else {
@@ -54,7 +54,7 @@ RBAHasComeEarlierThan::executeCore(RBAConstraintInfo* info,
   const RBARuleObject* ruleObj {getLhsOperand()->getReferenceObject(leftInfo, arb)};
   const RBAContent* contentLhs {nullptr};
   if(ruleObj != nullptr) {
-    contentLhs = dynamic_cast<const RBAContent*>(ruleObj->getRawObject());
+    contentLhs = ruleObj->getRawObject()->toContent();
   }
 
   // Get content in right hand side  of the expression
@@ -62,7 +62,7 @@ RBAHasComeEarlierThan::executeCore(RBAConstraintInfo* info,
   ruleObj = getRhsOperand()->getReferenceObject(rightInfo, arb);
   const RBAContent* contentRhs {nullptr};
   if(ruleObj != nullptr) {
-    contentRhs = dynamic_cast<const RBAContent*>(ruleObj->getRawObject());
+    contentRhs = ruleObj->getRawObject()->toContent();
   }
 
   if((contentLhs == nullptr) || (contentRhs == nullptr)) {
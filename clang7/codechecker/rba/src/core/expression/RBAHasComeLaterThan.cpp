@@ -55,7 +55,7 @@ RBAHasComeLaterThan::executeCore(RBAConstraintInfo* info,
   const RBARuleObject* ruleObj {getLhsOperand()->getReferenceObject(leftInfo, arb)};
   const RBAContent* contentLhs {nullptr};
   if(ruleObj != nullptr) {
-    contentLhs = dynamic_cast<const RBAContent*>(ruleObj->getRawObject());
+    contentLhs = ruleObj->getRawObject()->toContent();
   }
 
   // pop the Content of left hand side expresion
@@ -63,7 +63,7 @@ RBAHasComeLaterThan::executeCore(RBAConstraintInfo* info,
   ruleObj = getRhsOperand()->getReferenceObject(rightInfo, arb);
   const RBAContent* contentRhs {nullptr};
   if(ruleObj != nullptr) {
-    contentRhs = dynamic_cast<const RBAContent*>(ruleObj->getRawObject());
+    contentRhs = ruleObj->getRawObject()->toContent();
   }
 
   if((contentLhs == nullptr) || (contentRhs == nullptr)) {
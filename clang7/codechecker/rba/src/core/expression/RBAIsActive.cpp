@@ -54,12 +54,7 @@ RBAIsActive::executeCore(RBAConstraintInfo* info,
   if (leftInfo->isExceptionBeforeArbitrate() == true) {
     info->setExceptionBeforeArbitrate(true);
   } else if (ruleObj != nullptr) {
-    const RBAContent* const content {dynamic_cast<const RBAContent*>(ruleObj->getRawObject())};
-    if (ruleObj->isPrevious()) {
-      isPassed = arb->getResult()->isPreActive(content);
-    } else {
-      isPassed = arb->getResult()->isActive(content);
-    }
+    isPassed = executeFor(info, arb, ruleObj);
   } else {
     ;
   }
@@ -70,8 +65,7 @@ RBAIsActive::executeCore(RBAConstraintInfo* info,
     LOG_coverageConstraintExpressionLog(LOG_getCoverageExpressionText(),
                                         RBAExecuteResult::SKIP);
   } else if (ruleObj != nullptr) {
-    const RBAContent* content = dynamic_cast<const RBAContent*>(ruleObj
-        ->getRawObject());
+    const RBAContent* content = ruleObj->getRawObject()->toContent();
     if (isPassed == true) {
       LOG_arbitrateConstraintLogicLogLine(
           "      " + getPreMsg(ruleObj->isPrevious()) + "Content["
@@ -96,6 +90,22 @@ RBAIsActive::executeCore(RBAConstraintInfo* info,
   return isPassed;
 }
 
+/**
+ * Evaluate the expression with ruleObj as the object of the operand
+ */
+bool
+RBAIsActive::executeFor(RBAConstraintInfo* const info,
+                        RBAArbitratorImpl* const arb,
+                        const RBARuleObject* const ruleObj) const
+{
+  const RBAContent* const content {ruleObj->getRawObject()->toContent()};
+  if (ruleObj->isPrevious()) {
+    return arb->getResult()->isPreActive(content);
+  } else {
+    return arb->getResult()->isActive(content);
+  }
+}
+
 #ifdef RBA_USE_LOG
 const std::string
 RBAIsActive::getSymbol() const
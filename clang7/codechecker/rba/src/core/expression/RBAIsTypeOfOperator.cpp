@@ -34,6 +34,11 @@ void RBAIsTypeOfOperator::setTag(const std::string& tag)
   tagId_ = tag;
 }
 
+const std::string& RBAIsTypeOfOperator::getTag() const
+{
+  return tagId_;
+}
+
 void RBAIsTypeOfOperator::accept(RBAExpressionVisitor& visitor)
 {
   visitor.visit(*this);
@@ -38,6 +38,7 @@ class DLL_EXPORT RBAIsTypeOfOperator : public RBAOperator
 
  public:
   void setTag(const std::string& tag);
+  const std::string& getTag() const;
   void accept(RBAExpressionVisitor& visitor) override;
   RBAModelElementType getModelElementType() const override;
   bool executeCore(RBAConstraintInfo* info, RBAArbitratorImpl* arb) const override;
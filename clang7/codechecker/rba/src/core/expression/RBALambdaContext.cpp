@@ -42,6 +42,33 @@ RBALambdaContext::setLambda(RBALambdaExpression* const newLambda)
   lambda_ = newLambda;
 }
 
+/**
+ * Evaluate the lambda for an element of the set
+ * @param ruleObj element
+ * @param check body returned by RBALambdaExpression::getStatusCheck()
+ * @param index index of the element in the constraint hierarchy
+ * @param childInfo ConstraintInfo of the lambda
+ * @param arb arbitrator
+ */
+bool
+RBALambdaContext::executeLambda(const RBARuleObject* const ruleObj,
+                                const RBAExpression* const check,
+                                const std::uint32_t index,
+                                RBAConstraintInfo* const childInfo,
+                                RBAArbitratorImpl* const arb) const
+{
+  if (check != nullptr) {
+    return lambda_->executeStatusCheck(check, ruleObj, childInfo, arb);
+  }
+  // Add count to the constraint hierarchy for coverage
+  LOG_addHierarchy("#" + std::to_string(index));
+  lambda_->setRuleObj(ruleObj);
+  const bool res {lambda_->execute(childInfo, arb)};
+  // Remove count from the constraint hierarchy for coverage
+  LOG_removeHierarchy();
+  return res;
+}
+
 #ifdef RBA_USE_LOG
 void
 RBALambdaContext::createHierarchy()
@@ -60,15 +87,14 @@ RBALambdaContext::createHierarchy()
   const RBARuleObject* objset = setObj->getReferenceObject(&dummyInfo, dummyArb);
   std::vector<const RBARuleObject*> objs;
   if(objset) {
-    if(dynamic_cast<const RBAAllocatableSet*>(objset) != nullptr) {
-      const RBAAllocatableSet* aSet
-	= dynamic_cast<const RBAAllocatableSet*>(objset);
+    const RBAAllocatableSet* const aSet {objset->toAllocatableSet()};
+    const RBAContentSet* const cSet {objset->toContentSet()};
+    if(aSet != nullptr) {
       for(const auto& alloc : aSet->getLeafAllocatable()) {
 	objs.push_back(alloc);
       }
     }
-    else if(dynamic_cast<const RBAContentSet*>(objset) != nullptr) {
-      const RBAContentSet* cSet = dynamic_cast<const RBAContentSet*>(objset);
+    else if(cSet != nullptr) {
       for(const auto& cont : cSet->getLeafContent() ){
 	objs.push_back(cont);
       }
@@ -21,6 +21,7 @@
 #ifndef RBALAMBDACONTEXT_HPP
 #define RBALAMBDACONTEXT_HPP
 
+#include <cstdint>
 #include "RBASetOperator.hpp"
 
 namespace rba
@@ -47,6 +48,13 @@ public:
   void createHierarchy() override;
 #endif
 
+protected:
+  bool executeLambda(const RBARuleObject* const ruleObj,
+                     const RBAExpression* const check,
+                     const std::uint32_t index,
+                     RBAConstraintInfo* const childInfo,
+                     RBAArbitratorImpl* const arb) const;
+
 private:
   RBALambdaExpression* lambda_ {nullptr};
 
@@ -22,7 +22,16 @@
 #include "RBAVariable.hpp"
 #include "RBAArbitratorImpl.hpp"
 #include "RBAConstraintInfo.hpp"
+#include "RBAExecuteResult.hpp"
+#include "RBAIsActive.hpp"
+#include "RBAIsDisplayed.hpp"
+#include "RBAIsHidden.hpp"
+#include "RBAIsMuted.hpp"
+#include "RBAIsSounding.hpp"
+#include "RBAIsVisible.hpp"
+#include "RBALogManager.hpp"
 #include "RBAModelElementType.hpp"
+#include "RBAObjectReference.hpp"
 
 namespace rba
 {
@@ -136,4 +145,117 @@ RBALambdaExpression::clearRuleObj()
   getX()->clearRuleObj();
 }
 
+/**
+ * Decide the body returned by getStatusCheck() once
+ * Called when loading the model, after the shared IDs are given.
+ */
+void
+RBALambdaExpression::createStatusCheck()
+{
+  statusCheck_ = findStatusCheck();
+  isStatusCheckCreated_ = true;
+}
+
+/**
+ * Get the body that only checks the status of the variable
+ * Such a body is evaluated for each element of a set by
+ * executeStatusCheck() without evaluating the expression tree.
+ * @return body, or nullptr if the body needs the whole evaluation
+ */
+const RBAExpression*
+RBALambdaExpression::getStatusCheck() const
+{
+#ifdef RBA_USE_LOG
+  // The direct evaluation does not output logs
+  if (RBALogManager::getLogManager() != nullptr) {
+    return nullptr;
+  }
+#endif
+  if (isStatusCheckCreated_) {
+    return statusCheck_;
+  }
+  return findStatusCheck();
+}
+
+const RBAExpression*
+RBALambdaExpression::findStatusCheck() const
+{
+  const RBAExpression* const body {bodyText_};
+  if ((body == nullptr) || (getSharedId() != NO_SHARED_ID)
+      || (body->getSharedId() != NO_SHARED_ID)
+      || !getLetStatements().empty() || !body->getLetStatements().empty()) {
+    return nullptr;
+  }
+  switch (body->getModelElementType()) {
+    case RBAModelElementType::IsDisplayed:
+    case RBAModelElementType::IsHidden:
+    case RBAModelElementType::IsVisible:
+    case RBAModelElementType::IsActive:
+    case RBAModelElementType::IsMuted:
+    case RBAModelElementType::IsSounding:
+      break;
+    default:
+      return nullptr;
+  }
+  const RBAObjectReference* const operand
+    {dynamic_cast<const RBAObjectReference*>(
+        dynamic_cast<const RBAOperator*>(body)->getLhsOperand())};
+  if ((operand == nullptr) || !operand->getLetStatements().empty()
+      || (operand->getRefObject() != variable_)
+      || (variable_->getConstraintInfo() != nullptr)) {
+    return nullptr;
+  }
+  return body;
+}
+
+/**
+ * Evaluate the lambda for ruleObj with the body returned by getStatusCheck()
+ * The result and the ConstraintInfo are the same as setRuleObj() and
+ * execute().
+ */
+bool
+RBALambdaExpression::executeStatusCheck(const RBAExpression* const check,
+                                        const RBARuleObject* const ruleObj,
+                                        RBAConstraintInfo* const info,
+                                        RBAArbitratorImpl* const arb)
+{
+  setRuleObj(ruleObj);
+  info->setExpression(this);
+  RBAConstraintInfo* const bodyInfo {info->getChild(0U)};
+  bodyInfo->setExpression(check);
+  bodyInfo->getChild(0U)->setExpression(
+      static_cast<const RBAOperator*>(check)->getLhsOperand());
+  bool res {false};
+  switch (check->getModelElementType()) {
+    case RBAModelElementType::IsDisplayed:
+      res = static_cast<const RBAIsDisplayed*>(check)->executeFor(bodyInfo, arb, ruleObj);
+      break;
+    case RBAModelElementType::IsHidden:
+      res = static_cast<const RBAIsHidden*>(check)->executeFor(bodyInfo, arb, ruleObj);
+      break;
+    case RBAModelElementType::IsVisible:
+      res = static_cast<const RBAIsVisible*>(check)->executeFor(bodyInfo, arb, ruleObj);
+      break;
+    case RBAModelElementType::IsActive:
+      res = static_cast<const RBAIsActive*>(check)->executeFor(bodyInfo, arb, ruleObj);
+      break;
+    case RBAModelElementType::IsMuted:
+      res = static_cast<const RBAIsMuted*>(check)->executeFor(bodyInfo, arb, ruleObj);
+      break;
+    case RBAModelElementType::IsSounding:
+      res = static_cast<const RBAIsSounding*>(check)->executeFor(bodyInfo, arb, ruleObj);
+      break;
+    default:
+      bodyInfo->setExceptionBeforeArbitrate(true);
+      break;
+  }
+  bodyInfo->setResult(res ? RBAExecuteResult::TRUE : RBAExecuteResult::FALSE);
+  if (bodyInfo->isExceptionBeforeArbitrate()) {
+    info->setExceptionBeforeArbitrate(true);
+    res = false;
+  }
+  info->setResult(res ? RBAExecuteResult::TRUE : RBAExecuteResult::FALSE);
+  return res;
+}
+
 }
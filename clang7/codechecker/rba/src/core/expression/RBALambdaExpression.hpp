@@ -56,6 +56,12 @@ public:
 
   void setRuleObj(const RBARuleObject* const ruleObj);
   void clearRuleObj();
+  void createStatusCheck();
+  const RBAExpression* getStatusCheck() const;
+  bool executeStatusCheck(const RBAExpression* const check,
+                          const RBARuleObject* const ruleObj,
+                          RBAConstraintInfo* const info,
+                          RBAArbitratorImpl* const arb);
 
   // Log
 #ifdef RBA_USE_LOG
@@ -70,6 +76,11 @@ private:
   RBAVariable* variable_;
   RBAExpression* bodyText_ {nullptr};
   const RBARuleObject* ruleObj_ {nullptr};
+  // Body returned by getStatusCheck(), decided by createStatusCheck()
+  const RBAExpression* statusCheck_ {nullptr};
+  bool isStatusCheckCreated_ {false};
+
+  const RBAExpression* findStatusCheck() const;
 };
 
 }
@@ -19,13 +19,90 @@
  * LogicalOperator class definition
  */
 
+#include <chrono>
 #include <sstream>
 #include "RBALogicalOperator.hpp"
+#include "RBAConstraintInfo.hpp"
 #include "RBAExpressionType.hpp"
 
 namespace rba
 {
 
+void
+RBALogicalOperator::setOperandOrder(std::unique_ptr<RBAOperandOrder> newOperandOrder)
+{
+  operandOrder_ = std::move(newOperandOrder);
+}
+
+RBAOperandOrder*
+RBALogicalOperator::getOperandOrder() const
+{
+  return operandOrder_.get();
+}
+
+/**
+ * Evaluate AND or OR until the result is decided
+ * Used when only the result of the constraint is needed.
+ * The operands are evaluated in the learned order, and the ConstraintInfo
+ * of each operand keeps the index of the operand.
+ * The result and isExceptionBeforeArbitrate() are the same as those of
+ * executeCore(), but the allocatables of the operands after the deciding
+ * one are not collected.
+ * @param isAnd true for AND, false for OR
+ */
+bool
+RBALogicalOperator::executeShortCircuit(RBAConstraintInfo* const info,
+                                        RBAArbitratorImpl* const arb,
+                                        const bool isAnd) const
+{
+  const std::vector<RBAExpression*>& operand {getOperand()};
+  RBAOperandOrder* const order {operandOrder_.get()};
+  const bool measured {(order != nullptr) && order->isMeasured()};
+  bool decided {false};
+  bool exception {false};
+  for (std::size_t i {0U}; (i < operand.size()) && !decided; i++) {
+    std::uint32_t index {static_cast<std::uint32_t>(i)};
+    if (order != nullptr) {
+      index = order->getOrder()[i];
+    }
+    RBAConstraintInfo* const childInfo {info->getChild(index)};
+    std::chrono::steady_clock::time_point start;
+    if (measured) {
+      start = std::chrono::steady_clock::now();
+    }
+    const bool res {operand[static_cast<std::size_t>(index)]->execute(childInfo, arb)};
+    if (childInfo->isExceptionBeforeArbitrate()) {
+      exception = true;
+    } else if (res != isAnd) {
+      // AND is false and OR is true whatever the other operands are
+      decided = true;
+    } else {
+      ;
+    }
+    if (order != nullptr) {
+      std::uint64_t cost {0U};
+      if (measured) {
+        cost = static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now() - start).count());
+      }
+      order->addResult(index, decided, cost);
+    }
+  }
+  if (order != nullptr) {
+    order->endEvaluation();
+  }
+  if (decided) {
+    info->setExceptionBeforeArbitrate(false);
+    return !isAnd;
+  }
+  if (exception) {
+    info->setExceptionBeforeArbitrate(true);
+    return false;
+  }
+  return isAnd;
+}
+
 #ifdef RBA_USE_LOG
 const std::string
 RBALogicalOperator::getExpressionText() const
@@ -21,7 +21,9 @@
 #ifndef RBALOGICOPERATOR_HPP
 #define RBALOGICOPERATOR_HPP
 
+#include <memory>
 #include "RBAOperator.hpp"
+#include "RBAOperandOrder.hpp"
 
 namespace rba
 {
@@ -36,6 +38,9 @@ class DLL_EXPORT RBALogicalOperator : public RBAOperator
   RBALogicalOperator& operator=(const RBALogicalOperator&&)=delete;
 
  public:
+  void setOperandOrder(std::unique_ptr<RBAOperandOrder> newOperandOrder);
+  RBAOperandOrder* getOperandOrder() const;
+
   // Log
 #ifdef RBA_USE_LOG
   const std::string getExpressionText() const override;
@@ -43,6 +48,22 @@ class DLL_EXPORT RBALogicalOperator : public RBAOperator
   RBAExpressionType getUnderlyingType() const override;
 #endif
 
+ protected:
+  bool executeShortCircuit(RBAConstraintInfo* const info,
+                           RBAArbitratorImpl* const arb,
+                           const bool isAnd) const;
+
+ private:
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable:4251)
+#endif
+  // Evaluation order for the short-circuit evaluation. nullptr if not learned.
+  std::unique_ptr<RBAOperandOrder> operandOrder_;
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
 };
 
 }
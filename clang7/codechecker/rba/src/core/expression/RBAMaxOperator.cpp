@@ -55,7 +55,7 @@ const RBARuleObject* RBAMaxOperator::getReferenceObjectCore(
     info->setExceptionBeforeArbitrate(true);
   } else {
     if (lhsObj != nullptr) {
-      const RBAAllocatableSet* alloSet = dynamic_cast<const RBAAllocatableSet*>(lhsObj);
+      const RBAAllocatableSet* alloSet = lhsObj->toAllocatableSet();
       if (alloSet != nullptr) {
         std::uint32_t i { 0U };
         std::int32_t maxVal { -99 };
@@ -73,7 +73,7 @@ const RBARuleObject* RBAMaxOperator::getReferenceObjectCore(
           }
         }
       } else {
-        const RBAContentSet* contentSet = dynamic_cast<const RBAContentSet*>(lhsObj);
+        const RBAContentSet* contentSet = lhsObj->toContentSet();
         if (contentSet != nullptr) {
           std::uint32_t i { 0U };
           std::int32_t maxVal { -99 };
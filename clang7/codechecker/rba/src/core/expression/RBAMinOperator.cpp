@@ -53,7 +53,7 @@ const RBARuleObject* RBAMinOperator::getReferenceObjectCore(
     info->setExceptionBeforeArbitrate(true);
   } else {
     if (lhsObj != nullptr) {
-      const RBAAllocatableSet* alloSet = dynamic_cast<const RBAAllocatableSet*>(lhsObj);
+      const RBAAllocatableSet* alloSet = lhsObj->toAllocatableSet();
       if (alloSet != nullptr) {
         std::uint32_t i { 0U };
         std::int32_t minVal { INT32_MAX };
@@ -72,7 +72,7 @@ const RBARuleObject* RBAMinOperator::getReferenceObjectCore(
           }
         }
       } else {
-        const RBAContentSet* contentSet = dynamic_cast<const RBAContentSet*>(lhsObj);
+        const RBAContentSet* contentSet = lhsObj->toContentSet();
         if (contentSet != nullptr) {
           std::uint32_t i { 0U };
           std::int32_t minVal { INT32_MAX };
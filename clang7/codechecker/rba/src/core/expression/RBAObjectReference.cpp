@@ -67,6 +67,12 @@ RBAObjectReference::setRefObject(const RBARuleObject* const newRefObject)
   refObject_ = newRefObject;
 }
 
+const RBARuleObject*
+RBAObjectReference::getRefObject() const
+{
+  return refObject_;
+}
+
 #ifdef RBA_USE_LOG
 
 void
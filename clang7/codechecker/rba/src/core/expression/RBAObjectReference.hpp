@@ -40,6 +40,7 @@ public:
   const RBARuleObject* getReferenceObjectCore(RBAConstraintInfo* info,
                                                       RBAArbitratorImpl* arb) const override;
   void setRefObject(const RBARuleObject* const newRefObject);
+  const RBARuleObject* getRefObject() const;
 
   // Log
 #ifdef RBA_USE_LOG
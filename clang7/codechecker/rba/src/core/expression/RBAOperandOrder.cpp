@@ -0,0 +1,144 @@
+/**
+ * Copyright (c) 2019 DENSO CORPORATION.
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Operand order class definition
+ */
+
+#include <algorithm>
+#include "RBAOperandOrder.hpp"
+
+namespace rba
+{
+
+namespace
+{
+
+// Number of evaluations between two reorders
+const std::uint32_t REORDER_INTERVAL {256U};
+// The cost is measured once in this number of evaluations
+const std::uint32_t MEASURE_INTERVAL {8U};
+
+}
+
+RBAOperandOrder::RBAOperandOrder(const std::size_t operandCount)
+  : order_(operandCount),
+    statistics_(operandCount)
+{
+  for (std::size_t i {0U}; i < operandCount; i++) {
+    order_[i] = static_cast<std::uint32_t>(i);
+  }
+}
+
+const std::vector<std::uint32_t>&
+RBAOperandOrder::getOrder() const
+{
+  return order_;
+}
+
+/**
+ * Set a saved order
+ * @return false if order is not a permutation of the operand indices
+ */
+bool
+RBAOperandOrder::setOrder(const std::vector<std::uint32_t>& order)
+{
+  if (order.size() != order_.size()) {
+    return false;
+  }
+  std::vector<std::uint32_t> sorted {order};
+  std::sort(sorted.begin(), sorted.end());
+  for (std::size_t i {0U}; i < sorted.size(); i++) {
+    if (sorted[i] != static_cast<std::uint32_t>(i)) {
+      return false;
+    }
+  }
+  order_ = order;
+  return true;
+}
+
+/**
+ * Whether the cost of the current evaluation is measured
+ */
+bool
+RBAOperandOrder::isMeasured() const
+{
+  return ((evaluationCount_ % MEASURE_INTERVAL) == 0U);
+}
+
+/**
+ * Add the result of an operand
+ * @param index operand index
+ * @param decided true if the operand decided the result
+ * @param cost evaluation time in nanoseconds. Ignored if not isMeasured().
+ */
+void
+RBAOperandOrder::addResult(const std::uint32_t index, const bool decided,
+                           const std::uint64_t cost)
+{
+  Statistics& statistics {statistics_[static_cast<std::size_t>(index)]};
+  statistics.evaluated++;
+  if (decided) {
+    statistics.decided++;
+  }
+  if (isMeasured()) {
+    statistics.measured++;
+    statistics.cost += cost;
+  }
+}
+
+void
+RBAOperandOrder::endEvaluation()
+{
+  evaluationCount_++;
+  if ((evaluationCount_ % REORDER_INTERVAL) == 0U) {
+    reorder();
+  }
+}
+
+void
+RBAOperandOrder::reorder()
+{
+  // Expected cost to decide = cost / probability of deciding.
+  // The probability is smoothed so that an operand that has not been
+  // evaluated yet keeps a chance.
+  std::vector<double> rank(statistics_.size());
+  for (std::size_t i {0U}; i < statistics_.size(); i++) {
+    const Statistics& statistics {statistics_[i]};
+    double cost {1.0};
+    if (statistics.measured > 0U) {
+      cost = static_cast<double>(statistics.cost)
+             / static_cast<double>(statistics.measured);
+    }
+    const double probability
+      {static_cast<double>(statistics.decided + 1U)
+       / static_cast<double>(statistics.evaluated + 2U)};
+    rank[i] = cost / probability;
+  }
+  std::stable_sort(order_.begin(), order_.end(),
+                   [&rank](const std::uint32_t lhs, const std::uint32_t rhs) {
+                     return rank[lhs] < rank[rhs];
+                   });
+  // Older results count less, so that the order follows the use
+  for (Statistics& statistics : statistics_) {
+    statistics.evaluated /= 2U;
+    statistics.decided /= 2U;
+    statistics.measured /= 2U;
+    statistics.cost /= 2U;
+  }
+}
+
+}
@@ -0,0 +1,86 @@
+/**
+ * Copyright (c) 2019 DENSO CORPORATION.
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Operand order class header
+ *
+ * Learned evaluation order of the operands of AND or OR.
+ * While the arbitrator evaluates a constraint only to know whether it
+ * is satisfied, AND stops at the first false operand and OR at the first
+ * true operand. The operands are then evaluated in ascending order of
+ * the expected cost to decide the result, which is the average cost of
+ * an operand divided by the probability that it decides the result.
+ */
+
+#ifndef RBAOPERANDORDER_HPP
+#define RBAOPERANDORDER_HPP
+
+#include <cstdint>
+#include <vector>
+#include "RBADllExport.hpp"
+
+namespace rba
+{
+
+class DLL_EXPORT RBAOperandOrder
+{
+public:
+  explicit RBAOperandOrder(const std::size_t operandCount);
+  RBAOperandOrder(const RBAOperandOrder&)=delete;
+  RBAOperandOrder(const RBAOperandOrder&&)=delete;
+  RBAOperandOrder& operator=(const RBAOperandOrder&)=delete;
+  RBAOperandOrder& operator=(const RBAOperandOrder&&)=delete;
+  virtual ~RBAOperandOrder()=default;
+
+public:
+  const std::vector<std::uint32_t>& getOrder() const;
+  bool setOrder(const std::vector<std::uint32_t>& order);
+  bool isMeasured() const;
+  void addResult(const std::uint32_t index, const bool decided,
+                 const std::uint64_t cost);
+  void endEvaluation();
+
+private:
+  void reorder();
+
+private:
+  struct Statistics
+  {
+    std::uint64_t evaluated {0U};
+    // Number of evaluations that decided the result
+    std::uint64_t decided {0U};
+    std::uint64_t measured {0U};
+    // Sum of the measured costs in nanoseconds
+    std::uint64_t cost {0U};
+  };
+
+private:
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable:4251)
+#endif
+  // Operand indices in evaluation order
+  std::vector<std::uint32_t> order_;
+  std::vector<Statistics> statistics_;
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+  std::uint32_t evaluationCount_ {0U};
+};
+
+}
+
+#endif
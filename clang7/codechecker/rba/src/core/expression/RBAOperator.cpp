@@ -38,6 +38,12 @@ RBAOperator::addOperand(RBAExpression* const newExpr)
   }
 }
 
+void
+RBAOperator::setOperand(const std::vector<RBAExpression*>& newOperand)
+{
+  operand_ = newOperand;
+}
+
 RBAExpression*
 RBAOperator::getLhsOperand() const
 {
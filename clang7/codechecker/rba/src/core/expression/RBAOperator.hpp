@@ -39,6 +39,7 @@ protected:
 public:
   const std::vector<RBAExpression*>& getOperand() const;
   void addOperand(RBAExpression* const newExpr);
+  void setOperand(const std::vector<RBAExpression*>& newOperand);
   RBAExpression* getLhsOperand() const;
   RBAExpression* getRhsOperand() const;
 
@@ -19,6 +19,7 @@
  */
 
 #include "RBAOrOperator.hpp"
+#include "RBAArbitratorImpl.hpp"
 #include "RBAExpressionVisitor.hpp"
 #include "RBALogManager.hpp"
 #include "RBAModelElementType.hpp"
@@ -43,6 +44,10 @@ bool
 RBAOrOperator::executeCore(RBAConstraintInfo* info,
                            RBAArbitratorImpl* arb) const
 {
+  // Only the result of the constraint is needed
+  if ((arb != nullptr) && arb->isShortCircuit()) {
+    return executeShortCircuit(info, arb, false);
+  }
   bool isPassed {false};
   // Add itself to Constraint hierarchy for coverage
   LOG_addHierarchy(LOG_getSymbol());
@@ -63,37 +63,31 @@ const RBARuleObject* RBASelectOperator::getReferenceObjectCore(
   if (leftInfo->isExceptionBeforeArbitrate()) {
     info->setExceptionBeforeArbitrate(true);
   } else if (lhsObj != nullptr) {
-    if (dynamic_cast<const RBAAllocatableSet*>(lhsObj) != nullptr) {
-      std::list<const RBAAllocatable*> objs {
-          dynamic_cast<const RBAAllocatableSet*>(lhsObj)->getLeafAllocatable()};
+    if (lhsObj->toAllocatableSet() != nullptr) {
+      const std::list<const RBAAllocatable*>& objs {
+          lhsObj->toAllocatableSet()->getLeafAllocatable()};
       allocatableSet_->clear();
       std::uint32_t i {0U};
-      RBALambdaExpression* const lambda {getLambda()};
+      const RBAExpression* const check {getLambda()->getStatusCheck()};
       for (auto& obj : objs) {
-        LOG_addHierarchy("#" + std::to_string(i));
+        RBAConstraintInfo* const childInfo {info->getChild(i + 1U)};
+        const bool isPassed {executeLambda(obj, check, i, childInfo, arb)};
         ++i;
-        RBAConstraintInfo* const childInfo {info->getChild(i)};
-        lambda->setRuleObj(obj);
-        const bool isPassed {lambda->execute(childInfo, arb)};
-        LOG_removeHierarchy();
         if (isPassed && (!childInfo->isExceptionBeforeArbitrate())) {
           allocatableSet_->addTarget(obj);
         }
       }
       returnObj = allocatableSet_.get();
     } else {
-      std::list<const RBAContent*> objs {
-          dynamic_cast<const RBAContentSet*>(lhsObj)->getLeafContent()};
+      const std::list<const RBAContent*>& objs {
+          lhsObj->toContentSet()->getLeafContent()};
       contentSet_->clear();
       std::uint32_t i {0U};
-      RBALambdaExpression* const lambda {getLambda()};
+      const RBAExpression* const check {getLambda()->getStatusCheck()};
       for (auto& obj : objs) {
-        LOG_addHierarchy("#" + std::to_string(i));
+        RBAConstraintInfo* const childInfo {info->getChild(i + 1U)};
+        const bool isPassed {executeLambda(obj, check, i, childInfo, arb)};
         ++i;
-        RBAConstraintInfo* const childInfo {info->getChild(i)};
-        lambda->setRuleObj(obj);
-        const bool isPassed {lambda->execute(childInfo, arb)};
-        LOG_removeHierarchy();
         if (isPassed && (!childInfo->isExceptionBeforeArbitrate())) {
           contentSet_->addTarget(obj);
         }
@@ -81,13 +81,13 @@ RBASetOfOperator::getReferenceObjectCore(RBAConstraintInfo* info,
         contentSet_->addTarget(dynamic_cast<const RBAContent*>(obj));
         isContentSet = true;
       }
-      else if (dynamic_cast<const RBAAllocatableSet*>(obj) != nullptr) {
-        for (const RBAAllocatable* const a : dynamic_cast<const RBAAllocatableSet*>(obj)->getLeafAllocatable()) {
+      else if (obj->toAllocatableSet() != nullptr) {
+        for (const RBAAllocatable* const a : obj->toAllocatableSet()->getLeafAllocatable()) {
           allocatableSet_->addTarget(a);
         }
         isAllocatableSet = true;
       } else {
-        for (const RBAContent* const c : dynamic_cast<const RBAContentSet*>(obj)->getLeafContent()) {
+        for (const RBAContent* const c : obj->toContentSet()->getLeafContent()) {
           contentSet_->addTarget(c);
         }
         isContentSet = true;
@@ -48,11 +48,11 @@ std::int32_t RBASizeOperator::getValueCore(RBAConstraintInfo* info,
   if (leftInfo->isExceptionBeforeArbitrate()) {
     info->setExceptionBeforeArbitrate(true);
   } else if (lhsObj != nullptr) {
-    if (dynamic_cast<const RBAAllocatableSet*>(lhsObj) != nullptr) {
-      returnValue = static_cast<std::int32_t>(dynamic_cast<const RBAAllocatableSet*>(lhsObj)
+    if (lhsObj->toAllocatableSet() != nullptr) {
+      returnValue = static_cast<std::int32_t>(lhsObj->toAllocatableSet()
           ->getLeafAllocatable().size());
     } else {
-      returnValue = static_cast<std::int32_t>(dynamic_cast<const RBAContentSet*>(lhsObj)->getLeafContent()
+      returnValue = static_cast<std::int32_t>(lhsObj->toContentSet()->getLeafContent()
           .size());
     }
   } else {
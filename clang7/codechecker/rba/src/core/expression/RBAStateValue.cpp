@@ -56,7 +56,7 @@ RBAStateValue::getValueCore(RBAConstraintInfo* info, RBAArbitratorImpl* arb) con
     info->setExceptionBeforeArbitrate(true);
   } else {
     if (r != nullptr) {
-      c = dynamic_cast<const RBAContent*>(r->getRawObject());
+      c = r->getRawObject()->toContent();
       if (c != nullptr) {
         if (r->isPrevious()) {
           cs = arb->getResult()->getPreActiveState(c);
@@ -49,6 +49,74 @@ RBAArbitrator::setModel(RBAModel* newModel)
   impl_->setModel(dynamic_cast<RBAModelImpl*>(newModel));
 }
 
+bool
+RBAArbitrator::swapModel(RBAModel* newModel)
+{
+  return impl_->swapModel(dynamic_cast<RBAModelImpl*>(newModel));
+}
+
+bool
+RBAArbitrator::loadConstraintPlugin(const std::string& filename)
+{
+  return impl_->loadConstraintPlugin(filename);
+}
+
+void
+RBAArbitrator::setAdaptiveOperandOrder(const bool adaptive)
+{
+  impl_->setAdaptiveOperandOrder(adaptive);
+}
+
+bool
+RBAArbitrator::saveOperandOrder(const std::string& filename) const
+{
+  return impl_->saveOperandOrder(filename);
+}
+
+bool
+RBAArbitrator::loadOperandOrder(const std::string& filename)
+{
+  return impl_->loadOperandOrder(filename);
+}
+
+void
+RBAArbitrator::setConstraintCache(const bool cache)
+{
+  impl_->setConstraintCache(cache);
+}
+
+void
+RBAArbitrator::setObjectPool(const bool pool)
+{
+  impl_->setObjectPool(pool);
+}
+
+void
+RBAArbitrator::setReArbitrationLimit(const std::int32_t maxNest,
+                                     const std::int32_t maxCount)
+{
+  impl_->setReArbitrationLimit(maxNest, maxCount);
+}
+
+void
+RBAArbitrator::setArbitrationBudget(const std::int32_t maxMicroseconds,
+                                    const std::int32_t maxSteps)
+{
+  impl_->setArbitrationBudget(maxMicroseconds, maxSteps);
+}
+
+std::int32_t
+RBAArbitrator::getMaxReArbitrationNest() const
+{
+  return impl_->getMaxReArbitrationNest();
+}
+
+std::int32_t
+RBAArbitrator::getReArbitrationCount() const
+{
+  return impl_->getReArbitrationCount();
+}
+
 const RBAModel*
 RBAArbitrator::getModel() const
 {
@@ -74,6 +142,26 @@ RBAArbitrator::execute(std::list<std::string>& contexts,
   return impl_->execute(contexts, require);
 }
 
+void
+RBAArbitrator::execute(const std::string& contextName, bool require,
+                       std::unique_ptr<RBAResult>& result)
+{
+  impl_->execute(contextName, require, result);
+}
+
+void
+RBAArbitrator::execute(std::list<std::string>& contexts, bool require,
+                       std::unique_ptr<RBAResult>& result)
+{
+  impl_->execute(contexts, require, result);
+}
+
+std::unique_ptr<RBAResult>
+RBAArbitrator::simulate(std::list<std::string>& contexts, bool require)
+{
+  return impl_->simulate(contexts, require);
+}
+
 std::unique_ptr<RBAResult>
 RBAArbitrator::execute(const std::string& sceneName,
 		       std::list<std::pair<std::string,std::int32_t>>& properties)
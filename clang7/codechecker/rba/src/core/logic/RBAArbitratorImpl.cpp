@@ -10,6 +10,7 @@
 #include "RBAResultSet.hpp"
 #include "RBAAreaImpl.hpp"
 #include "RBAAllocatable.hpp"
+#include "RBAConstraintMap.hpp"
 #include "RBAAffectInfo.hpp"
 #include "RBAViewContentImpl.hpp"
 #include "RBAViewContentStateImpl.hpp"
@@ -19,18 +20,60 @@
 #include "RBAViewTransition.hpp"
 #include "RBAViewMove.hpp"
 #include "RBAConstraintInfo.hpp"
+#include "RBAConstraintPlugin.hpp"
+#include "RBAOperandOrders.hpp"
 #include "RBAZoneImpl.hpp"
 #include "RBASoundContentImpl.hpp"
 #include "RBAContentState.hpp"
+#include "RBAElementCast.hpp"
 #include "RBARollbacker.hpp"
 #include "RBALogManager.hpp"
 #include "RBAModelFactory.hpp"
 #include "RBAAllwaysCheckConstraintCollector.hpp"
 #include "RBAModelElementType.hpp"
 #include "RBARequestQueMember.hpp"
+#include "RBASceneImpl.hpp"
 
 namespace rba {
 
+namespace
+{
+// 再利用を有効にしたときに事前に生成する結果セットの数
+const std::size_t RESERVED_RESULT_SETS {8U};
+// 調停の時間の上限を確認する手順の間隔
+const std::uint32_t DEADLINE_CHECK_INTERVAL {16U};
+
+// アロケータブルの調停状態
+struct AllocatableState
+{
+  const RBAContentState* state;
+  bool hidden;
+  bool attenuated;
+  bool checked;
+  bool hiddenChecked;
+  bool attenuateChecked;
+};
+
+AllocatableState getAllocatableState(const RBAAllocatable* const allocatable)
+{
+  return {allocatable->getState(), allocatable->isHidden(),
+          allocatable->isAttenuated(), allocatable->isChecked(),
+          allocatable->isHiddenChecked(), allocatable->isAttenuateChecked()};
+}
+
+void setAllocatableState(RBAAllocatable* const allocatable,
+                         const AllocatableState& state)
+{
+  allocatable->clearStatus();
+  allocatable->setState(state.state);
+  allocatable->setHidden(state.hidden);
+  allocatable->setAttenuated(state.attenuated);
+  allocatable->setChecked(state.checked);
+  allocatable->setHiddenChecked(state.hiddenChecked);
+  allocatable->setAttenuateChecked(state.attenuateChecked);
+}
+}
+
 RBAArbitrator::Impl::
 Impl(RBAArbitrator* const arb, RBAModelImpl* const newModel)
   : impl_{}
@@ -69,9 +112,171 @@ setModel(RBAModelImpl* const newModel)
   std::lock_guard<std::recursive_mutex> lock {impl_.getMutex()};
   impl_.setModel(newModel);
   impl_.getModel()->createSortedAllocatables();
+  if (impl_.isAdaptiveOrder()) {
+    RBAOperandOrders::create(impl_.getModel());
+  }
   clearArbitration();
 }
 
+/**
+ * 調停状態を保ったままモデルを差し替える
+ * 要求状態、シーン状態とプロパティ、割り当て結果、キュー中の要求を
+ * 名前で新しいモデルへ引き継ぐ。新しいモデルに存在しない要素は捨てる。
+ * 新しいモデルの準備はロック外で行い、ロック中は引き継ぎのみ行う。
+ * 新しいモデルは他の調停ロジックから参照されていないこと。
+ */
+bool
+RBAArbitrator::Impl::
+swapModel(RBAModelImpl* const newModel)
+{
+  if (newModel == nullptr) {
+    return false;
+  }
+  // 現在のモデルは調停中の可能性があるので、準備する前にロック中で確認する
+  {
+    const std::lock_guard<std::recursive_mutex> lock {impl_.getMutex()};
+    if (newModel == impl_.getModel()) {
+      return true;
+    }
+  }
+  // 新しいモデルはまだ調停で参照されていないので、ロック外で準備する
+  newModel->createSortedAllocatables();
+  newModel->clearElementsStatus();
+
+  const std::lock_guard<std::recursive_mutex> lock {impl_.getMutex()};
+  // 準備中に他のスレッドが同じモデルに差し替えた場合
+  if (newModel == impl_.getModel()) {
+    return true;
+  }
+  if (impl_.isAdaptiveOrder()) {
+    RBAOperandOrders::create(newModel);
+  }
+  std::unique_ptr<RBAResultSet> backupResultSet
+    {impl_.mapResultSet(*impl_.getBackupResultSet(), newModel)};
+  // 要求順序はnextResultSetのものを有効にする(createNextCurrentResultSet()と同じ)
+  std::unique_ptr<RBAResultSet> nextResultSet
+    {impl_.mapResultSet(*impl_.getNextResultSet(), newModel)};
+  std::deque<std::unique_ptr<RBARequestQueMember>> requestQue;
+  for (const auto& request : impl_.getRequestQue()) {
+    const RBAContentState* const state {newModel->findContentState(
+        request->getContentState()->getUniqueName())};
+    if (state != nullptr) {
+      requestQue.push_back(std::make_unique<RBARequestQueMember>(
+          state, request->isOn(), request->getSyncIndex()));
+    }
+  }
+
+  impl_.setModel(newModel);
+  impl_.getRequestQue().swap(requestQue);
+  impl_.getCancelChecked().clear();
+  impl_.setReservedResultSet(nullptr);
+  impl_.setResult(std::make_unique<RBAResultImpl>(
+      &impl_, std::make_unique<RBAResultSet>(*backupResultSet)));
+  impl_.setBackupResultSet(std::move(backupResultSet));
+  impl_.setNextResultSet(std::move(nextResultSet));
+
+  return true;
+}
+
+/**
+ * rbaconstraintgenで生成した制約式のプラグインを読み込む
+ * プラグインは現在のモデルから生成したものでなければならない。
+ * 読み込みに失敗した場合、現在のプラグインはそのまま使用する。
+ */
+bool
+RBAArbitrator::Impl::
+loadConstraintPlugin(const std::string& filename)
+{
+  const std::lock_guard<std::recursive_mutex> lock {impl_.getMutex()};
+  std::unique_ptr<RBAConstraintPlugin> plugin
+    {std::make_unique<RBAConstraintPlugin>()};
+  if (!plugin->load(filename, impl_.getModel())) {
+    return false;
+  }
+  impl_.getModel()->setConstraintPlugin(std::move(plugin));
+  return true;
+}
+
+/**
+ * AND、ORのオペランドの評価順序の学習を切り替える
+ * 学習した順序はモデルに保持し、無効にしても破棄しない
+ */
+void
+RBAArbitrator::Impl::
+setAdaptiveOperandOrder(const bool adaptive)
+{
+  const std::lock_guard<std::recursive_mutex> lock {impl_.getMutex()};
+  if (adaptive) {
+    RBAOperandOrders::create(impl_.getModel());
+  }
+  impl_.setAdaptiveOrder(adaptive);
+}
+
+bool
+RBAArbitrator::Impl::
+saveOperandOrder(const std::string& filename)
+{
+  const std::lock_guard<std::recursive_mutex> lock {impl_.getMutex()};
+  return RBAOperandOrders::write(impl_.getModel(), filename);
+}
+
+bool
+RBAArbitrator::Impl::
+loadOperandOrder(const std::string& filename)
+{
+  const std::lock_guard<std::recursive_mutex> lock {impl_.getMutex()};
+  return RBAOperandOrders::read(impl_.getModel(), filename);
+}
+
+void
+RBAArbitrator::Impl::
+setConstraintCache(const bool cache)
+{
+  const std::lock_guard<std::recursive_mutex> lock {impl_.getMutex()};
+  impl_.setConstraintCache(cache);
+}
+
+void
+RBAArbitrator::Impl::
+setObjectPool(const bool pool)
+{
+  const std::lock_guard<std::recursive_mutex> lock {impl_.getMutex()};
+  impl_.setObjectPool(pool);
+}
+
+void
+RBAArbitrator::Impl::
+setReArbitrationLimit(const std::int32_t maxNest, const std::int32_t maxCount)
+{
+  const std::lock_guard<std::recursive_mutex> lock {impl_.getMutex()};
+  impl_.setReArbitrationLimit(maxNest, maxCount);
+}
+
+void
+RBAArbitrator::Impl::
+setArbitrationBudget(const std::int32_t maxMicroseconds,
+                     const std::int32_t maxSteps)
+{
+  const std::lock_guard<std::recursive_mutex> lock {impl_.getMutex()};
+  impl_.setArbitrationBudget(maxMicroseconds, maxSteps);
+}
+
+std::int32_t
+RBAArbitrator::Impl::
+getMaxReArbitrationNest()
+{
+  const std::lock_guard<std::recursive_mutex> lock {impl_.getMutex()};
+  return impl_.getMaxNest();
+}
+
+std::int32_t
+RBAArbitrator::Impl::
+getReArbitrationCount()
+{
+  const std::lock_guard<std::recursive_mutex> lock {impl_.getMutex()};
+  return impl_.getReArbitrationCount();
+}
+
 void
 RBAArbitrator::Impl::
 initialize(std::list<std::string>& contexts)
@@ -113,6 +318,56 @@ std::unique_ptr<RBAResult> RBAArbitrator::Impl::execute(
   }
 }
 
+void RBAArbitrator::Impl::execute(
+    const std::string& contextName, const bool require,
+    std::unique_ptr<RBAResult>& result)
+{
+  const std::lock_guard<std::recursive_mutex> lock {impl_.getMutex()};
+  if (impl_.isValidContext(contextName) == false) {
+    // エラーの場合は、Resultのコピーを生成してエラーフラグをセットする
+    std::unique_ptr<RBAResultImpl> errorResult {std::make_unique<RBAResultImpl>(
+        &impl_, impl_.getResultSetPool()->copy(*impl_.getBackupResultSet()))};
+    errorResult->setStatusType(RBAResultStatusType::UNKNOWN_CONTENT_STATE);
+    result = std::move(errorResult);
+  } else {
+    static_cast<void>(impl_.setRequestData(contextName, require, nullptr,
+                      static_cast<std::uint32_t>(impl_.getRequestQue().size())));
+    impl_.arbitrateMain(result);
+  }
+}
+
+void RBAArbitrator::Impl::execute(
+    std::list<std::string>& contexts, const bool require,
+    std::unique_ptr<RBAResult>& result)
+{
+  const std::lock_guard<std::recursive_mutex> lock {impl_.getMutex()};
+  if (impl_.isValidContext(contexts) == false) {
+    // エラーの場合は、Resultのコピーを生成してエラーフラグをセットする
+    std::unique_ptr<RBAResultImpl> errorResult {std::make_unique<RBAResultImpl>(
+        &impl_, impl_.getResultSetPool()->copy(*impl_.getBackupResultSet()))};
+    errorResult->setStatusType(RBAResultStatusType::UNKNOWN_CONTENT_STATE);
+    result = std::move(errorResult);
+  } else {
+    impl_.setRequestData(contexts, require);
+    impl_.arbitrateMain(result);
+  }
+}
+
+std::unique_ptr<RBAResult> RBAArbitrator::Impl::simulate(
+    std::list<std::string>& contexts, const bool require)
+{
+  const std::lock_guard<std::recursive_mutex> lock {impl_.getMutex()};
+  if (impl_.isValidContext(contexts) == false) {
+    // エラーの場合は、Resultのコピーを生成してエラーフラグをセットして返す
+    std::unique_ptr<RBAResultImpl> result {std::make_unique<RBAResultImpl>(
+        &impl_, std::make_unique<RBAResultSet>(*impl_.getBackupResultSet()))};
+    result->setStatusType(RBAResultStatusType::UNKNOWN_CONTENT_STATE);
+    return std::move(result);
+  } else {
+    return impl_.simulateMain(contexts, require);
+  }
+}
+
 std::unique_ptr<RBAResult> RBAArbitrator::Impl::execute(
     const std::string& sceneName,
     std::list<std::pair<std::string, std::int32_t>>& properties)
@@ -205,10 +460,10 @@ setResultContentState(const std::string& allocatableName,
   // ----------------------------------------------------------
   if (beforeContentState != nullptr) {
     // 要求されたアロケータブルに元々割り当てられていたコンテントの状態を更新する
-    dynamic_cast<RBAContent*>(beforeContentState->getOwner())->updateStatus(impl_.getResultRef().get());
+    beforeContentState->getOwner()->toContent()->updateStatus(impl_.getResultRef().get());
   }
   // 要求されたコンテントの状態を更新する
-  dynamic_cast<RBAContent*>(state->getOwner())->updateStatus(impl_.getResultRef().get());
+  state->getOwner()->toContent()->updateStatus(impl_.getResultRef().get());
 
   // コンテントのキャンセル処理
   // C++版で追加した処理
@@ -338,11 +593,11 @@ setAllocatableResult(const std::string& allocatableName,
       &impl_,
       std::make_unique<RBAResultSet>(*impl_.getBackupResultSet()),
       std::make_unique<RBAResultSet>(*impl_.getNextResultSet())));
-  RBAContent* const content {dynamic_cast<RBAContent*>(state->getOwner())};
+  RBAContent* const content {state->getOwner()->toContent()};
   content->updateRequestStatus(impl_.getResult()->getCurResultSet().get(), true);
   if (beforeContentState != nullptr) {
     // 要求されたアロケータブルに元々割り当てられていたコンテントの状態を更新する
-    dynamic_cast<RBAContent*>(beforeContentState->getOwner())->updateStatus(impl_.getResultRef().get());
+    beforeContentState->getOwner()->toContent()->updateStatus(impl_.getResultRef().get());
   }
   // 要求されたコンテントの状態を更新する
   content->updateStatus(impl_.getResultRef().get());
@@ -438,14 +693,173 @@ satisfiesConstraints() const
   return result;
 }
 
+/**
+ * satisfiesConstraints()と同じ調停状態で、オフライン制約を含むすべての制約を
+ * 評価し、満たされない制約を求める
+ */
+void
+RBAArbitratorImpl::
+getFailedConstraints(std::list<const RBAConstraintImpl*>& failedConstraints) const
+{
+  const std::lock_guard<std::recursive_mutex> lock{mutex_};
+  std::unique_ptr<RBAResultImpl> tmpResult {std::move(result_)};
+  result_ = std::make_unique<RBAResultImpl>(
+      this,
+      std::make_unique<RBAResultSet>(*(reservedResultSet_.get())),
+      std::make_unique<RBAResultSet>(*(resultSetForSatisfiesConstraints_.get())));
+  for(const RBAConstraintImpl* const constraint : model_->getConstraintImpls()) {
+    if (!const_cast<RBAConstraintImpl*>(constraint)->execute(const_cast<RBAArbitratorImpl*>(this))) {
+      failedConstraints.push_back(constraint);
+    }
+  }
+  result_ = std::move(tmpResult);
+}
+
+/**
+ * @return 直前の調停での再調停の最大ネスト階層（再調停がなければ0）
+ */
+std::int32_t
+RBAArbitratorImpl::getMaxNest() const
+{
+  return maxNest_;
+}
+
+/**
+ * @return 直前の調停で再調停したアロケータブルの数
+ */
+std::int32_t
+RBAArbitratorImpl::getReArbitrationCount() const
+{
+  return static_cast<std::int32_t>(reArbitrationCount_);
+}
+
 /**
  * 調停実行
  */
 std::unique_ptr<RBAResult>
 RBAArbitratorImpl::arbitrateMain()
 {
+  arbitrateRequests();
+
+  // 保管用にresult_を使うため、戻り値のresult_を別名にする
+  auto retResult = std::move(result_);
+
+  // 調停中以外の場合で、調停結果を利用することがあるため、調停結果を保持しておく
+  result_ = std::make_unique<RBAResultImpl>(retResult.get());
+
+  // std::unique_ptr<RBAResultImpl>をstd::unique_ptr<RBAResult>にキャストするので
+  // std::move()がないとコンパイルエラーになる
+  return std::move(retResult);
+}
+
+/**
+ * 調停実行(呼び出し元の結果オブジェクトに調停結果を書き込む)
+ * 調停結果はコピーせずにそのまま保持し、呼び出し元の結果オブジェクトに
+ * 内容を書き込む。前回の結果オブジェクトが渡された場合はそのメモリを再利用する。
+ */
+void
+RBAArbitratorImpl::arbitrateMain(std::unique_ptr<RBAResult>& result)
+{
+  arbitrateRequests();
+
+  RBAResultImpl* const dst {dynamic_cast<RBAResultImpl*>(result.get())};
+  if (dst == nullptr) {
+    std::unique_ptr<RBAResultImpl> newResult
+      {std::make_unique<RBAResultImpl>(result_.get())};
+    newResult->setStatusType(result_->getStatusType());
+    result = std::move(newResult);
+  } else {
+    dst->copyFrom(*result_);
+  }
+  // 保持する調停結果は複製したものと同じ状態にする
+  result_->setStatusType(RBAResultStatusType::SUCCESS);
+}
+
+/**
+ * 調停状態を変えずに調停結果を求める
+ * 調停状態を退避して複製した調停状態で調停し、調停後に退避した調停状態に戻す。
+ * 未調停の要求は複製に含めず、次の調停のために残す。
+ */
+std::unique_ptr<RBAResult>
+RBAArbitratorImpl::simulateMain(std::list<std::string>& contexts,
+                                const bool require)
+{
+  // 確定した調停状態を退避する
+  std::unique_ptr<RBAResultImpl> committedResult {std::move(result_)};
+  std::unique_ptr<RBAResultSet> committedNext {std::move(nextResultSet_)};
+  std::unique_ptr<RBAResultSet> committedBackup {std::move(backupResultSet_)};
+  std::unique_ptr<RBAResultSet> committedReserved {std::move(reservedResultSet_)};
+  std::unique_ptr<RBAResultSet> committedSatisfies
+    {std::move(resultSetForSatisfiesConstraints_)};
+  std::deque<std::unique_ptr<RBARequestQueMember>> committedQue;
+  committedQue.swap(requestQue_);
+  const std::set<const RBAContentState*> committedCancelChecked {cancelChecked_};
+  const std::uint32_t committedSyncIndex {syncIndex_};
+  const std::vector<RBAAllocatable*>& allocatables {model_->getAllocatableTable()};
+  std::vector<AllocatableState> committedAllocatables;
+  committedAllocatables.reserve(allocatables.size());
+  for (const RBAAllocatable* const a : allocatables) {
+    committedAllocatables.push_back(getAllocatableState(a));
+  }
+  // 要求順はコンテンツ状態に設定されるので、退避しておく
+  const std::list<const RBAContentState*>& states {model_->getContentStates()};
+  std::vector<std::int32_t> committedOrders;
+  committedOrders.reserve(states.size());
+  for (const RBAContentState* const state : states) {
+    committedOrders.push_back(state->getContentStateOrder());
+  }
+
+  // 調停状態を複製して調停する
+  result_ = std::make_unique<RBAResultImpl>(committedResult.get());
+  nextResultSet_ = resultSetPool_->copy(*committedNext);
+  backupResultSet_ = resultSetPool_->copy(*committedBackup);
+  if (committedSatisfies != nullptr) {
+    resultSetForSatisfiesConstraints_ = resultSetPool_->copy(*committedSatisfies);
+  }
+  setRequestData(contexts, require);
+  std::unique_ptr<RBAResult> result {arbitrateMain()};
+
+  // 複製した調停状態を破棄して、退避した調停状態に戻す
+  resultSetPool_->release(std::move(nextResultSet_));
+  resultSetPool_->release(std::move(backupResultSet_));
+  resultSetPool_->release(std::move(reservedResultSet_));
+  resultSetPool_->release(std::move(resultSetForSatisfiesConstraints_));
+  result_ = std::move(committedResult);
+  nextResultSet_ = std::move(committedNext);
+  backupResultSet_ = std::move(committedBackup);
+  reservedResultSet_ = std::move(committedReserved);
+  resultSetForSatisfiesConstraints_ = std::move(committedSatisfies);
+  requestQue_.swap(committedQue);
+  cancelChecked_ = committedCancelChecked;
+  syncIndex_ = committedSyncIndex;
+  for (std::size_t i {0U}; i < allocatables.size(); i++) {
+    setAllocatableState(allocatables[i], committedAllocatables[i]);
+  }
+  auto order = committedOrders.cbegin();
+  for (const RBAContentState* const state : states) {
+    const_cast<RBAContentState*>(state)->setOrder(*order);
+    ++order;
+  }
+
+  return result;
+}
+
+/**
+ * 要求を調停してresult_に調停結果を作成する
+ */
+void
+RBAArbitratorImpl::arbitrateRequests()
+{
+  maxNest_ = 0;
+  reArbitrationCount_ = 0U;
+  arbitrationSteps_ = 0U;
+  budgetExceeded_ = false;
+  if (timeBudget_.count() > 0) {
+    deadline_ = std::chrono::steady_clock::now() + timeBudget_;
+  }
   // cancelArbitration()されたときのために調停前の要求状態を保存
-  reservedResultSet_ = std::make_unique<RBAResultSet>(*backupResultSet_);
+  resultSetPool_->release(std::move(reservedResultSet_));
+  reservedResultSet_ = resultSetPool_->copy(*backupResultSet_);
 
   // 要求毎の差分調停
   if (requestQue_.empty()) {
@@ -465,7 +879,7 @@ RBAArbitratorImpl::arbitrateMain()
       requestQue_.pop_front();
       result_->setActive(request->getContentState(), request->isOn());
       // コンテントの状態を更新する
-      RBAContent* const content {dynamic_cast<RBAContent*>(request->getContentState()->getOwner())};
+      RBAContent* const content {request->getContentState()->getOwner()->toContent()};
       content->updateRequestStatus(result_->getCurResultSet().get(), request->isOn());
       if (requestQue_.empty()) {
         differenceArbitrate();
@@ -488,8 +902,11 @@ RBAArbitratorImpl::arbitrateMain()
   }
 
   result_ = std::make_unique<RBAResultImpl>(
-      this, std::make_unique<RBAResultSet>(*reservedResultSet_),
+      this, resultSetPool_->copy(*reservedResultSet_),
       result_->createBackupCurrentResultSet());
+  if (budgetExceeded_) {
+    result_->setStatusType(RBAResultStatusType::DEGRADED);
+  }
 
   // コンテントのキャンセル処理
   // C++版で追加した処理
@@ -512,16 +929,146 @@ RBAArbitratorImpl::arbitrateMain()
   backupResultSet_ = result_->createBackupCurrentResultSet();
   // 次の調停結果セットを作成
   nextResultSet_ = result_->createNextCurrentResultSet();
+}
 
-  // 保管用にresult_を使うため、戻り値のresult_を別名にする
-  auto retResult = std::move(result_);
-
-  // 調停中以外の場合で、調停結果を利用することがあるため、調停結果を保持しておく
-  result_ = std::make_unique<RBAResultImpl>(retResult.get());
+/**
+ * 現在のモデルの結果セットを、名前で対応付けて新しいモデルの結果セットに変換する
+ * 割り当て結果は新しいモデルのアロケータブルにも設定する
+ */
+std::unique_ptr<RBAResultSet>
+RBAArbitratorImpl::
+mapResultSet(const RBAResultSet& src, RBAModelImpl* const newModel) const
+{
+  std::unique_ptr<RBAResultSet> dst {std::make_unique<RBAResultSet>()};
+
+  // シーンプロパティ(新しいモデルの初期値を設定した後で現在値を引き継ぐ)
+  for (const RBASceneImpl* const scene : newModel->getSceneImpls()) {
+    for (const std::string& propertyName : scene->getPropertyNames()) {
+      dst->setSceneProperty(scene, propertyName,
+                            scene->getPropertyValue(propertyName));
+    }
+  }
+  for (const RBASceneImpl* const scene : model_->getSceneImpls()) {
+    const RBASceneImpl* const newScene
+      {newModel->findSceneImpl(scene->getElementName())};
+    if (newScene != nullptr) {
+      for (const std::string& propertyName : scene->getPropertyNames()) {
+        const RBAAbstractProperty* const newProperty
+          {newScene->getProperty(propertyName)};
+        if (newProperty != nullptr) {
+          dst->setSceneProperty(newProperty, src.getSceneProperty(
+              scene->getProperty(propertyName)));
+        }
+      }
+    }
+  }
+  // シーン状態
+  for (const RBAScene* const scene : src.getActiveScenes()) {
+    const RBASceneImpl* const newScene {newModel->findSceneImpl(scene->getName())};
+    if (newScene != nullptr) {
+      dst->setActive(newScene, true);
+    }
+  }
+  // 要求状態(要求順を保つ)
+  for (const RBAViewContentState* const state : src.getActiveViewContentStates()) {
+    const RBAContentState* const newState
+      {newModel->findContentState(state->getUniqueName())};
+    if (newState != nullptr) {
+      dst->setActive(newState, true);
+    }
+  }
+  for (const RBASoundContentState* const state : src.getActiveSoundContentStates()) {
+    const RBAContentState* const newState
+      {newModel->findContentState(state->getUniqueName())};
+    if (newState != nullptr) {
+      dst->setActive(newState, true);
+    }
+  }
+  // コンテントの状態遷移
+  for (const auto& status : *src.getStatus()) {
+    const RBAContent* const newContent
+      {newModel->findContent(status.first->getElementName())};
+    if (newContent != nullptr) {
+      (*dst->getStatus())[newContent] = status.second;
+    }
+  }
+  // 割り当て結果
+  for (const RBAAllocatable* const alloc : model_->getAllocatableTable()) {
+    const RBAContentState* const state {src.getDirectContentState(alloc)};
+    const bool hidden {src.isHidden(alloc)};
+    if ((state == nullptr) && !hidden) {
+      continue;
+    }
+    RBAAllocatable* const newAlloc {const_cast<RBAAllocatable*>(
+        newModel->findAllocatable(alloc->getElementName()))};
+    if (newAlloc != nullptr) {
+      const RBAContentState* newState {nullptr};
+      if (state != nullptr) {
+        newState = newModel->findContentState(state->getUniqueName());
+      }
+      newAlloc->setHidden(hidden);
+      // 減衰はsetContentState()でattenuatedZones_に反映される
+      if (alloc->isZone()) {
+        newAlloc->setAttenuated(src.isAttenuated(
+            RBAElementCast::staticCast<const RBAZoneImpl*>(alloc)));
+      }
+      newAlloc->setState(newState);
+      dst->setContentState(newAlloc, newState);
+    }
+  }
+  // 出力中のコンテント状態(出力順を保つ)
+  for (const RBAViewContentState* const state : src.getVisibleContentStates()) {
+    const RBAContentState* const newState
+      {newModel->findContentState(state->getUniqueName())};
+    if (newState != nullptr) {
+      dst->addOutputtingContentState(newState);
+    }
+  }
+  for (const RBASoundContentState* const state : src.getSoundingContentStates()) {
+    const RBAContentState* const newState
+      {newModel->findContentState(state->getUniqueName())};
+    if (newState != nullptr) {
+      dst->addOutputtingContentState(newState);
+    }
+  }
+  // 表示待ち、キャンセルされたコンテント
+  for (const RBAViewContent* const content : src.getStandbyViewContents()) {
+    const RBAContent* const newContent {newModel->findContent(content->getName())};
+    if (newContent != nullptr) {
+      dst->addStandbyContent(newContent);
+    }
+  }
+  for (const RBASoundContent* const content : src.getStandbySoundContents()) {
+    const RBAContent* const newContent {newModel->findContent(content->getName())};
+    if (newContent != nullptr) {
+      dst->addStandbyContent(newContent);
+    }
+  }
+  for (const RBAViewContent* const content : src.getCanceledViewContents()) {
+    const RBAContent* const newContent {newModel->findContent(content->getName())};
+    if (newContent != nullptr) {
+      dst->addCanceledContent(newContent);
+    }
+  }
+  for (const RBASoundContent* const content : src.getCanceledSoundContents()) {
+    const RBAContent* const newContent {newModel->findContent(content->getName())};
+    if (newContent != nullptr) {
+      dst->addCanceledContent(newContent);
+    }
+  }
+  for (const RBAContentState* const state : model_->getContentStates()) {
+    if (src.isCancel(state)) {
+      const RBAContentState* const newState
+        {newModel->findContentState(state->getUniqueName())};
+      if (newState != nullptr) {
+        dst->setCancel(newState, true);
+      }
+    }
+  }
+  // イベントコンテントはイベント処理要素がモデルに存在しないため引き継がない。
+  // 条件が異なるシーンの情報は調停ごとに作り直すキャッシュなので引き継がない。
 
-  // std::unique_ptr<RBAResultImpl>をstd::unique_ptr<RBAResult>にキャストするので
-  // std::move()がないとコンパイルエラーになる
-  return std::move(retResult);
+  return dst;
 }
 
 bool
@@ -654,13 +1201,20 @@ RBAArbitratorImpl::setRequestData(std::list<std::string>& contexts,
  */
 void
 RBAArbitratorImpl::
-arbitrate(std::list<RBAAllocatable*>& allocatables)
+arbitrate(const std::vector<RBAAllocatable*>& allocatables)
 {
   LOG_arbitrateAreaLogLine("----Arbitrate----");
   std::set<const RBAAllocatable*> revisitedInitSet;
 
   std::set<const RBAAllocatable*> revisited;
   for (auto& alloc : allocatables) {
+    if (budgetExceeded_) {
+      // 調停の上限を超えたので、再調停で調停済のもの以外は前回の調停結果とする
+      if (!alloc->isChecked()) {
+        keepPreviousResult(alloc);
+      }
+      continue;
+    }
     revisited = revisitedInitSet;
     // -------------------------------------------------------------------------
     // 無限ループ対策として調停の中で対象アロケータブルに影響を与えた他アロケータブルの
@@ -669,43 +1223,158 @@ arbitrate(std::list<RBAAllocatable*>& allocatables)
     RBAAffectInfo affectInfo;
     LOG_arbitrateAreaLogLine(
         alloc->getSymbol() + "[" + alloc->getElementName() + "] check start");
-    arbitrateAllocatable(alloc, revisited, 0, &affectInfo, nullptr);
+    arbitrateAllocatable(alloc, revisited, &affectInfo);
   }
-  for (auto& a : model_->getSortedAllocatables()) {
+  for (RBAAllocatable* const a : allocatables) {
     result_->setContentState(a, a->getState());
   }
 }
 
 /**
- * アロケータブルの調停を再帰的に行う
+ * 再調停の1階層分の調停状態
+ * arbitrateAllocatable()を再帰呼び出しする代わりにスタックに積み、
+ * 上に積まれたものから順に処理を進める
+ */
+struct RBAArbitratorImpl::ReArbitrationFrame
+{
+  // 次に行う処理
+  enum class Step : std::uint8_t
+  {
+    START,
+    NEXT_CONTENT,
+    CONTENT_CHECKED,
+    HIDDEN_FALSE_CHECKED,
+    HIDDEN_TRUE_CHECKED,
+    ATTENUATE,
+    ATTENUATE_FALSE_CHECKED,
+    ATTENUATE_TRUE_CHECKED,
+    CONTENT_DONE,
+    REARBITRATE_AFFECTED,
+    NEXT_AFFECTED,
+    FINISH,
+    CHECK,
+    NEXT_REVISIT
+  };
+
+  ReArbitrationFrame(RBAAllocatable* const alloc, const std::int32_t level,
+                     RBARollbacker* const parent)
+    : allocatable{alloc},
+      nest{level},
+      parentRollbacker{parent}
+  {
+  }
+  ReArbitrationFrame(const ReArbitrationFrame&)=delete;
+  ReArbitrationFrame(const ReArbitrationFrame&&)=delete;
+  ReArbitrationFrame& operator=(const ReArbitrationFrame&)=delete;
+  ReArbitrationFrame& operator=(const ReArbitrationFrame&&)=delete;
+  ~ReArbitrationFrame()=default;
+
+  /**
+   * 調停中のアロケータブルの制約チェックを始める
+   * 制約を満たさない場合は再調停を行い、その後afterの処理に進む
+   * チェック結果はisPassedに設定する
+   */
+  void beginCheck(const RBAConstraintMap kind, const bool finalCheck,
+                  const Step after)
+  {
+    constraints = allocatable->getConstraintArray(kind);
+    isFinal = finalCheck;
+    afterCheck = after;
+    step = Step::CHECK;
+  }
+
+  RBAAllocatable* const allocatable;
+  // 再調停のネスト階層（一番初めの調停は0）
+  const std::int32_t nest;
+  RBARollbacker* const parentRollbacker;
+  Step step {Step::START};
+  // 再調停前に、調停対象アロケータブルが影響を与えたアロケータブル
+  std::set<const RBAAllocatable*> affectAllocatables;
+  const RBAContentState* beforeState {nullptr};
+  // 調停ポリシーでソートされたコンテンツ状態と、割り当て中のコンテンツ状態
+  std::list<const RBAContentState*> contentStates;
+  std::list<const RBAContentState*>::const_iterator contentState;
+  bool isSkipped {false};
+  bool hiddenIsPassed {false};
+  bool attenuateIsPassed {true};
+  // 再調停する影響アロケータブルと、次に再調停する影響アロケータブル
+  std::list<const RBAAllocatable*> sortedAllocatables;
+  std::list<const RBAAllocatable*>::const_iterator affectAllocatable;
+  // 制約チェック中の制約と、チェック後に行う処理
+  RBAElementArray<RBAConstraintImpl*> constraints;
+  bool isFinal {false};
+  Step afterCheck {Step::FINISH};
+  bool isPassed {false};
+  std::list<RBAConstraintImpl*> falseConstraints;
+  // 再調停アロケータブルと、次に再調停するアロケータブル
+  std::list<const RBAAllocatable*> revisitAllocatables;
+  std::list<const RBAAllocatable*>::const_iterator revisitAllocatable;
+  // 再調停失敗時のロールバック情報
+  std::shared_ptr<RBARollbacker> rollbacker;
+};
+
+/**
+ * アロケータブルを調停する
+ * 影響を与えたアロケータブルと、制約を満たすための再調停も行う
  * @param allocatable 調停したいアロケータブル
  * @param revisited 再調停済のアロケータブル
- * @param nest 再調停のネスト階層（一番初めの調停は0）
  * @param affectInfo allocatableが影響を与えたアロケータブルの情報
  */
 void RBAArbitratorImpl::arbitrateAllocatable(
-    RBAAllocatable* allocatable,
+    RBAAllocatable* const allocatable,
     std::set<const RBAAllocatable*>& revisited,
-    const std::int32_t nest,
-    RBAAffectInfo* const affectInfo,
-    RBARollbacker* const parentRollbacker)
+    RBAAffectInfo* const affectInfo)
 {
+  // 再調停は再帰呼び出しではなく、スタックに積んだ調停状態の処理で行う。
+  // dequeは末尾への追加と削除で要素を移動しない
+  std::deque<ReArbitrationFrame> frames;
+  frames.emplace_back(allocatable, 0, nullptr);
+  while (!frames.empty()) {
+    stepAllocatable(frames, revisited, affectInfo);
+  }
+}
+
+/**
+ * スタックの先頭の調停状態の処理を一つ進める
+ * 再調停が必要な場合は、再調停するアロケータブルの調停状態をスタックに積む
+ */
+void RBAArbitratorImpl::stepAllocatable(
+    std::deque<ReArbitrationFrame>& frames,
+    std::set<const RBAAllocatable*>& revisited,
+    RBAAffectInfo* const affectInfo)
+{
+  using Step = ReArbitrationFrame::Step;
+  if (!budgetExceeded_) {
+    countArbitrationStep();
+  }
+  ReArbitrationFrame& frame {frames.back()};
+  RBAAllocatable* const allocatable {frame.allocatable};
+  switch (frame.step) {
+  case Step::START:
+  {
 #ifdef RBA_USE_LOG
-  RBALogManager::setIndent(nest);
+    RBALogManager::setIndent(frame.nest);
 #endif
-  // この変数が定義されるまでの再帰処理中に、今回の調停対象アロケータブルが影響を与えたアロケータブル
-  // 再調停前の状態を覚えておく
-  std::set<const RBAAllocatable*> affectAllocatables;
-  affectAllocatables.insert(allocatable->getAllocatablesAffectedByYou().begin(), allocatable->getAllocatablesAffectedByYou().end());
-
-  const RBAContentState* const beforeState {allocatable->getState()};
-
-  // 対象アロケータブルのコンテンツ割当をチェック済とする
-  allocatable->setChecked(true);
-  // 調停ポリシーでソートされたコンテンツ状態を取得(Activeな要求だけが入る)
-  std::list<const RBAContentState*> contentStates;
-  getSortedContentStates(allocatable, contentStates);
-  for(const RBAContentState* const contentState : contentStates) {
+    maxNest_ = std::max(maxNest_, frame.nest);
+    // 再調停前に今回の調停対象アロケータブルが影響を与えたアロケータブルを覚えておく
+    frame.affectAllocatables.insert(allocatable->getAllocatablesAffectedByYou().begin(),
+                                    allocatable->getAllocatablesAffectedByYou().end());
+    frame.beforeState = allocatable->getState();
+    // 対象アロケータブルのコンテンツ割当をチェック済とする
+    allocatable->setChecked(true);
+    // 調停ポリシーでソートされたコンテンツ状態を取得(Activeな要求だけが入る)
+    getSortedContentStates(allocatable, frame.contentStates);
+    frame.contentState = frame.contentStates.cbegin();
+    frame.step = Step::NEXT_CONTENT;
+    break;
+  }
+  case Step::NEXT_CONTENT:
+  {
+    if (frame.contentState == frame.contentStates.cend()) {
+      frame.step = Step::REARBITRATE_AFFECTED;
+      break;
+    }
+    const RBAContentState* const contentState {*frame.contentState};
     // エリアにコンテンツを割り当てる
     allocatable->setState(contentState);
 #ifdef RBA_USE_LOG
@@ -721,121 +1390,163 @@ void RBAArbitratorImpl::arbitrateAllocatable(
       RBALogManager::arbitrateContentLogLine(str);
     }
 #endif
-    bool isSkipped {false};
-    const bool isPassed {checkConstraintAndReArbitrate(
-        allocatable, revisited, nest, affectInfo, parentRollbacker,
-        allocatable->getConstraints(), &isSkipped, false)};
-    if (isPassed == true) {
-
-      // ----------------------------------------------------------
-      // コンテンツ割り当て処理後に制約式によって自アロケータブルが隠蔽されるべきかをチェック
-      // contentValue()があるため、コンテンツ未割り当てでも確認する
-      // ----------------------------------------------------------
+    frame.isSkipped = false;
+    frame.beginCheck(RBAConstraintMap::CONTENT_ALLOCATE_CONSTRAINTS, false,
+                     Step::CONTENT_CHECKED);
+    break;
+  }
+  case Step::CONTENT_CHECKED:
+  {
+    if (frame.isPassed == false) {
+      ++frame.contentState;
+      frame.step = Step::NEXT_CONTENT;
+      break;
+    }
+    // ----------------------------------------------------------
+    // コンテンツ割り当て処理後に制約式によって自アロケータブルが隠蔽されるべきかをチェック
+    // contentValue()があるため、コンテンツ未割り当てでも確認する
+    // ----------------------------------------------------------
+    if (allocatable->isArea() == true) {
+      LOG_arbitrateAreaLogLine(
+          "  check online constraints to confirm area hidden state");
+    } else {
+      LOG_arbitrateAreaLogLine(
+          "  check online constraints to confirm zone muted state");
+    }
+    // 対象アロケータブルのhiddenをチェック済とする
+    allocatable->setHiddenChecked(true);
+    // 対象アロケータブルのhiddenをfalseにする
+    allocatable->setHidden(false);
+    frame.beginCheck(RBAConstraintMap::HIDDEN_FALSE_CHECK_CONSTRAINTS,
+                     !allocatable->isZone(), Step::HIDDEN_FALSE_CHECKED);
+    break;
+  }
+  case Step::HIDDEN_FALSE_CHECKED:
+  {
+    frame.hiddenIsPassed = frame.isPassed;
+    if (frame.hiddenIsPassed == false) {
+      allocatable->setHidden(true);
+      frame.beginCheck(RBAConstraintMap::HIDDEN_TRUE_CHECK_CONSTRAINTS,
+                       !allocatable->isZone(), Step::HIDDEN_TRUE_CHECKED);
+    } else {
+      frame.step = Step::ATTENUATE;
+    }
+    break;
+  }
+  case Step::HIDDEN_TRUE_CHECKED:
+  {
+    frame.hiddenIsPassed = frame.isPassed;
+    if (frame.hiddenIsPassed == false) {
+      // アロケータブルの隠蔽状態をクリアする
+      allocatable->setHiddenChecked(false);
+    } else {
+      LOG_arbitrateAreaLogLine(
+          allocatable->getSymbol() + "[" + allocatable->getElementName()
+          + "] change " + allocatable->getHiddenSymbol());
+    }
+    frame.step = Step::ATTENUATE;
+    break;
+  }
+  case Step::ATTENUATE:
+  {
+    // -------------------------------------
+    // ゾーンは隠蔽(ミュート)後にアッテネートを判定する
+    // -------------------------------------
+    frame.attenuateIsPassed = true;
+    if (allocatable->isZone()) {
+      RBAZoneImpl* const zone {RBAElementCast::staticCast<RBAZoneImpl*>(allocatable)};
+      // 対象ゾーンのアッテネートをチェック済とする
+      zone->setAttenuateChecked(true);
+      // 対象ゾーンのアッテネートをfalseにする
+      zone->setAttenuated(false);
+      LOG_arbitrateAreaLogLine(
+          "  check online constraints to confirm zone attenuated state");
+      frame.beginCheck(RBAConstraintMap::ATTENUATE_FALSE_CHECK_CONSTRAINTS,
+                       true, Step::ATTENUATE_FALSE_CHECKED);
+    } else {
+      frame.step = Step::CONTENT_DONE;
+    }
+    break;
+  }
+  case Step::ATTENUATE_FALSE_CHECKED:
+  {
+    frame.attenuateIsPassed = frame.isPassed;
+    if (frame.attenuateIsPassed == false) {
+      allocatable->setAttenuated(true);
+      frame.beginCheck(RBAConstraintMap::ATTENUATE_TRUE_CHECK_CONSTRAINTS,
+                       true, Step::ATTENUATE_TRUE_CHECKED);
+    } else {
+      frame.step = Step::CONTENT_DONE;
+    }
+    break;
+  }
+  case Step::ATTENUATE_TRUE_CHECKED:
+  {
+    frame.attenuateIsPassed = frame.isPassed;
+    if (frame.attenuateIsPassed == false) {
+      allocatable->setAttenuateChecked(false);
+    } else {
+      LOG_arbitrateAreaLogLine(
+          allocatable->getSymbol() + "[" + allocatable->getElementName()
+          + "] change attenuated");
+    }
+    frame.step = Step::CONTENT_DONE;
+    break;
+  }
+  case Step::CONTENT_DONE:
+  {
 #ifdef RBA_USE_LOG
-      std::string alloSymbol = allocatable->getSymbol();
-      std::string alloName = allocatable->getElementName();
+    {
+      std::string str = allocatable->getSymbol() + "["
+          + allocatable->getElementName() + "] ";
       if (allocatable->isArea() == true) {
-        LOG_arbitrateAreaLogLine(
-            "  check online constraints to confirm area hidden state");
+        str += "displays";
       } else {
-        LOG_arbitrateAreaLogLine(
-            "  check online constraints to confirm zone muted state");
+        str += "outputs";
       }
-#endif
-      // 対象アロケータブルのhiddenをチェック済とする
-      allocatable->setHiddenChecked(true);
-      // 対象アロケータブルのhiddenをfalseにする
-      allocatable->setHidden(false);
-      bool hiddenIsPassed {checkConstraintAndReArbitrate(
-          allocatable, revisited, nest, affectInfo, parentRollbacker,
-          allocatable->getHiddenFalseCheckConstraints(), &isSkipped, !allocatable->isZone())};
-      if (hiddenIsPassed == false) {
-        allocatable->setHidden(true);
-        hiddenIsPassed = checkConstraintAndReArbitrate(
-            allocatable, revisited, nest, affectInfo, parentRollbacker,
-            allocatable->getHiddenTrueCheckConstraints(), &isSkipped, !allocatable->isZone());
-        if (hiddenIsPassed == false) {
-          // アロケータブルの隠蔽状態をクリアする
-          allocatable->setHiddenChecked(false);
-        } else {
-          LOG_arbitrateAreaLogLine(
-              alloSymbol + "[" + alloName + "] change "
-                  + allocatable->getHiddenSymbol());
-        }
-      }
-
-      // -------------------------------------
-      // ゾーンは隠蔽(ミュート)後にアッテネートを判定する
-      // -------------------------------------
-      bool attenuateIsPassed {true};
-      if (allocatable->isZone()) {
-        RBAZoneImpl* const zone {dynamic_cast<RBAZoneImpl*>(allocatable)};
-        // 対象ゾーンのアッテネートをチェック済とする
-        zone->setAttenuateChecked(true);
-        // 対象ゾーンのアッテネートをfalseにする
-        zone->setAttenuated(false);
-        LOG_arbitrateAreaLogLine(
-            "  check online constraints to confirm zone attenuated state");
-        attenuateIsPassed = checkConstraintAndReArbitrate(
-            allocatable, revisited, nest, affectInfo, parentRollbacker,
-            allocatable->getAttenuateFalseCheckConstraints(), &isSkipped, true);
-        if (attenuateIsPassed == false) {
-          zone->setAttenuated(true);
-          attenuateIsPassed = checkConstraintAndReArbitrate(
-              allocatable, revisited, nest, affectInfo, parentRollbacker,
-              allocatable->getAttenuateTrueCheckConstraints(), &isSkipped, true);
-          if (attenuateIsPassed == false) {
-            allocatable->setAttenuateChecked(false);
-          } else {
-            LOG_arbitrateAreaLogLine(
-                alloSymbol + "[" + alloName + "] change attenuated");
-          }
-        }
+      str += " Content[";
+      const RBAContentState* state = allocatable->getState();
+      if (state == nullptr) {
+        str += "null";
+      } else {
+        str += state->getOwner()->getElementName() + "::"
+          + state->getElementName();
       }
-#ifdef RBA_USE_LOG
-      {
-        std::string str = alloSymbol + "[" + alloName + "] ";
-        if (allocatable->isArea() == true) {
-          str += "displays";
-        } else {
-          str += "outputs";
-        }
-        str += " Content[";
-        const RBAContentState* state = allocatable->getState();
-        if (state == nullptr) {
-          str += "null";
-        } else {
-          str += state->getOwner()->getElementName() + "::"
-            + state->getElementName();
-        }
-        str += "] " + allocatable->getHiddenSymbol() + "["
-            + RBALogManager::boolToString(allocatable->isHidden()) + "]";
-        if (allocatable->isZone() == true) {
-          str += " attenuated["
-              + RBALogManager::boolToString(allocatable->isAttenuated()) + "]";
-        }
-        str += "\n";
-        LOG_arbitrateAreaLogLine(str);
+      str += "] " + allocatable->getHiddenSymbol() + "["
+          + RBALogManager::boolToString(allocatable->isHidden()) + "]";
+      if (allocatable->isZone() == true) {
+        str += " attenuated["
+            + RBALogManager::boolToString(allocatable->isAttenuated()) + "]";
       }
+      str += "\n";
+      LOG_arbitrateAreaLogLine(str);
+    }
 #endif
-      if ((hiddenIsPassed == true) && (attenuateIsPassed == true)) {
-        break;
-      }
+    if ((frame.hiddenIsPassed == true) && (frame.attenuateIsPassed == true)) {
+      frame.step = Step::REARBITRATE_AFFECTED;
+    } else {
+      ++frame.contentState;
+      frame.step = Step::NEXT_CONTENT;
     }
+    break;
   }
-  // ---------------------------------------------------------------------
-  // 影響を与えたアロケータブルを再調停
-  // ---------------------------------------------------------------------
-  if ((beforeState != allocatable->getState())
-          || allocatable->isHidden()
-          || allocatable->isAttenuated()) {
-
+  case Step::REARBITRATE_AFFECTED:
+  {
+    // ---------------------------------------------------------------------
+    // 影響を与えたアロケータブルを再調停
+    // ---------------------------------------------------------------------
+    frame.step = Step::FINISH;
+    if ((frame.beforeState == allocatable->getState())
+        && !allocatable->isHidden()
+        && !allocatable->isAttenuated()) {
+      break;
+    }
     // コンテント割当時には隠蔽ではない状態で再調停しているので、
     // 隠蔽、アッテネート状態になった場合、コンテント割り当て時の再調停で影響を与えたアロケータブルも再調停が必要
     // 影響を与えたエリアが増えた分を更新する
     if (allocatable->isHidden() || allocatable->isAttenuated()) {
       for (const auto& a : allocatable->getAllocatablesAffectedByYou()) {
-        static_cast<void>(affectAllocatables.insert(a));
+        static_cast<void>(frame.affectAllocatables.insert(a));
       }
     }
 
@@ -844,64 +1555,190 @@ void RBAArbitratorImpl::arbitrateAllocatable(
     // また、影響エリア/ゾーンがその時点で、未調停アロケータブルだった場合も、
     // 通常手番の調停時に調停すればよいため、影響エリアの再調停対象から除外する。
     for (const auto& a : revisited) {
-      if (affectAllocatables.find(a) != affectAllocatables.end()
+      if (frame.affectAllocatables.find(a) != frame.affectAllocatables.end()
           || (!a->isChecked())) {
-        static_cast<void>(affectAllocatables.erase(a));
+        static_cast<void>(frame.affectAllocatables.erase(a));
       }
     }
-    std::list<const RBAAllocatable*> sortedAllocatables(affectAllocatables.begin(),affectAllocatables.end());
-    sortedAllocatables.sort(&RBAAllocatable::compareIndex);
-    if (parentRollbacker != nullptr) {
+    frame.sortedAllocatables.assign(frame.affectAllocatables.begin(),
+                                    frame.affectAllocatables.end());
+    frame.sortedAllocatables.sort(&RBAAllocatable::compareIndex);
+    // 再調停の上限に達した場合は、影響アロケータブルを再調停しない
+    if (!frame.sortedAllocatables.empty()
+        && !canReArbitrate(frame.nest, frame.sortedAllocatables.size())) {
+      frame.sortedAllocatables.clear();
+    }
+    if (frame.parentRollbacker != nullptr) {
       std::shared_ptr<RBARollbacker> rollbacker {std::make_shared<RBARollbacker>()};
-      parentRollbacker->addChild(rollbacker);
-      rollbacker->backup(sortedAllocatables);
+      frame.parentRollbacker->addChild(rollbacker);
+      rollbacker->backup(frame.sortedAllocatables);
     }
 
-    for (auto& affect : sortedAllocatables) {
+    for (auto& affect : frame.sortedAllocatables) {
       // これから再調停するアロケータブルを、調停中アロケータブルの影響を与えたアロケータブルから削除
       allocatable->removeAffectAllocatable(affect);
     }
     static_cast<void>(revisited.insert(allocatable)); // 調停済みエリアに追加する
-    for (auto& affectAllocatable : sortedAllocatables) {
-      // @Deviation (EXP55-CPP,Rule-5_2_5,A5-2-3)
-      // 【ルールに逸脱している内容】
-      // This is a 'const_cast' expression that strips away a 'const' or 'volatile' qualifier.
-      // 【ルールを逸脱しても問題ないことの説明】
-      // 設計書上、問題無いことを確認出来ており、改修にはクラス設計の見直しが必要なため、今は修正しない。
-      RBAAllocatable* allo {const_cast<RBAAllocatable*>(affectAllocatable)};
-
-      // これから影響アロケータブルの再調停を実施するアロケータブルのチェックフラグを初期化
-      // 影響アロケータブルを事前にまとめてクリアすると、
-      // 先に実施した影響アロケータブルの再調停中の制約式評価でスキップが発生し、
-      // その後実施した影響アロケータブルの再調停中に、再調停が動いてしまうため、
-      // 影響アロケータブルの再調停前に個別にクリアする
-      allo->clearChecked();
-
+    frame.affectAllocatable = frame.sortedAllocatables.cbegin();
+    frame.step = Step::NEXT_AFFECTED;
+    break;
+  }
+  case Step::NEXT_AFFECTED:
+  {
+    if (frame.affectAllocatable == frame.sortedAllocatables.cend()) {
+      for(const RBAAllocatable* const revisitAllocatable : frame.sortedAllocatables) {
+        static_cast<void>(revisited.erase(revisitAllocatable));
+      }
+      frame.step = Step::FINISH;
+      break;
+    }
+    const RBAAllocatable* const affectAllocatable {*frame.affectAllocatable};
+    ++frame.affectAllocatable;
+    // @Deviation (EXP55-CPP,Rule-5_2_5,A5-2-3)
+    // 【ルールに逸脱している内容】
+    // This is a 'const_cast' expression that strips away a 'const' or 'volatile' qualifier.
+    // 【ルールを逸脱しても問題ないことの説明】
+    // 設計書上、問題無いことを確認出来ており、改修にはクラス設計の見直しが必要なため、今は修正しない。
+    RBAAllocatable* allo {const_cast<RBAAllocatable*>(affectAllocatable)};
+
+    // これから影響アロケータブルの再調停を実施するアロケータブルのチェックフラグを初期化
+    // 影響アロケータブルを事前にまとめてクリアすると、
+    // 先に実施した影響アロケータブルの再調停中の制約式評価でスキップが発生し、
+    // その後実施した影響アロケータブルの再調停中に、再調停が動いてしまうため、
+    // 影響アロケータブルの再調停前に個別にクリアする
+    allo->clearChecked();
+
+    LOG_arbitrateAreaLogLine( "    " +
+        affectAllocatable->getSymbol() + "["
+                              + affectAllocatable->getElementName()
+                              + "] affect allocatable check start");
+    // 影響アロケータブルの再調停が終わると、このフレームの次の影響アロケータブルに戻る
+    frames.emplace_back(allo, frame.nest + 1,
+                        frame.parentRollbacker);
+    break;
+  }
+  case Step::FINISH:
+  {
+    // --------------------------------------------------
+    // 再調停の中での無限ループ防止用の一時的な影響情報を削除する
+    // --------------------------------------------------
+    affectInfo->removeAffectInfo(allocatable);
+#ifdef RBA_USE_LOG
+    RBALogManager::setIndent(frame.nest-1);
+#endif
+    frames.pop_back();
+    break;
+  }
+  case Step::CHECK:
+  {
+    frame.isPassed = false;
+    frame.falseConstraints.clear();
+    const bool containsSkip {checkConstraints(frame.constraints,
+                                              frame.falseConstraints,
+                                              allocatable)};
+    frame.step = frame.afterCheck;
+    if(frame.falseConstraints.empty()) {
+      frame.isSkipped = (frame.isSkipped || containsSkip);
+      if(!containsSkip && !frame.isSkipped && frame.isFinal) {
+        static_cast<void>(revisited.insert(allocatable));
+      }
+      frame.isPassed = true;
+      break;
+    }
+    frame.revisitAllocatables.clear();
+    RBAAllocatable* revisitOrigin {allocatable};
+    collectRevisitAllocatable(&frame.revisitAllocatables, revisitOrigin,
+                              frame.falseConstraints, revisited);
+    // 再調停の上限に達した場合は、再調停せずに制約を満たさないものとする
+    if (frame.revisitAllocatables.empty()
+        || !canReArbitrate(frame.nest, frame.revisitAllocatables.size())) {
+      recordAffectedAllocatables(allocatable, frame.falseConstraints, affectInfo);
+      break;
+    }
+    // 再調停アロケータブルが存在する
+    // 再調停失敗時のロールバック向けバックアップ情報を生成
+    // 処理速度を考え、再調停が初めて必要になった場合にのみ1回だけインスタンスを生成
+    // コンテント割り当て後にバックアップしているので、ロールバック後は割り当てたコンテントをNULLに戻す必要有り
+    frame.rollbacker = std::make_shared<RBARollbacker>();
+    if (frame.parentRollbacker != nullptr) {
+      frame.parentRollbacker->addChild(frame.rollbacker);
+    }
+    frame.rollbacker->backup(frame.revisitAllocatables);
+    // 先に再調停するアロケータブルを全て初期化
+    for (auto& a : frame.revisitAllocatables) {
+      const_cast<RBAAllocatable*>(a)->clearChecked();
+    }
+    // --------------------------------------------------
+    // 再調停候補リストから、再帰内で再調停済でないアロケータブルを再調停する
+    // --------------------------------------------------
+    static_cast<void>(revisited.insert(allocatable));
+    frame.revisitAllocatable = frame.revisitAllocatables.cbegin();
+    frame.step = Step::NEXT_REVISIT;
+    break;
+  }
+  case Step::NEXT_REVISIT:
+  {
+    if (frame.revisitAllocatable != frame.revisitAllocatables.cend()) {
+      const RBAAllocatable* const revisitAllocatable {*frame.revisitAllocatable};
+      ++frame.revisitAllocatable;
       LOG_arbitrateAreaLogLine( "    " +
-          affectAllocatable->getSymbol() + "["
-                                + affectAllocatable->getElementName()
-                                + "] affect allocatable check start");
-      // @Deviation (MEM05-CPP,Rule-7_5_4,A7-5-2)
-      // 【ルールに逸脱している内容】
-      // arbitrateAllocatable()を再帰呼び出ししている
-      // 【ルールを逸脱しても問題ないことの説明】
-      // 影響エリアの再調停に必要な処理であり、無限ループ防止処理を入れているため、
-      // スタックオーバーフローすることはなく、問題無い。
-      arbitrateAllocatable(allo, revisited, nest + 1, affectInfo,
-                           parentRollbacker);
-    }
-    for(const RBAAllocatable* const revisitAllocatable : sortedAllocatables) {
+          revisitAllocatable->getSymbol() + "["
+                                + revisitAllocatable->getElementName()
+                                + "] revisit allocatable check start");
+      // 再調停アロケータブルの調停が終わると、このフレームの次の再調停アロケータブルに戻る
+      frames.emplace_back(
+          const_cast<RBAAllocatable*>(revisitAllocatable), frame.nest + 1,
+          frame.rollbacker.get());
+      break;
+    }
+    for(const RBAAllocatable* const revisitAllocatable : frame.revisitAllocatables) {
       static_cast<void>(revisited.erase(revisitAllocatable));
     }
+    // --------------------------------------------------
+    // 再調停によりコンテントの割り当てが成功するようになったかを確認する
+    // --------------------------------------------------
+    frame.falseConstraints.clear();
+    static_cast<void>(checkConstraints(frame.constraints, frame.falseConstraints,
+                                       allocatable));
+    if (frame.falseConstraints.empty()) {
+      // 再調停によってアロケータブルの割当コンテンツが確定したので、
+      // ループを抜けて次のアロケータブルへ
+      // 再帰によって自アロケータブルの再調停がされて割当コンテンツがなくなるケースも
+      // あるが、全コンテンツチェックが済のため次のアロケータブルへ
+      frame.isPassed = true;
+    } else {
+      frame.rollbacker->rollback(); // 調停状態と影響情報をロールバックする
+      if (frame.parentRollbacker != nullptr) {
+        frame.parentRollbacker->removeChild(frame.rollbacker);
+      }
+      recordAffectedAllocatables(allocatable, frame.falseConstraints, affectInfo);
+    }
+    frame.rollbacker.reset();
+    frame.step = frame.afterCheck;
+    break;
+  }
+  default:
+    break;
   }
+}
 
-  // --------------------------------------------------
-  // 再調停の中での無限ループ防止用の一時的な影響情報を削除する
-  // --------------------------------------------------
-  affectInfo->removeAffectInfo(allocatable);
-#ifdef RBA_USE_LOG
-  RBALogManager::setIndent(nest-1);
-#endif
+/**
+ * 再調停の上限を超えないか判定し、超えない場合は再調停の回数に加える
+ * @param nest 再調停元のネスト階層
+ * @param count 再調停するアロケータブルの数
+ * @return 再調停できる場合はtrue
+ */
+bool RBAArbitratorImpl::canReArbitrate(const std::int32_t nest,
+                                       const std::size_t count)
+{
+  if (budgetExceeded_
+      || ((nestLimit_ > 0) && (nest >= nestLimit_))
+      || ((revisitLimit_ > 0U) && ((reArbitrationCount_ + count) > revisitLimit_))) {
+    LOG_arbitrateAreaLogLine("    re-arbitration limit reached");
+    return false;
+  }
+  reArbitrationCount_ += count;
+  return true;
 }
 
 /**
@@ -958,10 +1795,15 @@ collectRevisitAllocatable(std::list<const RBAAllocatable*>* const totalRevisitAl
   for(RBAConstraintImpl*& constraint : falseConstraints) {
     // 制約情報取得
     const RBAConstraintInfo* const info {constraint->getInfo()};
+    // 制約情報に調停中以外のアロケータブルが入らない制約は再調停候補を持たない
+    if (!constraint->mayAffectOtherThan(allocatable)) {
+      continue;
+    }
     // 再調停候補のアロケータブル
     std::set<const RBAAllocatable*> rightFalseAllocatables;
 
-    if (info->needsRearbitrationFor(allocatable)) {
+    if (constraint->mayAffect(allocatable)
+        && info->needsRearbitrationFor(allocatable)) {
       info->collectRearbitrationTargetFor(allocatable, rightFalseAllocatables, false);
     }
     if (rightFalseAllocatables.empty()) {
@@ -970,6 +1812,9 @@ collectRevisitAllocatable(std::list<const RBAAllocatable*>* const totalRevisitAl
       // "再調停候補のアロケータブル"に"低優先度のアロケータブル"が含まれている場合は"低優先度のアロケータブル"を再調停する。
       // 調停は優先度順に行われるので、"低優先度のアロケータブル"が"再調停候補のアロケータブル"に含まれることは通常ないが、
       // "低優先度のアロケータブル"が調停された後の"現在調停中のアロケータブル"の再調停で含まれる。
+      if (!constraint->mayAffectLowerThan(allocatable)) {
+        continue;
+      }
       info->collectFalseAllocatables(rightFalseAllocatables);
       bool isContainsLowPriorityAllocatable {false};
       for(const RBAAllocatable* const rightFalseAllocatable
@@ -1020,7 +1865,7 @@ postArbitrate()
 #ifdef RBA_USE_LOG
   RBALogManager::cancelRequestLogLine("----Cancel Request----");
 #endif
-  for(const RBAContentState* const state : model_->getContentStates()) {
+  for(const RBAContentState* const state : model_->getContentStateTable()) {
 #ifdef RBA_USE_LOG
     RBALogManager::cancelRequestLogLine("Content["+
 			     state->getOwner()->getElementName()+"::"+
@@ -1078,7 +1923,7 @@ void
 RBAArbitratorImpl::
 changeContentStateCancelWithPolicy(const RBAContentState* const state)
 {
-  switch(dynamic_cast<RBAContent*>(state->getOwner())->getContentLoserType()) {
+  switch(state->getOwner()->toContent()->getContentLoserType()) {
   case RBAContentLoserType::GOOD_LOSER:
 #ifdef RBA_USE_LOG
      RBALogManager::cancelRequestLogLine("  Content["+
@@ -1099,7 +1944,7 @@ changeContentStateCancelWithPolicy(const RBAContentState* const state)
     break;
   case RBAContentLoserType::DO_NOT_GIVEUP_UNTIL_WIN:
     if(state->isModelElementType(RBAModelElementType::ViewContentState)) {
-      if(result_->isPreVisible(dynamic_cast<const RBAViewContentStateImpl*>(state))) {
+      if(result_->isPreVisible(RBAElementCast::staticCast<const RBAViewContentStateImpl*>(state))) {
 #ifdef RBA_USE_LOG
         RBALogManager::cancelRequestLogLine("  Content["+
                                  state->getOwner()->getElementName()+"::"+
@@ -1118,7 +1963,7 @@ changeContentStateCancelWithPolicy(const RBAContentState* const state)
       }
     }
     else {
-      if(result_->isPreSounding(dynamic_cast<const RBASoundContentStateImpl*>(state))) {
+      if(result_->isPreSounding(RBAElementCast::staticCast<const RBASoundContentStateImpl*>(state))) {
         setCancel(state, true);
       } else {
         setCancel(state, false);
@@ -1166,8 +2011,8 @@ isDefeat(const RBAContentState* const winner, const RBAContentState* const loser
 {
   bool loserVisible {false}; // 負けコンテンツの表示有無
   bool winnerVisible {false}; // 勝ちコンテンツの表示有無
-  const RBAContent* const loserContent {dynamic_cast<RBAContent*>(loser->getOwner())};
-  const RBAContent* const winnerContent {dynamic_cast<RBAContent*>(winner->getOwner())};
+  const RBAContent* const loserContent {loser->getOwner()->toContent()};
+  const RBAContent* const winnerContent {winner->getOwner()->toContent()};
 
   // --------------------------------------------------------------------
   // 判定の優先順位
@@ -1175,7 +2020,7 @@ isDefeat(const RBAContentState* const winner, const RBAContentState* const loser
   // winnerが全エリア調停済にも関わらず表示されていないならfalse
   // loserが表示されておらず全エリアが調停済で、winnerが表示されているならtrue
   // --------------------------------------------------------------------
-  for(const RBAAllocatable* const allocatable : loserContent->getAllocatables()) {
+  for(const RBAAllocatable* const allocatable : loserContent->getAllocatableArray()) {
     // エリアが隠蔽されている
     if(allocatable->isHiddenChecked() && allocatable->isHidden()) {
       continue;
@@ -1187,7 +2032,7 @@ isDefeat(const RBAContentState* const winner, const RBAContentState* const loser
       break;
     }
   }
-  for(const RBAAllocatable* const allocatable	: winnerContent->getAllocatables()) {
+  for(const RBAAllocatable* const allocatable : winnerContent->getAllocatableArray()) {
     // エリアが隠蔽されている
     if(allocatable->isHiddenChecked() && allocatable->isHidden()) {
       continue;
@@ -1243,7 +2088,7 @@ updateResult()
   // エリアの座標を更新する
   for(auto& area : result_->getVisibleAreas()) {
     const RBAAreaImpl* const areaImpl {dynamic_cast<const RBAAreaImpl*>(area)};
-    const auto posCont = model_->findPositionContainerImpl(area->getName());
+    const auto posCont = areaImpl->getPositionContainer();
     const auto sizeObj = result_->getSize(area);
     if((posCont != nullptr) && (sizeObj != nullptr)) {
       const auto offset = posCont->getOffset(sizeObj->getName());
@@ -1266,7 +2111,7 @@ updateResult()
     // 表示要求で割り当てられたエリアが表示されていなければStanbyContentに設定
     const auto allocs = result_->getAllocatable(state);
     if(allocs.empty()) {
-      result_->addStandbyContent(dynamic_cast<RBAContent*>(state->getOwner()));
+      result_->addStandbyContent(state->getOwner()->toContent());
     }
   }
 }
@@ -1413,7 +2258,7 @@ RBAArbitratorImpl::differenceArbitrate()
   logRequestForCoverage();
 #endif
 
-  for (auto& a : model_->getSortedAllocatables()) {
+  for (RBAAllocatable* const a : model_->getAllocatableTable()) {
     a->clearStatus();
   }
 
@@ -1424,7 +2269,7 @@ RBAArbitratorImpl::differenceArbitrate()
 #ifdef RBA_USE_LOG
 RBALogManager::setType(RBALogManager::TYPE_ARBITRATE);
 #endif
-  arbitrate(model_->getSortedAllocatables());
+  arbitrate(model_->getAllocatableTable());
 
   // ----------------------------------------------------------
   // 調停後処理
@@ -1435,8 +2280,8 @@ RBALogManager::setType(RBALogManager::TYPE_CANCEL_REQUEST);
   // satisfiesConstraints()で制約式評価を行うとき、キャンセル状態がexecute()時と異なっていると、
   // 結果がfalseになる可能性があるため、キャンセル処理前の状態を保存しておく。
   // satisfiesConstraints()で制約式評価を行うときに、この値に戻して評価する。
-  resultSetForSatisfiesConstraints_ = std::make_unique<RBAResultSet>(
-      *result_->getCurResultSet());
+  resultSetPool_->release(std::move(resultSetForSatisfiesConstraints_));
+  resultSetForSatisfiesConstraints_ = resultSetPool_->copy(*result_->getCurResultSet());
   postArbitrate();
 
   // オフライン制約を動かす
@@ -1462,120 +2307,179 @@ RBALogManager::setType(RBALogManager::TYPE_CHECK_ALL_CONSTRAINTS);
 
 bool
 RBAArbitratorImpl::
-checkConstraints( std::list<RBAConstraintImpl*>& constraints,
+checkConstraints(const RBAElementArray<RBAConstraintImpl*>& constraints,
                   std::list<RBAConstraintImpl*>& falseConstraints,
                   const RBAAllocatable* const allocatable)
 {
   bool containsSkip {false};
+  // 同じ構造の式は制約をまたいで一度だけ評価する
+  expressionCache_.begin(model_->getSharedExpressionCount());
+  bool shortCircuit {adaptiveOrder_};
+  bool constraintCache {constraintCache_};
+#ifdef RBA_USE_LOG
+  // ログには全ての式の評価を出力する
+  if (RBALogManager::getLogManager() != nullptr) {
+    shortCircuit = false;
+    constraintCache = false;
+  }
+#endif
+  inputRecorder_.clear();
   for (const auto& constraint : constraints) {
-    const bool isPassed {constraint->execute(this)};
+    bool isPassed {false};
+    if (constraintCache
+        && constraint->findCachedResult(result_.get(), isPassed)) {
+      // 読み込んだ調停状態が変わっていないので、前回の結果と制約情報を使う
+    } else if (shortCircuit && constraint->usesShortCircuit()) {
+      // 成立すれば制約情報は参照されないので、短絡評価の結果を使う。
+      // 不成立とスキップの場合は、再調停のために全ての式を評価し直す。
+      shortCircuit_ = true;
+      isPassed = executeConstraint(constraint, constraintCache);
+      shortCircuit_ = false;
+      const bool decided {isPassed
+                          && !constraint->getInfo()->isExceptionBeforeArbitrate()};
+      constraint->addShortCircuitResult(decided);
+      if (!decided) {
+        isPassed = executeConstraint(constraint, constraintCache);
+      }
+    } else {
+      isPassed = executeConstraint(constraint, constraintCache);
+    }
     if (isPassed == false) {
       falseConstraints.push_back(constraint);
     }
-    if (constraint->getInfo()->isExceptionBeforeArbitrate()) {
+    if (constraint->getInfo()->isExceptionBeforeArbitrate()
+        && constraint->mayAffect(allocatable)) {
       if (constraint->getInfo()->needsReRearbitrationFor(allocatable)) {
         containsSkip = true;
       }
     }
   }
+  expressionCache_.end();
   return containsSkip;
 }
 
+/**
+ * 制約を評価する
+ * recordがtrueの場合は、評価中に読み込んだ調停状態を記録し、
+ * 結果とともに制約に保持する
+ */
 bool
 RBAArbitratorImpl::
-checkConstraintAndReArbitrate(RBAAllocatable* allocatable,
-                              std::set<const RBAAllocatable*>& revisited,
-                              const std::int32_t nest,
-                              RBAAffectInfo* const affectInfo,
-                              RBARollbacker* const parentRollbacker,
-                              std::list<RBAConstraintImpl*>& constraints,
-                              bool * const isSkipped,
-                              const bool isFinal)
+executeConstraint(RBAConstraintImpl* const constraint, const bool record)
 {
-  bool isPassed {false};
-  std::list<RBAConstraintImpl*> falseConstraints;
-  const bool containsSkip {checkConstraints(constraints, falseConstraints, allocatable)};
-  if(falseConstraints.empty()) {
-    *isSkipped = (*isSkipped || containsSkip);
-    if(!containsSkip && !*isSkipped && isFinal) {
-      static_cast<void>(revisited.insert(allocatable));
-    }
-    isPassed = true;
+  if (!record) {
+    return constraint->execute(this);
+  }
+  const std::size_t inputsBegin {inputRecorder_.getPosition()};
+  inputRecorder_.start();
+  const bool isPassed {constraint->execute(this)};
+  inputRecorder_.stop();
+  // 短絡評価の制約情報は不完全なので保持しない
+  if (!shortCircuit_) {
+    constraint->storeResult(inputRecorder_, inputsBegin, isPassed);
+  }
+  return isPassed;
+}
+
+/**
+ * 調停の手順を数え、調停の上限を超えたか判定する
+ * 時刻の取得は手順ごとに行うと重いので、一定の手順ごとに行う
+ */
+void
+RBAArbitratorImpl::countArbitrationStep()
+{
+  ++arbitrationSteps_;
+  if ((stepBudget_ > 0U) && (arbitrationSteps_ > stepBudget_)) {
+    budgetExceeded_ = true;
+  } else if ((timeBudget_.count() > 0)
+             && ((arbitrationSteps_ % DEADLINE_CHECK_INTERVAL) == 0U)
+             && (std::chrono::steady_clock::now() >= deadline_)) {
+    budgetExceeded_ = true;
   } else {
-    std::list<const RBAAllocatable*> revisitAllocatables;
-    collectRevisitAllocatable(&revisitAllocatables, allocatable, falseConstraints, revisited);
-    if(!(revisitAllocatables.empty())) {
-      // 再調停アロケータブルが存在する
-      // 再調停失敗時のロールバック向けバックアップ情報を生成
-      // 処理速度を考え、再調停が初めて必要になった場合にのみ1回だけインスタンスを生成
-       // コンテント割り当て後にバックアップしているので、ロールバック後は割り当てたコンテントをNULLに戻す必要有り
-      std::shared_ptr<RBARollbacker> rollbacker {std::make_shared<RBARollbacker>()}; // 再調停失敗時のロールバック情報
-      if (parentRollbacker != nullptr) {
-        parentRollbacker->addChild(rollbacker);
-      }
-      rollbacker->backup(revisitAllocatables);
-      // 先に再調停するアロケータブルを全て初期化
-      for (auto& a : revisitAllocatables) {
-        const_cast<RBAAllocatable*>(a)->clearChecked();
-      }
-      // --------------------------------------------------
-      // 再調停候補リストから、再帰内で再調停済でないアロケータブルを再調停する
-      // --------------------------------------------------
-      static_cast<void>(revisited.insert(allocatable));
-      for(const RBAAllocatable* const revisitAllocatable : revisitAllocatables) {
-        LOG_arbitrateAreaLogLine( "    " +
-            revisitAllocatable->getSymbol() + "["
-                                  + revisitAllocatable->getElementName()
-                                  + "] revisit allocatable check start");
-        arbitrateAllocatable(const_cast<RBAAllocatable*>(revisitAllocatable),
-			     revisited, nest + 1, affectInfo, rollbacker.get());
-      }
-      for(const RBAAllocatable* const revisitAllocatable : revisitAllocatables) {
-        static_cast<void>(revisited.erase(revisitAllocatable));
-      }
-      // --------------------------------------------------
-      // 再調停によりコンテントの割り当てが成功するようになったかを確認する
-      // --------------------------------------------------
-      falseConstraints.clear();
-      static_cast<void>(checkConstraints(constraints, falseConstraints, allocatable));
-      if (falseConstraints.empty()) {
-        // 再調停によってアロケータブルの割当コンテンツが確定したので、
-         // ループを抜けて次のアロケータブルへ
-        // 再帰によって自アロケータブルの再調停がされて割当コンテンツがなくなるケースも
-         // あるが、全コンテンツチェックが済のため次のアロケータブルへ
-        isPassed = true;
-      } else {
-        rollbacker->rollback(); // 調停状態と影響情報をロールバックする
-        if (parentRollbacker != nullptr) {
-          parentRollbacker->removeChild(rollbacker);
-        }
-      }
+    // 上限を超えていない
+  }
+  if (budgetExceeded_) {
+    LOG_arbitrateAreaLogLine("    arbitration budget exceeded");
+  }
+}
+
+/**
+ * 調停しないアロケータブルに前回の調停結果を設定する
+ * 要求が取り下げられたコンテンツ状態は割り当てない
+ */
+void
+RBAArbitratorImpl::keepPreviousResult(RBAAllocatable* const allocatable) const
+{
+  const RBAContentState* state {result_->getDirectPreContentState(allocatable)};
+  if ((state != nullptr) && !result_->isActive(state)) {
+    state = nullptr;
+  }
+  allocatable->setState(state);
+  allocatable->setChecked(true);
+  allocatable->setHiddenChecked(true);
+  allocatable->setHidden(result_->isPreHidden(allocatable));
+  if (allocatable->isZone()) {
+    const RBAZoneImpl* const zone {RBAElementCast::staticCast<RBAZoneImpl*>(allocatable)};
+    allocatable->setAttenuateChecked(true);
+    allocatable->setAttenuated(result_->isPreAttenuated(zone));
+  }
+}
+
+/**
+ * 制約を満たさなかったアロケータブルに影響を与えたアロケータブルを記録する
+ */
+void
+RBAArbitratorImpl::
+recordAffectedAllocatables(RBAAllocatable* const allocatable,
+                           const std::list<RBAConstraintImpl*>& falseConstraints,
+                           RBAAffectInfo* const affectInfo)
+{
+  //調停中のエリアに影響を与えたエリアを収集する
+  std::set<const RBAAllocatable*> allocatablesWhichHaveAffectedToThisAllocatable;
+
+  for (const RBAConstraintImpl* const constraint : falseConstraints) {
+    if (!needsAffectedAllocatables(constraint, allocatable, affectInfo)) {
+      continue;
     }
+    constraint->getInfo()->collectAffectedAllocatables(
+        false, allocatablesWhichHaveAffectedToThisAllocatable, false,
+        false);
   }
-  if (isPassed == false) {
-    //調停中のエリアに影響を与えたエリアを収集する
-    std::set<const RBAAllocatable*> allocatablesWhichHaveAffectedToThisAllocatable;
+  static_cast<void>(allocatablesWhichHaveAffectedToThisAllocatable.erase(allocatable));
 
-    for (const RBAConstraintImpl* const constraint : falseConstraints) {
-      constraint->getInfo()->collectAffectedAllocatables(
-          false, allocatablesWhichHaveAffectedToThisAllocatable, false,
-          false);
+  //調停中のエリアが影響を受けたエリアを記録する
+  //逆に言えば、調停中のエリアに影響を与えたエリアに、調停中のエリアに影響を与えたことを記録する
+  //AffectInfoには影響を与えたエリアの再調停済みのものを覚えておくので、すでに再調停済みのものは記憶しない
+  for (const RBAAllocatable* const a : allocatablesWhichHaveAffectedToThisAllocatable) {
+    if (!(affectInfo->alreadyKnowsThatFormerHasAffectedToLatter(a,
+                                                                allocatable))) {
+      const_cast<RBAAllocatable*>(a)->addAllocatableWhichHasBeenAffectedByYou(
+          allocatable);
+      affectInfo->addInfoThatFormerAffectedToLatter(a, allocatable);
     }
-    static_cast<void>(allocatablesWhichHaveAffectedToThisAllocatable.erase(allocatable));
+  }
+}
 
-    //調停中のエリアが影響を受けたエリアを記録する
-    //逆に言えば、調停中のエリアに影響を与えたエリアに、調停中のエリアに影響を与えたことを記録する
-    //AffectInfoには影響を与えたエリアの再調停済みのものを覚えておくので、すでに再調停済みのものは記憶しない
-    for (const RBAAllocatable* const a : allocatablesWhichHaveAffectedToThisAllocatable) {
-      if (!(affectInfo->alreadyKnowsThatFormerHasAffectedToLatter(a,
-                                                                  allocatable))) {
-        const_cast<RBAAllocatable*>(a)->addAllocatableWhichHasBeenAffectedByYou(
-            allocatable);
-        affectInfo->addInfoThatFormerAffectedToLatter(a, allocatable);
-      }
+/**
+ * 制約情報から調停中のアロケータブルに影響を与えたアロケータブルを収集する必要があるか判定する
+ * 制約が影響しうるアロケータブルが全て影響情報に記録済であれば、収集しても記録するものはない
+ */
+bool
+RBAArbitratorImpl::
+needsAffectedAllocatables(const RBAConstraintImpl* const constraint,
+                          const RBAAllocatable* const allocatable,
+                          const RBAAffectInfo* const affectInfo) const
+{
+  if (!constraint->hasAffectAllocatables()) {
+    return true;
+  }
+  for (const RBAAllocatable* const a : constraint->getAffectAllocatables()) {
+    if ((a != allocatable)
+        && !affectInfo->alreadyKnowsThatFormerHasAffectedToLatter(a, allocatable)) {
+      return true;
     }
   }
-  return isPassed;
+  return false;
 }
 
 bool
@@ -1691,6 +2595,8 @@ RBAModelImpl* RBAArbitratorImpl::getModel() const
 void RBAArbitratorImpl::setModel(RBAModelImpl* const model)
 {
   model_ = model;
+  // 再利用が有効な場合は結果セットを事前に生成しておく
+  resultSetPool_->reserve(RESERVED_RESULT_SETS);
 }
 
 std::set<const RBAContentState*>& RBAArbitratorImpl::getCancelChecked()
@@ -1755,6 +2661,61 @@ std::deque<std::unique_ptr<RBARequestQueMember>>& RBAArbitratorImpl::getRequestQ
   return requestQue_;
 }
 
+RBAExpressionCache& RBAArbitratorImpl::getExpressionCache()
+{
+  return expressionCache_;
+}
+
+bool RBAArbitratorImpl::isShortCircuit() const
+{
+  return shortCircuit_;
+}
+
+void RBAArbitratorImpl::setAdaptiveOrder(const bool adaptive)
+{
+  adaptiveOrder_ = adaptive;
+}
+
+bool RBAArbitratorImpl::isAdaptiveOrder() const
+{
+  return adaptiveOrder_;
+}
+
+void RBAArbitratorImpl::setConstraintCache(const bool constraintCache)
+{
+  constraintCache_ = constraintCache;
+}
+
+bool RBAArbitratorImpl::isConstraintCache() const
+{
+  return constraintCache_;
+}
+
+void RBAArbitratorImpl::setObjectPool(const bool pool)
+{
+  resultSetPool_->setEnabled(pool);
+  resultSetPool_->reserve(RESERVED_RESULT_SETS);
+}
+
+const std::shared_ptr<RBAResultSetPool>& RBAArbitratorImpl::getResultSetPool() const
+{
+  return resultSetPool_;
+}
+
+void RBAArbitratorImpl::setReArbitrationLimit(const std::int32_t maxNest,
+                                              const std::int32_t maxCount)
+{
+  nestLimit_ = std::max(maxNest, 0);
+  revisitLimit_ = static_cast<std::size_t>(std::max(maxCount, 0));
+}
+
+void RBAArbitratorImpl::setArbitrationBudget(const std::int32_t maxMicroseconds,
+                                             const std::int32_t maxSteps)
+{
+  timeBudget_ = std::chrono::microseconds{std::max(maxMicroseconds, 0)};
+  stepBudget_ = static_cast<std::uint32_t>(std::max(maxSteps, 0));
+}
+
 #ifdef RBA_USE_LOG
 /**
  * ログビュー向けにリクエスト情報を出力する
@@ -1762,6 +2723,10 @@ std::deque<std::unique_ptr<RBARequestQueMember>>& RBAArbitratorImpl::getRequestQ
 void
 RBAArbitratorImpl::logRequestArbitration()
 {
+  if (RBALogManager::getLogManager() == nullptr) {
+    // ログマネージャが設定されていない場合は文字列を生成しない
+    return;
+  }
   const std::list<const RBAAllocatable*> allocatables =
       model_->getAllocatables();
   RBALogManager::requestLogLine("----Request Information----");
@@ -1790,7 +2755,7 @@ RBAArbitratorImpl::logRequestArbitration()
               dynamic_cast<const RBASoundContentState*>(contentState)));
     }
     RBALogManager::requestLogLine(
-        "  " + dynamic_cast<RBAContent*>(contentState->getOwner())->getSymbol() + "["
+        "  " + contentState->getOwner()->toContent()->getSymbol() + "["
             + contentState->getOwner()->getElementName() + "::"
             + contentState->getElementName() + "] priority["
             + contentState->getPriorityString() + "] isActive[" + active
@@ -1825,6 +2790,10 @@ RBAArbitratorImpl::logRequestArbitration()
 void
 RBAArbitratorImpl::logPreResultArbitration()
 {
+  if (RBALogManager::getLogManager() == nullptr) {
+    // ログマネージャが設定されていない場合は文字列を生成しない
+    return;
+  }
   RBALogManager::resultLogLine("----Previous Result Information----");
 
   auto allocs = model_->getAllocatables();
@@ -1892,6 +2861,10 @@ RBAArbitratorImpl::logPreResultArbitration()
 void
 RBAArbitratorImpl::logResultArbitration()
 {
+  if (RBALogManager::getLogManager() == nullptr) {
+    // ログマネージャが設定されていない場合は文字列を生成しない
+    return;
+  }
   RBALogManager::resultLogLine("----Result Information----");
 
   const std::list<const RBAAllocatable*> allocatables
@@ -1965,6 +2938,10 @@ RBAArbitratorImpl::logResultArbitration()
 void
 RBAArbitratorImpl::logRequestForCoverage()
 {
+  if (RBALogManager::getLogManager() == nullptr) {
+    // ログマネージャが設定されていない場合は文字列を生成しない
+    return;
+  }
   for(const RBAContentState* contentState : model_->getContentStates()) {
     std::ostringstream oss;
     oss << "C,";
@@ -2006,6 +2983,10 @@ RBAArbitratorImpl::logRequestForCoverage()
 void
 RBAArbitratorImpl::logResultForCoverage()
 {
+  if (RBALogManager::getLogManager() == nullptr) {
+    // ログマネージャが設定されていない場合は文字列を生成しない
+    return;
+  }
   for(const RBAAllocatable* allocatable : model_->getAllocatables()) {
     std::ostringstream oss;
     oss << "A,";
@@ -2021,6 +3002,10 @@ RBAArbitratorImpl::logResultForCoverage()
 void
 RBAArbitratorImpl::setLogToResult()
 {
+  if (RBALogManager::getLogManager() == nullptr) {
+    // ログマネージャが設定されていない場合は文字列を生成しない
+    return;
+  }
   std::ostringstream oss;
   oss << RBALogManager::getAllConstraintLog();
   oss << RBALogManager::getRequestLog();
@@ -5,16 +5,22 @@
 #ifndef RBAARBITORATORIMPL_HPP
 #define RBAARBITORATORIMPL_HPP
 
+#include <chrono>
 #include <cstdint>
 #include <set>
 #include <memory>
 #include <mutex>
 #include <deque>
 #include <unordered_map>
+#include <vector>
 #include "RBAArbitrator.hpp"
 #include "RBARequestQueMember.hpp"
 #include "RBAResultSet.hpp"
+#include "RBAResultSetPool.hpp"
 #include "RBAResultImpl.hpp"
+#include "RBAExpressionCache.hpp"
+#include "RBAInputRecorder.hpp"
+#include "RBAElementArray.hpp"
 
 namespace rba
 {
@@ -57,12 +63,17 @@ public:
   void createResultData();
 
   bool satisfiesConstraints() const;
+  void getFailedConstraints(std::list<const RBAConstraintImpl*>& failedConstraints) const;
+  std::int32_t getMaxNest() const;
+  std::int32_t getReArbitrationCount() const;
   std::unique_ptr<RBAResult> arbitrateMain();
-  void arbitrate(std::list<RBAAllocatable*>& allocatables);
-  void arbitrateAllocatable(RBAAllocatable* allocatable,
+  void arbitrateMain(std::unique_ptr<RBAResult>& result);
+  std::unique_ptr<RBAResult> simulateMain(std::list<std::string>& contexts,
+                                          const bool require);
+  void arbitrate(const std::vector<RBAAllocatable*>& allocatables);
+  void arbitrateAllocatable(RBAAllocatable* const allocatable,
                             std::set<const RBAAllocatable*>& revisited,
-                            const std::int32_t nest, RBAAffectInfo* const affectInfo,
-                            RBARollbacker* const parentRollbacker);
+                            RBAAffectInfo* const affectInfo);
   void getAffectedAllocatables(
       RBAAllocatable* allocatable,
       std::list<RBAConstraintImpl*>& falseConstraints,
@@ -99,18 +110,31 @@ public:
   void setResultLog();
 #endif
 
+  std::unique_ptr<RBAResultSet> mapResultSet(const RBAResultSet& src,
+                                             RBAModelImpl* const newModel) const;
+
  private:
+  struct ReArbitrationFrame;
+
+  void arbitrateRequests();
   void differenceArbitrate();
-  bool checkConstraints(std::list<RBAConstraintImpl*>& constraints,
+  bool checkConstraints(const RBAElementArray<RBAConstraintImpl*>& constraints,
                         std::list<RBAConstraintImpl*>& falseConstraints,
                         const RBAAllocatable* const allocatable);
-  bool checkConstraintAndReArbitrate(RBAAllocatable* allocatable,
-                                     std::set<const RBAAllocatable*>& revisited,
-                                     const std::int32_t nest,
-                                     RBAAffectInfo* const affectInfo,
-                                     RBARollbacker* const parentRollbacker,
-                                     std::list<RBAConstraintImpl*>& constraints,
-                                     bool * const isSkipped, const bool isFinal);
+  bool executeConstraint(RBAConstraintImpl* const constraint,
+                         const bool record);
+  void stepAllocatable(std::deque<ReArbitrationFrame>& frames,
+                       std::set<const RBAAllocatable*>& revisited,
+                       RBAAffectInfo* const affectInfo);
+  bool canReArbitrate(const std::int32_t nest, const std::size_t count);
+  void countArbitrationStep();
+  void keepPreviousResult(RBAAllocatable* const allocatable) const;
+  void recordAffectedAllocatables(RBAAllocatable* const allocatable,
+                                  const std::list<RBAConstraintImpl*>& falseConstraints,
+                                  RBAAffectInfo* const affectInfo);
+  bool needsAffectedAllocatables(const RBAConstraintImpl* const constraint,
+                                 const RBAAllocatable* const allocatable,
+                                 const RBAAffectInfo* const affectInfo) const;
   void setCancel(const RBAContentState* const state, const bool checked);
   void getSortedContentStates(
       const RBAAllocatable* const allocatable,
@@ -146,6 +170,18 @@ public:
   void setSimulationMode(bool simulationMode);
 #endif
   std::deque<std::unique_ptr<RBARequestQueMember>>& getRequestQue();
+  RBAExpressionCache& getExpressionCache();
+  bool isShortCircuit() const;
+  void setAdaptiveOrder(const bool adaptive);
+  bool isAdaptiveOrder() const;
+  void setConstraintCache(const bool constraintCache);
+  bool isConstraintCache() const;
+  void setObjectPool(const bool pool);
+  const std::shared_ptr<RBAResultSetPool>& getResultSetPool() const;
+  void setReArbitrationLimit(const std::int32_t maxNest,
+                             const std::int32_t maxCount);
+  void setArbitrationBudget(const std::int32_t maxMicroseconds,
+                            const std::int32_t maxSteps);
 
  private:
   RBAArbitrator* arb_ {nullptr};
@@ -161,6 +197,8 @@ public:
 #pragma warning(pop)
 #endif
 
+  // Shared with the results, which give back their result sets
+  std::shared_ptr<RBAResultSetPool> resultSetPool_ {std::make_shared<RBAResultSetPool>()};
   mutable std::unique_ptr<RBAResultImpl> result_;
   // 次の調停でCurrentResultSetとして使用するResultSet
   std::unique_ptr<RBAResultSet> nextResultSet_;
@@ -178,6 +216,31 @@ public:
 #endif
   std::deque<std::unique_ptr<RBARequestQueMember>> requestQue_;
   std::uint32_t syncIndex_ {0xFFFFU};
+  // 制約チェック中に評価した共有式の結果
+  RBAExpressionCache expressionCache_;
+  // ANDとORの評価順を学習し、制約の成否だけを先に短絡評価で求める
+  bool adaptiveOrder_ {false};
+  // 短絡評価中
+  bool shortCircuit_ {false};
+  // 読み込んだ調停状態が前回と同じ制約は評価せずに前回の結果を使う
+  bool constraintCache_ {true};
+  // 制約チェック中に制約が読み込んだ調停状態
+  RBAInputRecorder inputRecorder_;
+  // 直前の調停での再調停の最大ネスト階層
+  std::int32_t maxNest_ {0};
+  // 直前の調停で再調停したアロケータブルの数
+  std::size_t reArbitrationCount_ {0U};
+  // 再調停のネスト階層と、1回の調停で再調停するアロケータブルの数の上限（0は上限なし）
+  std::int32_t nestLimit_ {0};
+  std::size_t revisitLimit_ {0U};
+  // 1回の調停の時間と手順数の上限（0は上限なし）
+  std::chrono::microseconds timeBudget_ {0};
+  std::uint32_t stepBudget_ {0U};
+  // 直前の調停の手順数と、時間の上限に達する時刻
+  std::uint32_t arbitrationSteps_ {0U};
+  std::chrono::steady_clock::time_point deadline_;
+  // 直前の調停が上限を超えた
+  bool budgetExceeded_ {false};
 
 };
 
@@ -198,11 +261,30 @@ class DLL_EXPORT RBAArbitrator::Impl
  public:
   RBAModelImpl* getModel();
   void setModel(RBAModelImpl* const newModel);
+  bool swapModel(RBAModelImpl* const newModel);
+  bool loadConstraintPlugin(const std::string& filename);
+  void setAdaptiveOperandOrder(const bool adaptive);
+  bool saveOperandOrder(const std::string& filename);
+  bool loadOperandOrder(const std::string& filename);
+  void setConstraintCache(const bool cache);
+  void setObjectPool(const bool pool);
+  void setReArbitrationLimit(const std::int32_t maxNest,
+                             const std::int32_t maxCount);
+  void setArbitrationBudget(const std::int32_t maxMicroseconds,
+                            const std::int32_t maxSteps);
+  std::int32_t getMaxReArbitrationNest();
+  std::int32_t getReArbitrationCount();
   void initialize(std::list<std::string>& contexts);
   std::unique_ptr<RBAResult> execute(const std::string& contextName,
                                      const bool require = true);
   std::unique_ptr<RBAResult> execute(std::list<std::string>& contexts,
                                      const bool require = true);
+  void execute(const std::string& contextName, const bool require,
+               std::unique_ptr<RBAResult>& result);
+  void execute(std::list<std::string>& contexts, const bool require,
+               std::unique_ptr<RBAResult>& result);
+  std::unique_ptr<RBAResult> simulate(std::list<std::string>& contexts,
+                                      const bool require);
   std::unique_ptr<RBAResult> execute(
       const std::string& sceneName,
       std::list<std::pair<std::string, std::int32_t>>& properties);
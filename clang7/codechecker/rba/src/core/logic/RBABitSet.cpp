@@ -0,0 +1,146 @@
+/**
+ * Copyright (c) 2019 DENSO CORPORATION.
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Bit set class
+ */
+
+#include "RBABitSet.hpp"
+
+namespace rba
+{
+
+namespace
+{
+
+const std::size_t WORD_BITS {64U};
+
+}
+
+RBABitSet::RBABitSet(const std::size_t size)
+{
+  resize(size);
+}
+
+/**
+ * Change the number of the elements
+ * All bits are cleared.
+ */
+void
+RBABitSet::resize(const std::size_t size)
+{
+  size_ = size;
+  words_.assign((size + WORD_BITS - 1U) / WORD_BITS, 0U);
+}
+
+std::size_t
+RBABitSet::size() const
+{
+  return size_;
+}
+
+void
+RBABitSet::set(const std::size_t index)
+{
+  if (index < size_) {
+    words_[index / WORD_BITS] |= (std::uint64_t{1U} << (index % WORD_BITS));
+  }
+}
+
+void
+RBABitSet::reset(const std::size_t index)
+{
+  if (index < size_) {
+    words_[index / WORD_BITS] &= ~(std::uint64_t{1U} << (index % WORD_BITS));
+  }
+}
+
+void
+RBABitSet::clear()
+{
+  for (std::uint64_t& word : words_) {
+    word = 0U;
+  }
+}
+
+bool
+RBABitSet::test(const std::size_t index) const
+{
+  if (index >= size_) {
+    return false;
+  }
+  return ((words_[index / WORD_BITS] >> (index % WORD_BITS)) & 1U) != 0U;
+}
+
+/**
+ * @return true if at least one bit is set
+ */
+bool
+RBABitSet::any() const
+{
+  for (const std::uint64_t word : words_) {
+    if (word != 0U) {
+      return true;
+    }
+  }
+  return false;
+}
+
+/**
+ * @return true if a bit other than index is set
+ */
+bool
+RBABitSet::anyExcept(const std::size_t index) const
+{
+  for (std::size_t i {0U}; i < words_.size(); i++) {
+    std::uint64_t word {words_[i]};
+    if (i == (index / WORD_BITS)) {
+      word &= ~(std::uint64_t{1U} << (index % WORD_BITS));
+    }
+    if (word != 0U) {
+      return true;
+    }
+  }
+  return false;
+}
+
+/**
+ * @return true if a bit greater than index is set
+ */
+bool
+RBABitSet::anyAbove(const std::size_t index) const
+{
+  const std::size_t first {index / WORD_BITS};
+  if (first >= words_.size()) {
+    return false;
+  }
+  const std::size_t shift {index % WORD_BITS};
+  // Bits up to index of the first word are masked
+  const std::uint64_t mask {(shift == (WORD_BITS - 1U))
+                            ? std::uint64_t{0U}
+                            : (~std::uint64_t{0U} << (shift + 1U))};
+  if ((words_[first] & mask) != 0U) {
+    return true;
+  }
+  for (std::size_t i {first + 1U}; i < words_.size(); i++) {
+    if (words_[i] != 0U) {
+      return true;
+    }
+  }
+  return false;
+}
+
+}
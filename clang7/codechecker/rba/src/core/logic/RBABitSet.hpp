@@ -0,0 +1,72 @@
+/**
+ * Copyright (c) 2019 DENSO CORPORATION.
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Bit set class header
+ *
+ * Fixed size set of small integers such as the indexes of the allocatables.
+ * Each bit is kept in a 64-bit word, so that the set operations used while
+ * arbitrating process 64 elements at once.
+ */
+
+#ifndef RBABITSET_HPP
+#define RBABITSET_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "RBADllExport.hpp"
+
+namespace rba
+{
+
+class DLL_EXPORT RBABitSet
+{
+public:
+  RBABitSet()=default;
+  explicit RBABitSet(const std::size_t size);
+  RBABitSet(const RBABitSet&)=default;
+  RBABitSet(RBABitSet&&)=default;
+  RBABitSet& operator=(const RBABitSet&)=default;
+  RBABitSet& operator=(RBABitSet&&)=default;
+  virtual ~RBABitSet()=default;
+
+public:
+  void resize(const std::size_t size);
+  std::size_t size() const;
+  void set(const std::size_t index);
+  void reset(const std::size_t index);
+  void clear();
+  bool test(const std::size_t index) const;
+  bool any() const;
+  bool anyExcept(const std::size_t index) const;
+  bool anyAbove(const std::size_t index) const;
+
+private:
+  std::size_t size_ {0U};
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable:4251)
+#endif
+  std::vector<std::uint64_t> words_;
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+};
+
+}
+
+#endif
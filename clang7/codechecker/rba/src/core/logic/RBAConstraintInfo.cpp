@@ -50,8 +50,15 @@ RBAConstraintInfo*
 RBAConstraintInfo::getChild(const std::uint32_t index) const
 {
   const std::size_t requiredSize {static_cast<std::size_t>(index + 1U)};
-  if (children_.size() < requiredSize) {
-    children_.resize(requiredSize, std::make_unique<RBAConstraintInfo>());
+  if (sharesChildren_) {
+    // Do not overwrite the children of the copy source
+    children_.clear();
+    sharesChildren_ = false;
+  }
+  // Each child has its own instance, also when the children are not
+  // requested in index order
+  while (children_.size() < requiredSize) {
+    children_.push_back(std::make_shared<RBAConstraintInfo>());
   }
   // Use "[]" instead of "at" because it doesn't access out of range
   return children_[static_cast<std::size_t>(index)].get();
@@ -131,6 +138,10 @@ const bool RBAConstraintInfo::isImplies() const
 
 void RBAConstraintInfo::clear()
 {
+  if (sharesChildren_) {
+    children_.clear();
+    sharesChildren_ = false;
+  }
   for (const std::shared_ptr<RBAConstraintInfo>& child : children_) {
     // @Deviation (MEM05-CPP,Rule-7_5_4,A7-5-2)
     //  [Contents that deviate from the rules]
@@ -149,6 +160,37 @@ void RBAConstraintInfo::clear()
   operandAllocatable_.clear();
 }
 
+/**
+ * Copy the evaluation result of an identical expression
+ * The children are shared with source, and are not modified
+ * through this ConstraintInfo.
+ */
+void RBAConstraintInfo::copyResult(const RBAConstraintInfo& source)
+{
+  exceptionBeforeArbitrate_ = source.exceptionBeforeArbitrate_;
+  result_ = source.result_;
+  trueAllocatables_ = source.trueAllocatables_;
+  falseAllocatables_ = source.falseAllocatables_;
+  operandAllocatable_ = source.operandAllocatable_;
+  children_ = source.children_;
+  sharesChildren_ = true;
+}
+
+/**
+ * Create a ConstraintInfo that holds the evaluation result
+ * The children are handed over to the created ConstraintInfo. This
+ * ConstraintInfo creates new children at the next evaluation instead of
+ * clearing them.
+ */
+std::shared_ptr<RBAConstraintInfo> RBAConstraintInfo::shareResult() const
+{
+  std::shared_ptr<RBAConstraintInfo> result
+    {std::make_shared<RBAConstraintInfo>()};
+  result->copyResult(*this);
+  sharesChildren_ = true;
+  return result;
+}
+
 bool RBAConstraintInfo::isExceptionBeforeArbitrate() const
 {
   return exceptionBeforeArbitrate_;
@@ -55,6 +55,8 @@ public:
   void clearFalseAllocatable();
   const bool isImplies() const;
   void clear();
+  void copyResult(const RBAConstraintInfo& source);
+  std::shared_ptr<RBAConstraintInfo> shareResult() const;
 
   bool isExceptionBeforeArbitrate() const;
   void setExceptionBeforeArbitrate(const bool exceptionBeforeArbitrate);
@@ -96,6 +98,8 @@ private:
 
 private:
   bool exceptionBeforeArbitrate_ {false};
+  // children_ belongs to the ConstraintInfo given to copyResult()
+  mutable bool sharesChildren_ {false};
   const RBAExpression* expression_ {nullptr};
   RBAExecuteResult result_ {RBAExecuteResult::SKIP};
 
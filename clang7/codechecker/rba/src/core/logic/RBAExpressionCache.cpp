@@ -0,0 +1,118 @@
+/**
+ * Copyright (c) 2019 DENSO CORPORATION.
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Expression cache class
+ */
+
+#include "RBAExpressionCache.hpp"
+#include "RBAConstraintInfo.hpp"
+#include "RBAInputRecorder.hpp"
+#ifdef RBA_USE_LOG
+#include "RBALogManager.hpp"
+#endif
+
+namespace rba
+{
+
+/**
+ * Start a constraint check
+ * The allocatables do not change while the constraints of one check are
+ * evaluated, so the results of the previous check are invalidated here
+ * by the version.
+ * @param sharedCount number of shared IDs of the model
+ */
+void
+RBAExpressionCache::begin(const std::uint32_t sharedCount)
+{
+  if (entries_.size() != static_cast<std::size_t>(sharedCount)) {
+    entries_.assign(static_cast<std::size_t>(sharedCount), Entry());
+  }
+  version_++;
+  enabled_ = (sharedCount > 0U);
+#ifdef RBA_USE_LOG
+  // Every evaluation is logged
+  if (RBALogManager::getLogManager() != nullptr) {
+    enabled_ = false;
+  }
+#endif
+}
+
+/**
+ * End a constraint check
+ * The expressions evaluated outside of a check are not cached.
+ */
+void
+RBAExpressionCache::end()
+{
+  enabled_ = false;
+}
+
+bool
+RBAExpressionCache::isEnabled() const
+{
+  return enabled_;
+}
+
+/**
+ * Search the result of an expression identical to expression
+ * @param info ConstraintInfo of expression
+ * @param result result of the identical expression
+ * @return ConstraintInfo of the identical expression.
+ *         nullptr if it has not been evaluated in this check.
+ */
+const RBAConstraintInfo*
+RBAExpressionCache::find(const std::uint32_t sharedId,
+                         const RBAExpression* const expression,
+                         const RBAConstraintInfo* const info,
+                         bool& result) const
+{
+  if (!enabled_ || (static_cast<std::size_t>(sharedId) >= entries_.size())) {
+    return nullptr;
+  }
+  const Entry& entry {entries_[static_cast<std::size_t>(sharedId)]};
+  if ((entry.version != version_) || (entry.info == info)) {
+    return nullptr;
+  }
+  // The ConstraintInfo may have been reused by another expression
+  if (entry.info->getExpression() != entry.expression) {
+    return nullptr;
+  }
+  result = entry.result;
+  RBAInputRecorder::copyCurrent(entry.inputsBegin, entry.inputsEnd);
+  return entry.info;
+}
+
+void
+RBAExpressionCache::store(const std::uint32_t sharedId,
+                          const RBAExpression* const expression,
+                          const RBAConstraintInfo* const info,
+                          const bool result,
+                          const std::size_t inputsBegin)
+{
+  if (!enabled_ || (static_cast<std::size_t>(sharedId) >= entries_.size())) {
+    return;
+  }
+  Entry& entry {entries_[static_cast<std::size_t>(sharedId)]};
+  entry.version = version_;
+  entry.expression = expression;
+  entry.info = info;
+  entry.result = result;
+  entry.inputsBegin = inputsBegin;
+  entry.inputsEnd = RBAInputRecorder::getCurrentPosition();
+}
+
+}
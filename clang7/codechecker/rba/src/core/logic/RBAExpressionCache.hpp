@@ -0,0 +1,96 @@
+/**
+ * Copyright (c) 2019 DENSO CORPORATION.
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Expression cache class header
+ *
+ * Holds the evaluation results of the shared expressions, which are the
+ * structurally identical expressions found across the constraints when the
+ * model is loaded. An expression that has the same shared ID as an
+ * expression already evaluated in the same constraint check copies its
+ * result and its ConstraintInfo instead of evaluating.
+ * The inputs recorded by RBAInputRecorder while the first expression was
+ * evaluated are recorded again for the expression that copies the result.
+ */
+
+#ifndef RBAEXPRESSIONCACHE_HPP
+#define RBAEXPRESSIONCACHE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "RBADllExport.hpp"
+
+namespace rba
+{
+
+class RBAExpression;
+class RBAConstraintInfo;
+
+class DLL_EXPORT RBAExpressionCache
+{
+public:
+  RBAExpressionCache()=default;
+  RBAExpressionCache(const RBAExpressionCache&)=delete;
+  RBAExpressionCache(const RBAExpressionCache&&)=delete;
+  RBAExpressionCache& operator=(const RBAExpressionCache&)=delete;
+  RBAExpressionCache& operator=(const RBAExpressionCache&&)=delete;
+  virtual ~RBAExpressionCache()=default;
+
+public:
+  void begin(const std::uint32_t sharedCount);
+  void end();
+  bool isEnabled() const;
+  const RBAConstraintInfo* find(const std::uint32_t sharedId,
+                                const RBAExpression* const expression,
+                                const RBAConstraintInfo* const info,
+                                bool& result) const;
+  void store(const std::uint32_t sharedId,
+             const RBAExpression* const expression,
+             const RBAConstraintInfo* const info,
+             const bool result,
+             const std::size_t inputsBegin);
+
+private:
+  struct Entry
+  {
+    // The entry is valid only when this equals version_
+    std::uint64_t version {0U};
+    const RBAExpression* expression {nullptr};
+    const RBAConstraintInfo* info {nullptr};
+    bool result {false};
+    // Range of the inputs recorded while the expression was evaluated
+    std::size_t inputsBegin {0U};
+    std::size_t inputsEnd {0U};
+  };
+
+private:
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable:4251)
+#endif
+  // entries_[shared ID]
+  std::vector<Entry> entries_;
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+  std::uint64_t version_ {0U};
+  bool enabled_ {false};
+};
+
+}
+
+#endif
@@ -0,0 +1,245 @@
+/**
+ * Copyright (c) 2019 DENSO CORPORATION.
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Input recorder class definition file
+ */
+
+#include "RBAInputRecorder.hpp"
+#include "RBAAllocatable.hpp"
+#include "RBAResultImpl.hpp"
+
+namespace rba
+{
+
+namespace
+{
+
+// Recorder of the constraint being evaluated in this thread.
+// The model elements hold the arbitration state and do not know the
+// arbitrator, so the recorder cannot be passed to them.
+thread_local RBAInputRecorder* currentRecorder {nullptr};
+
+}
+
+/**
+ * Discard the recorded inputs
+ * The positions obtained before are no longer valid.
+ */
+void
+RBAInputRecorder::clear()
+{
+  inputs_.clear();
+}
+
+/**
+ * Start recording the inputs read in this thread
+ */
+void
+RBAInputRecorder::start()
+{
+  currentRecorder = this;
+}
+
+void
+RBAInputRecorder::stop()
+{
+  currentRecorder = nullptr;
+}
+
+std::size_t
+RBAInputRecorder::getPosition() const
+{
+  return inputs_.size();
+}
+
+/**
+ * Get the inputs recorded after the position begin
+ */
+void
+RBAInputRecorder::getInputs(const std::size_t begin,
+                            std::vector<RBAInput>& inputs) const
+{
+  inputs.assign(inputs_.begin() + static_cast<std::ptrdiff_t>(begin),
+                inputs_.end());
+}
+
+void
+RBAInputRecorder::recordValue(const RBAInputType type,
+                              const void* const object,
+                              const std::int32_t value,
+                              const void* const argument)
+{
+  if (currentRecorder != nullptr) {
+    RBAInput input;
+    input.type = type;
+    input.object = object;
+    input.argument = argument;
+    input.value = value;
+    currentRecorder->inputs_.push_back(input);
+  }
+}
+
+void
+RBAInputRecorder::recordState(const RBAInputType type,
+                              const void* const object,
+                              const void* const state)
+{
+  if (currentRecorder != nullptr) {
+    RBAInput input;
+    input.type = type;
+    input.object = object;
+    input.state = state;
+    currentRecorder->inputs_.push_back(input);
+  }
+}
+
+/**
+ * Position of the recorder of this thread
+ * @return 0 if no recorder is recording
+ */
+std::size_t
+RBAInputRecorder::getCurrentPosition()
+{
+  if (currentRecorder == nullptr) {
+    return 0U;
+  }
+  return currentRecorder->getPosition();
+}
+
+/**
+ * Record again the inputs recorded between begin and end,
+ * when the result of an expression evaluated before is reused
+ */
+void
+RBAInputRecorder::copyCurrent(const std::size_t begin, const std::size_t end)
+{
+  if (currentRecorder == nullptr) {
+    return;
+  }
+  std::vector<RBAInput>& inputs {currentRecorder->inputs_};
+  inputs.reserve(inputs.size() + (end - begin));
+  for (std::size_t i {begin}; i < end; i++) {
+    // Copy by value because push_back() may reallocate
+    const RBAInput input {inputs[i]};
+    inputs.push_back(input);
+  }
+}
+
+/**
+ * Whether every input still has the recorded value
+ * Must not be called while recording.
+ */
+bool
+RBAInputRecorder::isUnchanged(const std::vector<RBAInput>& inputs,
+                              const RBAResultImpl* const result)
+{
+  for (const RBAInput& input : inputs) {
+    RBAInput current {input};
+    if (!read(current, result)) {
+      return false;
+    }
+    if ((current.value != input.value) || (current.state != input.state)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * Read the current value of an input
+ * @return false if the type is unknown
+ */
+bool
+RBAInputRecorder::read(RBAInput& input, const RBAResultImpl* const result)
+{
+  const RBAAllocatable* const allocatable
+    {static_cast<const RBAAllocatable*>(input.object)};
+  const RBAContent* const content {static_cast<const RBAContent*>(input.object)};
+  const RBAAbstractProperty* const property
+    {static_cast<const RBAAbstractProperty*>(input.object)};
+  switch (input.type) {
+    case RBAInputType::CHECKED:
+      input.value = allocatable->isChecked();
+      break;
+    case RBAInputType::HIDDEN_CHECKED:
+      input.value = allocatable->isHiddenChecked();
+      break;
+    case RBAInputType::HIDDEN:
+      input.value = allocatable->isHidden();
+      break;
+    case RBAInputType::ATTENUATE_CHECKED:
+      input.value = allocatable->isAttenuateChecked();
+      break;
+    case RBAInputType::ATTENUATED:
+      input.value = allocatable->isAttenuated();
+      break;
+    case RBAInputType::STATE:
+      input.state = allocatable->getState();
+      break;
+    case RBAInputType::ACTIVE_SCENE:
+      input.value = result->isActive(static_cast<const RBAScene*>(input.object));
+      break;
+    case RBAInputType::PRE_ACTIVE_SCENE:
+      input.value = result->isPreActive(static_cast<const RBAScene*>(input.object));
+      break;
+    case RBAInputType::ACTIVE_CONTENT:
+      input.value = result->isActive(content);
+      break;
+    case RBAInputType::PRE_ACTIVE_CONTENT:
+      input.value = result->isPreActive(content);
+      break;
+    case RBAInputType::ACTIVE_STATE:
+      input.state = result->getActiveState(content);
+      break;
+    case RBAInputType::PRE_ACTIVE_STATE:
+      input.state = result->getPreActiveState(content);
+      break;
+    case RBAInputType::PRE_HIDDEN:
+      input.value = result->isPreHidden(allocatable);
+      break;
+    case RBAInputType::PRE_ATTENUATED:
+      input.value = result->isPreAttenuated(static_cast<const RBAZone*>(input.object));
+      break;
+    case RBAInputType::PRE_ALLOCATED_STATE:
+      input.state = result->getPreAllocatedContentState(allocatable);
+      break;
+    case RBAInputType::DIRECT_PRE_STATE:
+      input.state = result->getDirectPreContentState(allocatable);
+      break;
+    case RBAInputType::LATER:
+      input.value = result->isLater(content,
+                                    static_cast<const RBAContent*>(input.argument));
+      break;
+    case RBAInputType::SCENE_PROPERTY:
+      input.value = result->getSceneProperty(property);
+      break;
+    case RBAInputType::PRE_SCENE_PROPERTY:
+      input.value = result->getPreSceneProperty(property);
+      break;
+    case RBAInputType::DISPLAYED:
+      input.value = result->hasBeenDisplayed(content);
+      break;
+    case RBAInputType::PRE_DISPLAYED:
+      input.value = result->hasBeenPreDisplayed(content);
+      break;
+    default:
+      return false;
+  }
+  return true;
+}
+
+}
@@ -0,0 +1,121 @@
+/**
+ * Copyright (c) 2019 DENSO CORPORATION.
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Input recorder class header file
+ *
+ * Records the arbitration state that is read while a constraint is
+ * evaluated, which is the state of the allocatables and the requests and
+ * the previous result held by RBAResultImpl. The arbitration state read by
+ * the expressions is obtained only through the functions that call
+ * recordValue() or recordState(), so the evaluation of a constraint gives
+ * the same result as long as every recorded input has the recorded value.
+ */
+
+#ifndef RBAINPUTRECORDER_HPP
+#define RBAINPUTRECORDER_HPP
+
+#include <cstdint>
+#include <vector>
+#include "RBADllExport.hpp"
+
+namespace rba
+{
+
+class RBAResultImpl;
+
+enum class RBAInputType : std::uint8_t
+{
+  // RBAAllocatable
+  CHECKED,
+  HIDDEN_CHECKED,
+  HIDDEN,
+  ATTENUATE_CHECKED,
+  ATTENUATED,
+  STATE,
+  // RBAResultImpl
+  ACTIVE_SCENE,
+  PRE_ACTIVE_SCENE,
+  ACTIVE_CONTENT,
+  PRE_ACTIVE_CONTENT,
+  ACTIVE_STATE,
+  PRE_ACTIVE_STATE,
+  PRE_HIDDEN,
+  PRE_ATTENUATED,
+  PRE_ALLOCATED_STATE,
+  DIRECT_PRE_STATE,
+  LATER,
+  SCENE_PROPERTY,
+  PRE_SCENE_PROPERTY,
+  DISPLAYED,
+  PRE_DISPLAYED
+};
+
+struct RBAInput
+{
+  RBAInputType type {RBAInputType::CHECKED};
+  // Object whose state was read, and the second argument of the function
+  const void* object {nullptr};
+  const void* argument {nullptr};
+  // Value that was read
+  const void* state {nullptr};
+  std::int32_t value {0};
+};
+
+class DLL_EXPORT RBAInputRecorder
+{
+public:
+  RBAInputRecorder()=default;
+  RBAInputRecorder(const RBAInputRecorder&)=delete;
+  RBAInputRecorder(const RBAInputRecorder&&)=delete;
+  RBAInputRecorder& operator=(const RBAInputRecorder&)=delete;
+  RBAInputRecorder& operator=(const RBAInputRecorder&&)=delete;
+  virtual ~RBAInputRecorder()=default;
+
+public:
+  void clear();
+  void start();
+  void stop();
+  std::size_t getPosition() const;
+  void getInputs(const std::size_t begin, std::vector<RBAInput>& inputs) const;
+
+  static void recordValue(const RBAInputType type, const void* const object,
+                          const std::int32_t value,
+                          const void* const argument = nullptr);
+  static void recordState(const RBAInputType type, const void* const object,
+                          const void* const state);
+  static std::size_t getCurrentPosition();
+  static void copyCurrent(const std::size_t begin, const std::size_t end);
+  static bool isUnchanged(const std::vector<RBAInput>& inputs,
+                          const RBAResultImpl* const result);
+
+private:
+  static bool read(RBAInput& input, const RBAResultImpl* const result);
+
+private:
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable:4251)
+#endif
+  std::vector<RBAInput> inputs_;
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+};
+
+}
+
+#endif
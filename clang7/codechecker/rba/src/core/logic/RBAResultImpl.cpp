@@ -27,6 +27,8 @@
 #include "RBASoundContentImpl.hpp"
 #include "RBASoundContentStateImpl.hpp"
 #include "RBAResultSet.hpp"
+#include "RBAResultSetPool.hpp"
+#include "RBAInputRecorder.hpp"
 #include "RBAAllocatable.hpp"
 #include "RBAContentState.hpp"
 #include "RBAContent.hpp"
@@ -45,19 +47,19 @@ namespace rba {
 RBAResultImpl::RBAResultImpl(const RBAArbitratorImpl* const arb,
                               std::unique_ptr<RBAResultSet> newPrevResultSet):
                                 RBAResult(),
+                                resultSetPool_{arb->getResultSetPool()},
                                 preResultSet_{std::move(newPrevResultSet)},
                                 arb_{arb},
                                 statusType_{RBAResultStatusType::SUCCESS}
 {
-  curResultSet_ = std::make_unique<RBAResultSet>();
-  curResultSet_->copyActives(preResultSet_);
-  curResultSet_->copyProperties(preResultSet_);
+  curResultSet_ = resultSetPool_->copyActives(preResultSet_);
 }
 
 RBAResultImpl::RBAResultImpl(const RBAArbitratorImpl* const arb,
                               std::unique_ptr<RBAResultSet> newPrevResultSet,
                               std::unique_ptr<RBAResultSet> newCurResultSet):
                                 RBAResult(),
+                                resultSetPool_{arb->getResultSetPool()},
                                 curResultSet_{std::move(newCurResultSet)},
                                 preResultSet_{std::move(newPrevResultSet)},
                                 arb_{arb},
@@ -67,13 +69,46 @@ RBAResultImpl::RBAResultImpl(const RBAArbitratorImpl* const arb,
 
 RBAResultImpl::RBAResultImpl(const RBAResultImpl* const replicationTarget)
   : RBAResult{},
-    curResultSet_{std::make_unique<RBAResultSet>(*(replicationTarget->curResultSet_.get()))},
-    preResultSet_{std::make_unique<RBAResultSet>(*(replicationTarget->preResultSet_.get()))},
+    resultSetPool_{replicationTarget->resultSetPool_},
+    curResultSet_{resultSetPool_->copy(*(replicationTarget->curResultSet_.get()))},
+    preResultSet_{resultSetPool_->copy(*(replicationTarget->preResultSet_.get()))},
     arb_{replicationTarget->arb_},
     statusType_{RBAResultStatusType::SUCCESS},
     log_{replicationTarget->log_}
 {
-  for (const auto &va : replicationTarget->viewActions_) {
+  copyViewActions(*replicationTarget);
+}
+
+/**
+ * Make this result the same as result, reusing the memory of this result
+ * Used for the result objects that callers pass to execute() again.
+ * The status type is copied too, unlike the replication constructor.
+ */
+void
+RBAResultImpl::copyFrom(const RBAResultImpl& result)
+{
+  if (curResultSet_ == nullptr) {
+    curResultSet_ = resultSetPool_->copy(*result.curResultSet_);
+  } else {
+    curResultSet_->copyFrom(*result.curResultSet_);
+  }
+  if (preResultSet_ == nullptr) {
+    preResultSet_ = resultSetPool_->copy(*result.preResultSet_);
+  } else {
+    preResultSet_->copyFrom(*result.preResultSet_);
+  }
+  arb_ = result.arb_;
+  statusType_ = result.statusType_;
+  log_ = result.log_;
+  viewActions_.clear();
+  viewActionsForPublicUse_.clear();
+  copyViewActions(result);
+}
+
+void
+RBAResultImpl::copyViewActions(const RBAResultImpl& result)
+{
+  for (const auto &va : result.viewActions_) {
     if (va->getViewActionType() == RBAViewActionType::MOVE) {
       viewActions_.push_back(
           std::make_unique<RBAViewMove>(va->getFromArea(), va->getToArea(),
@@ -94,6 +129,13 @@ RBAResultImpl::RBAResultImpl(const RBAResultImpl* const replicationTarget)
   }
 }
 
+RBAResultImpl::~RBAResultImpl() noexcept
+{
+  // Give back the result sets for the next arbitration
+  resultSetPool_->release(std::move(curResultSet_));
+  resultSetPool_->release(std::move(preResultSet_));
+}
+
 //
 // External
 //
@@ -424,47 +466,55 @@ RBAResultImpl::getPreSize(const RBAArea* area) const
 bool
 RBAResultImpl::isActive(const RBAScene* scene) const
 {
-  return curResultSet_->isActive(scene);
+  const bool active {curResultSet_->isActive(scene)};
+  RBAInputRecorder::recordValue(RBAInputType::ACTIVE_SCENE, scene, active);
+  return active;
 }
 
 bool
 RBAResultImpl::isPreActive(const RBAScene* scene) const
 {
-  return preResultSet_->isActive(scene);
+  const bool active {preResultSet_->isActive(scene)};
+  RBAInputRecorder::recordValue(RBAInputType::PRE_ACTIVE_SCENE, scene, active);
+  return active;
 }
 
 // [check Active Content]
 bool
 RBAResultImpl::isActive(const RBAContent* const content) const
 {
-  return curResultSet_->isActive(content);
+  const bool active {curResultSet_->isActive(content)};
+  RBAInputRecorder::recordValue(RBAInputType::ACTIVE_CONTENT, content, active);
+  return active;
 }
 bool
 RBAResultImpl::isActive(const RBAViewContent* content) const
 {
-  return curResultSet_->isActive(dynamic_cast<const RBAContent*>(content));
+  return isActive(dynamic_cast<const RBAContent*>(content));
 }
 
 bool
 RBAResultImpl::isActive(const RBASoundContent* content) const
 {
-  return curResultSet_->isActive(dynamic_cast<const RBAContent*>(content));
+  return isActive(dynamic_cast<const RBAContent*>(content));
 }
 bool
 RBAResultImpl::isPreActive(const RBAContent* const content) const
 {
-  return preResultSet_->isActive(content);
+  const bool active {preResultSet_->isActive(content)};
+  RBAInputRecorder::recordValue(RBAInputType::PRE_ACTIVE_CONTENT, content, active);
+  return active;
 }
 bool
 RBAResultImpl::isPreActive(const RBAViewContent* content) const
 {
-  return preResultSet_->isActive(dynamic_cast<const RBAContent*>(content));
+  return isPreActive(dynamic_cast<const RBAContent*>(content));
 }
 
 bool
 RBAResultImpl::isPreActive(const RBASoundContent* content) const
 {
-  return preResultSet_->isActive(dynamic_cast<const RBAContent*>(content));
+  return isPreActive(dynamic_cast<const RBAContent*>(content));
 }
 
 // [check Active ContentState]
@@ -507,19 +557,23 @@ RBAResultImpl::isPreActive(const RBASoundContentState* const state) const
 const RBAContentState*
 RBAResultImpl::getActiveState(const RBAContent* const content) const
 {
+  const RBAContentState* state {nullptr};
   if (curResultSet_->isActive(content)){
-    return curResultSet_->getReqestState(content);
+    state = curResultSet_->getReqestState(content);
   }
-  return nullptr;
+  RBAInputRecorder::recordState(RBAInputType::ACTIVE_STATE, content, state);
+  return state;
 }
 
 const RBAContentState*
 RBAResultImpl::getPreActiveState(const RBAContent* const content) const
 {
+  const RBAContentState* state {nullptr};
   if (preResultSet_->isActive(content)){
-    return preResultSet_->getReqestState(content);
+    state = preResultSet_->getReqestState(content);
   }
-  return nullptr;
+  RBAInputRecorder::recordState(RBAInputType::PRE_ACTIVE_STATE, content, state);
+  return state;
 }
 
 // [check Visible/Sounding Alloc ContentState]
@@ -583,7 +637,9 @@ RBAResultImpl::getAllocatedContentState(const RBAAllocatable* const allocatable)
 const RBAContentState*
 RBAResultImpl::getPreAllocatedContentState(const RBAAllocatable* const allocatable) const
 {
-  return preResultSet_->getContentState(allocatable);
+  const RBAContentState* const state {preResultSet_->getContentState(allocatable)};
+  RBAInputRecorder::recordState(RBAInputType::PRE_ALLOCATED_STATE, allocatable, state);
+  return state;
 }
 
 const RBAViewContentState*
@@ -650,7 +706,9 @@ RBAResultImpl::isAttenuated(const RBAZone* zone) const
 bool
 RBAResultImpl::isPreAttenuated(const RBAZone* zone) const
 {
-  return preResultSet_->isAttenuated(zone);
+  const bool attenuated {preResultSet_->isAttenuated(zone)};
+  RBAInputRecorder::recordValue(RBAInputType::PRE_ATTENUATED, zone, attenuated);
+  return attenuated;
 }
 
 // [common]
@@ -675,7 +733,10 @@ bool
 RBAResultImpl::isLater(const RBAContent* const target,
                        const RBAContent* const comparisonTarget) const
 {
-  return curResultSet_->isLater(target, comparisonTarget);
+  const bool later {curResultSet_->isLater(target, comparisonTarget)};
+  RBAInputRecorder::recordValue(RBAInputType::LATER, target, later,
+                                comparisonTarget);
+  return later;
 }
 
 std::string
@@ -703,7 +764,8 @@ RBAResultImpl::hasDisplayingArea(const RBADisplay* display) const
 bool
 RBAResultImpl::satisfiesConstraints() const
 {
-  if(statusType_ != RBAResultStatusType::SUCCESS) {
+  if((statusType_ != RBAResultStatusType::SUCCESS)
+     && (statusType_ != RBAResultStatusType::DEGRADED)) {
     return false;
   }
   return arb_->satisfiesConstraints();
@@ -744,13 +806,17 @@ RBAResultImpl::getSceneProperty(const RBAScene* scene,
 std::int32_t
 RBAResultImpl::getSceneProperty(const RBAAbstractProperty* const property) const
 {
-  return curResultSet_->getSceneProperty(property);
+  const std::int32_t value {curResultSet_->getSceneProperty(property)};
+  RBAInputRecorder::recordValue(RBAInputType::SCENE_PROPERTY, property, value);
+  return value;
 }
 
 std::int32_t
 RBAResultImpl::getPreSceneProperty(const RBAAbstractProperty* const property) const
 {
-  return preResultSet_->getSceneProperty(property);
+  const std::int32_t value {preResultSet_->getSceneProperty(property)};
+  RBAInputRecorder::recordValue(RBAInputType::PRE_SCENE_PROPERTY, property, value);
+  return value;
 }
 
 //
@@ -795,7 +861,9 @@ RBAResultImpl::getPreContentState(const RBAAllocatable* const allocatable) const
 const RBAContentState*
 RBAResultImpl::getDirectPreContentState(const RBAAllocatable* const allocatable) const
 {
-  return preResultSet_->getDirectContentState(allocatable);
+  const RBAContentState* const state {preResultSet_->getDirectContentState(allocatable)};
+  RBAInputRecorder::recordState(RBAInputType::DIRECT_PRE_STATE, allocatable, state);
+  return state;
 }
 
 // Impl [get Areas/Zones by ConentState]
@@ -899,7 +967,9 @@ RBAResultImpl::isHidden(const RBAAllocatable* const allocatable) const
 bool
 RBAResultImpl::isPreHidden(const RBAAllocatable* const allocatable) const
 {
-  return preResultSet_->isHidden(allocatable);
+  const bool hidden {preResultSet_->isHidden(allocatable)};
+  RBAInputRecorder::recordValue(RBAInputType::PRE_HIDDEN, allocatable, hidden);
+  return hidden;
 }
 
 // Impl [set Cancel ContentState]
@@ -969,16 +1039,13 @@ RBAResultImpl::cancelContentState(const RBAContentState* const state)
 std::unique_ptr<RBAResultSet>
 RBAResultImpl::createBackupCurrentResultSet()
 {
-  return std::make_unique<RBAResultSet>(*curResultSet_);
+  return resultSetPool_->copy(*curResultSet_);
 }
 
 std::unique_ptr<RBAResultSet>
 RBAResultImpl::createNextCurrentResultSet()
 {
-  std::unique_ptr<RBAResultSet> nextResultSet {std::make_unique<RBAResultSet>()};
-  nextResultSet->copyActives(curResultSet_);
-  nextResultSet->copyProperties(curResultSet_);
-  return nextResultSet;
+  return resultSetPool_->copyActives(curResultSet_);
 }
 
 void
@@ -1039,11 +1106,15 @@ bool RBAResultImpl::hasBeenPreCanceled(const RBAContent* const content) const
 
 bool RBAResultImpl::hasBeenDisplayed(const RBAContent* const content) const
 {
-  return curResultSet_->hasBeenDisplayed(content);
+  const bool displayed {curResultSet_->hasBeenDisplayed(content)};
+  RBAInputRecorder::recordValue(RBAInputType::DISPLAYED, content, displayed);
+  return displayed;
 }
 bool RBAResultImpl::hasBeenPreDisplayed(const RBAContent* const content) const
 {
-  return preResultSet_->hasBeenDisplayed(content);
+  const bool displayed {preResultSet_->hasBeenDisplayed(content)};
+  RBAInputRecorder::recordValue(RBAInputType::PRE_DISPLAYED, content, displayed);
+  return displayed;
 }
 
 void RBAResultImpl::updateStatus(const RBAContent* const content)
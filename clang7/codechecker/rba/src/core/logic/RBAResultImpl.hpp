@@ -44,6 +44,7 @@ class RBAViewContentStateImpl;
 class RBASizeImpl;
 class RBASceneImpl;
 class RBAResultSet;
+class RBAResultSetPool;
 class RBAViewAction;
 class RBAZoneImpl;
 class RBASoundContentImpl;
@@ -70,7 +71,7 @@ public:
   RBAResultImpl(const RBAResultImpl&&)=delete;
   RBAResultImpl& operator=(const RBAResultImpl&)=delete;
   RBAResultImpl& operator=(const RBAResultImpl&&)=delete;
-  virtual ~RBAResultImpl()=default;
+  virtual ~RBAResultImpl() noexcept;
 
 public:
 
@@ -285,6 +286,7 @@ public:
   // Impl [common]
   std::unique_ptr<RBAResultSet> createBackupCurrentResultSet();
   std::unique_ptr<RBAResultSet> createNextCurrentResultSet();
+  void copyFrom(const RBAResultImpl& result);
   void addViewAction(std::unique_ptr<RBAViewAction>& newViewAction);
   void setStatusType(const RBAResultStatusType newStatusType);
   void updateActiveContentStates();
@@ -319,11 +321,16 @@ public:
   const std::list<const RBAConstraint*>& getFailedConstraints() const;
 #endif
 
+private:
+  void copyViewActions(const RBAResultImpl& result);
+
 private:
 #ifdef _MSC_VER
 #pragma warning(push)
 #pragma warning(disable:4251)
 #endif
+  // Pool of the arbitrator, where the result sets are given back
+  std::shared_ptr<RBAResultSetPool> resultSetPool_;
   std::unique_ptr<RBAResultSet> curResultSet_;
   std::unique_ptr<RBAResultSet> preResultSet_;
   mutable std::list<std::unique_ptr<RBAViewAction>> viewActions_;
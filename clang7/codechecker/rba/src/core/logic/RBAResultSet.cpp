@@ -26,11 +26,14 @@
 #include "RBAAreaImpl.hpp"
 #include "RBAViewContentImpl.hpp"
 #include "RBAViewContentState.hpp"
+#include "RBAViewContentStateImpl.hpp"
 #include "RBASizeImpl.hpp"
 #include "RBAZone.hpp"
 #include "RBAZoneImpl.hpp"
 #include "RBASoundContent.hpp"
+#include "RBASoundContentImpl.hpp"
 #include "RBASoundContentState.hpp"
+#include "RBASoundContentStateImpl.hpp"
 #include "RBASceneImpl.hpp"
 #include "RBAContentState.hpp"
 #include "RBAContent.hpp"
@@ -39,6 +42,7 @@
 #include "RBAConstraint.hpp"
 #include "RBADisplay.hpp"
 #include "RBAAbstractProperty.hpp"
+#include "RBAElementCast.hpp"
 
 namespace rba {
 
@@ -65,6 +69,7 @@ RBAResultSet::RBAResultSet(const RBAResultSet& resultSet)
   , activeSoundContentStates_{resultSet.activeSoundContentStates_}
   , requestOrderView_{resultSet.requestOrderView_}
   , requestOrderSound_{resultSet.requestOrderSound_}
+  , requestOrders_{resultSet.requestOrders_}
   , activeScenes_{resultSet.activeScenes_}
   , propertyMap_{resultSet.propertyMap_}
   , event_content_{resultSet.event_content_}
@@ -215,8 +220,8 @@ RBAResultSet::getContentState(const RBAAllocatable* const alloc) const
       // is the contentState assigned to the "alloc".
       // Search this until it is not allocatable content. 
       while ((state != nullptr) 
-              && (dynamic_cast<RBAAllocatable*>(state->getOwner()) != nullptr)) {
-        it = allocToContentState_.find(dynamic_cast<RBAAllocatable*>(state->getOwner()));
+              && (state->getOwner()->toAllocatable() != nullptr)) {
+        it = allocToContentState_.find(state->getOwner()->toAllocatable());
         state = it->second;
       }
       return state;
@@ -400,7 +405,7 @@ RBAResultSet::isActive(const RBAContent* const content) const
 bool
 RBAResultSet::isActive(const RBAContentState* const state) const
 {
-  const RBAContent* const content {dynamic_cast<RBAContent*>(state->getOwner())};
+  const RBAContent* const content {state->getOwner()->toContent()};
   return (isActive(content) && (getReqestState(content) == state));
 }
 
@@ -465,8 +470,8 @@ RBAResultSet::isCancel(const RBAContentState* const state) const
 bool
 RBAResultSet::isAlreadyOutputting(const RBAContentState* const state) const
 {
-  const auto content = dynamic_cast<const RBAContent*>(state->getOwner());
-  for(auto& alloc : content->getAllocatables()) {
+  const auto content = state->getOwner()->toContent();
+  for(auto& alloc : content->getAllocatableArray()) {
     if((getContentState(alloc) == state) && !alloc->isHidden()) {
       return true;
     }
@@ -509,7 +514,7 @@ RBAResultSet::setActive(const RBAScene* const scene, const bool newActive)
 void
 RBAResultSet::setActive(const RBAContentState* const state, const bool newActive)
 {
-  updateRequestStatus(dynamic_cast<RBAContent*>(state->getOwner()), newActive);
+  updateRequestStatus(state->getOwner()->toContent(), newActive);
 
   // Check if Content is already active
   const RBAContentState* temp {nullptr};
@@ -522,31 +527,35 @@ RBAResultSet::setActive(const RBAContentState* const state, const bool newActive
   // Delete if Content is active
   if (temp != nullptr) {
     setOrder(temp, 0);
+    static_cast<void>(requestOrders_.erase(temp->getOwner()->toContent()));
     static_cast<void>(activeContentStates_.erase(temp));
     if (temp->isViewContentState()) {
-      activeViewContentStates_.remove(dynamic_cast<const RBAViewContentState*>(temp));
+      activeViewContentStates_.remove(RBAElementCast::staticCast<const RBAViewContentStateImpl*>(temp));
     } else {
-      activeSoundContentStates_.remove(dynamic_cast<const RBASoundContentState*>(temp));
+      activeSoundContentStates_.remove(RBAElementCast::staticCast<const RBASoundContentStateImpl*>(temp));
     }
   }
 
   // Rgistre active
   if(newActive) {
-    requestContentStateMap_[dynamic_cast<const RBAContent*>(state->getOwner())] = state;
+    const RBAContent* const content {state->getOwner()->toContent()};
+    requestContentStateMap_[content] = state;
     static_cast<void>(activeContentStates_.insert(state));
     if (state->isViewContentState()) {
       setOrder(state, requestOrderView_);
+      requestOrders_[content] = requestOrderView_;
       requestOrderView_++;
-      activeViewContentStates_.push_back(dynamic_cast<const RBAViewContentState*>(state));
+      activeViewContentStates_.push_back(RBAElementCast::staticCast<const RBAViewContentStateImpl*>(state));
     } else {
       setOrder(state, requestOrderSound_);
+      requestOrders_[content] = requestOrderSound_;
       requestOrderSound_++;
-      activeSoundContentStates_.push_back(dynamic_cast<const RBASoundContentState*>(state));
+      activeSoundContentStates_.push_back(RBAElementCast::staticCast<const RBASoundContentStateImpl*>(state));
     }
   }
   else {
     setOrder(state, 0);
-    static_cast<void>(requestContentStateMap_.erase(dynamic_cast<const RBAContent*>(state->getOwner())));
+    static_cast<void>(requestContentStateMap_.erase(state->getOwner()->toContent()));
   }
 }
 
@@ -557,9 +566,25 @@ RBAResultSet::cancelContentState(const RBAContentState* const state)
 {
   setOrder(state, 0);
   if (state->isViewContentState()) {
-    canceledViewContents_.push_back(dynamic_cast<const RBAViewContent*>(state->getOwner()));
+    canceledViewContents_.push_back(RBAElementCast::staticCast<const RBAViewContentImpl*>(state->getOwner()->toContent()));
   } else {
-    canceledSoundContents_.push_back(dynamic_cast<const RBASoundContent*>(state->getOwner()));
+    canceledSoundContents_.push_back(RBAElementCast::staticCast<const RBASoundContentImpl*>(state->getOwner()->toContent()));
+  }
+}
+
+// [add Canceled Content]
+
+void
+RBAResultSet::addCanceledContent(const RBAContent* const content)
+{
+  if (content->isViewContent()) {
+    canceledViewContents_.push_back(RBAElementCast::staticCast<const RBAViewContentImpl*>(content));
+  }
+  else if (content->isSoundContent()) {
+    canceledSoundContents_.push_back(RBAElementCast::staticCast<const RBASoundContentImpl*>(content));
+  }
+  else {
+    ;
   }
 }
 
@@ -585,8 +610,15 @@ RBAResultSet::setContentState(const RBAAllocatable* const alloc, const RBAConten
   allocToContentState_[alloc] = state;
   const bool isHiddenRes {alloc->isHidden()};
   const bool existsState {(state != nullptr)};
-  const RBAAreaImpl* area {dynamic_cast<const RBAAreaImpl*>(alloc)};
-  const RBAZoneImpl* zone {dynamic_cast<const RBAZoneImpl*>(alloc)};
+  const RBAAreaImpl* area {nullptr};
+  const RBAZoneImpl* zone {nullptr};
+  if (alloc->isArea()) {
+    area = RBAElementCast::staticCast<const RBAAreaImpl*>(alloc);
+  } else if (alloc->isZone()) {
+    zone = RBAElementCast::staticCast<const RBAZoneImpl*>(alloc);
+  } else {
+    ;
+  }
 
   if (isHiddenRes) {
 	static_cast<void>(hiddenAllocs_.insert(alloc));
@@ -603,8 +635,8 @@ RBAResultSet::setContentState(const RBAAllocatable* const alloc, const RBAConten
     }
     if (isOutputting(alloc)) {
       const RBAContentState* s {state};
-      while ((s != nullptr) && (dynamic_cast<RBAAllocatable*>(s->getOwner()) != nullptr)) {
-        RBAAllocatable* extAlloc {dynamic_cast<RBAAllocatable*>(s->getOwner())};
+      while ((s != nullptr) && (s->getOwner()->toAllocatable() != nullptr)) {
+        RBAAllocatable* extAlloc {s->getOwner()->toAllocatable()};
         static_cast<void>(outputtingAllocs_.insert(extAlloc));
         s = extAlloc->getState();
       }
@@ -688,10 +720,10 @@ void
 RBAResultSet::addOutputtingContentState(const RBAContentState* const state)
 {
   if (state->isViewContentState()) {
-    visibleContentStates_.push_back(dynamic_cast<const RBAViewContentState*>(state));
+    visibleContentStates_.push_back(RBAElementCast::staticCast<const RBAViewContentStateImpl*>(state));
   }
   else if (state->isSoundContentState()) {
-    soundingContentStates_.push_back(dynamic_cast<const RBASoundContentState*>(state));
+    soundingContentStates_.push_back(RBAElementCast::staticCast<const RBASoundContentStateImpl*>(state));
   }
   else {
     ;
@@ -704,10 +736,10 @@ void
 RBAResultSet::addStandbyContent(const RBAContent* const content)
 {
   if (content->isViewContent()) {
-    standbyViewContents_.push_back(dynamic_cast<const RBAViewContent*>(content));
+    standbyViewContents_.push_back(RBAElementCast::staticCast<const RBAViewContentImpl*>(content));
   }
   else if (content->isSoundContent()) {
-    standbySoundContents_.push_back(dynamic_cast<const RBASoundContent*>(content));
+    standbySoundContents_.push_back(RBAElementCast::staticCast<const RBASoundContentImpl*>(content));
   }
   else {
     ;
@@ -729,12 +761,17 @@ RBAResultSet::copyActives(const std::unique_ptr<RBAResultSet>& resultSet)
   // Reset order
   requestOrderView_ = 1;
   requestOrderSound_ = 1;
+  requestOrders_.clear();
   for(const RBAViewContentState* const viewState : activeViewContentStates_) {
-    setOrder(dynamic_cast<const RBAContentState*>(viewState), requestOrderView_);
+    const RBAContentState* const state {dynamic_cast<const RBAContentState*>(viewState)};
+    setOrder(state, requestOrderView_);
+    requestOrders_[state->getOwner()->toContent()] = requestOrderView_;
     requestOrderView_++;
   }
   for(const RBASoundContentState* const soundState : activeSoundContentStates_) {
-    setOrder(dynamic_cast<const RBAContentState*>(soundState), requestOrderSound_);
+    const RBAContentState* const state {dynamic_cast<const RBAContentState*>(soundState)};
+    setOrder(state, requestOrderSound_);
+    requestOrders_[state->getOwner()->toContent()] = requestOrderSound_;
     requestOrderSound_++;
   }
 }
@@ -743,15 +780,92 @@ void
 RBAResultSet::updateActiveContentStates()
 {
   for (auto& state : canceledContentStates_) {
-	static_cast<void>(activeContentStates_.erase(state));
+	if (activeContentStates_.erase(state) > 0U) {
+      static_cast<void>(requestOrders_.erase(state->getOwner()->toContent()));
+    }
     if (state->isViewContentState()) {
-      activeViewContentStates_.remove(dynamic_cast<const RBAViewContentState*>(state));
+      activeViewContentStates_.remove(RBAElementCast::staticCast<const RBAViewContentStateImpl*>(state));
     } else {
-      activeSoundContentStates_.remove(dynamic_cast<const RBASoundContentState*>(state));
+      activeSoundContentStates_.remove(RBAElementCast::staticCast<const RBASoundContentStateImpl*>(state));
     }
   }
 }
 
+// [Reuse]
+
+/**
+ * Make this result set the same as the one created by the copy constructor
+ * The containers are assigned, so that their memory is reused.
+ */
+void
+RBAResultSet::copyFrom(const RBAResultSet& resultSet)
+{
+  outputtingAllocs_ = resultSet.outputtingAllocs_;
+  hiddenAllocs_ = resultSet.hiddenAllocs_;
+  activeContentStates_ = resultSet.activeContentStates_;
+  canceledContentStates_ = resultSet.canceledContentStates_;
+  allocToContentState_ = resultSet.allocToContentState_;
+  visibleAreas_ = resultSet.visibleAreas_;
+  soundingZones_ = resultSet.soundingZones_;
+  invisibleAreas_ = resultSet.invisibleAreas_;
+  unsoundingZones_ = resultSet.unsoundingZones_;
+  hiddenAreas_ = resultSet.hiddenAreas_;
+  muteZones_ = resultSet.muteZones_;
+  attenuatedZones_ = resultSet.attenuatedZones_;
+  canceledViewContents_ = resultSet.canceledViewContents_;
+  canceledSoundContents_ = resultSet.canceledSoundContents_;
+  standbyViewContents_ = resultSet.standbyViewContents_;
+  standbySoundContents_ = resultSet.standbySoundContents_;
+  visibleContentStates_ = resultSet.visibleContentStates_;
+  soundingContentStates_ = resultSet.soundingContentStates_;
+  activeViewContentStates_ = resultSet.activeViewContentStates_;
+  activeSoundContentStates_ = resultSet.activeSoundContentStates_;
+  requestOrderView_ = resultSet.requestOrderView_;
+  requestOrderSound_ = resultSet.requestOrderSound_;
+  requestOrders_ = resultSet.requestOrders_;
+  activeScenes_ = resultSet.activeScenes_;
+  propertyMap_ = resultSet.propertyMap_;
+  event_content_ = resultSet.event_content_;
+  contentToStatus_ = resultSet.contentToStatus_;
+  differentConditionScenes_.clear();
+  requestContentStateMap_ = resultSet.requestContentStateMap_;
+#ifdef RBA_USE_LOG
+  failedConstraints_ = resultSet.failedConstraints_;
+#endif
+}
+
+/**
+ * Clear everything that copyActives() and copyProperties() do not set
+ * A result set cleared and then given the actives and the properties is
+ * the same as a new result set given them.
+ */
+void
+RBAResultSet::clearResults()
+{
+  outputtingAllocs_.clear();
+  hiddenAllocs_.clear();
+  canceledContentStates_.clear();
+  allocToContentState_.clear();
+  visibleAreas_.clear();
+  soundingZones_.clear();
+  invisibleAreas_.clear();
+  unsoundingZones_.clear();
+  hiddenAreas_.clear();
+  muteZones_.clear();
+  attenuatedZones_.clear();
+  canceledViewContents_.clear();
+  canceledSoundContents_.clear();
+  standbyViewContents_.clear();
+  standbySoundContents_.clear();
+  visibleContentStates_.clear();
+  soundingContentStates_.clear();
+  event_content_.clear();
+  differentConditionScenes_.clear();
+#ifdef RBA_USE_LOG
+  failedConstraints_.clear();
+#endif
+}
+
 void
 RBAResultSet::copyProperties(const std::unique_ptr<RBAResultSet>& resultSet)
 {
@@ -817,47 +931,23 @@ RBAResultSet::hasDisplayingArea(const RBADisplay* const display) const
   return displayed;
 }
 
+/**
+ * @brief Whether the content has been requested later than the comparison
+ *        target
+ * @details Compares the request orders, which are kept for each kind of
+ *          the content. A content that is not active is earlier than
+ *          any active content.
+ */
 bool
 RBAResultSet::isLater(const RBAContent* const target,
                       const RBAContent* const comparisonTarget) const
 {
-  bool isLaterRes {false};
-  bool isBreak {false};
-
-  if (target->isViewContent()) {
-    const RBAViewContent* const targetContent {
-        dynamic_cast<const RBAViewContent*>(target)};
-    const RBAViewContent* const comparisonTargetContent {
-        dynamic_cast<const RBAViewContent*>(comparisonTarget)};
-    for (auto it = activeViewContentStates_.rbegin();
-        (it != activeViewContentStates_.rend()) && (!isBreak) ; it++) {
-      if ((*it)->getOwner() == targetContent) {
-        isLaterRes = true;
-        isBreak = true;
-      } else if ((*it)->getOwner() == comparisonTargetContent) {
-        isBreak = true;
-      } else {
-        ;
-      }
-    }
-  } else {
-    const RBASoundContent* const targetContent {
-        dynamic_cast<const RBASoundContent*>(target)};
-    const RBASoundContent* const comparisonTargetContent {
-        dynamic_cast<const RBASoundContent*>(comparisonTarget)};
-    for (auto it = activeSoundContentStates_.rbegin();
-        (it != activeSoundContentStates_.rend()) && (!isBreak); it++) {
-      if ((*it)->getOwner() == targetContent) {
-        isLaterRes = true;
-        isBreak = true;
-      } else if ((*it)->getOwner() == comparisonTargetContent) {
-        isBreak = true;
-      } else {
-        ;
-      }
-    }
+  const std::int32_t targetOrder {getRequestOrder(target)};
+  std::int32_t comparisonTargetOrder {0};
+  if (target->isViewContent() == comparisonTarget->isViewContent()) {
+    comparisonTargetOrder = getRequestOrder(comparisonTarget);
   }
-  return isLaterRes;
+  return ((targetOrder > 0) && (targetOrder >= comparisonTargetOrder));
 }
 
 std::set<const RBASceneImpl*>&
@@ -993,4 +1083,17 @@ RBAResultSet::setOrder(const RBAContentState* const state, const std::int32_t ne
   const_cast<RBAContentState*>(state)->setOrder(newOrder);
 }
 
+/**
+ * @return request order of the content, or 0 if it is not active
+ */
+std::int32_t
+RBAResultSet::getRequestOrder(const RBAContent* const content) const
+{
+  const auto it = requestOrders_.find(content);
+  if (it == requestOrders_.end()) {
+    return 0;
+  }
+  return it->second;
+}
+
 }
@@ -148,6 +148,9 @@ public:
   // [cancel ContentState]
   void cancelContentState(const RBAContentState* const state);
 
+  // [add Canceled Content]
+  void addCanceledContent(const RBAContent* const content);
+
   // Impl [set Cancel ContentState]
   void setCancel(const RBAContentState* const state, const bool checked);
 
@@ -164,6 +167,10 @@ public:
   void copyActives(const std::unique_ptr<RBAResultSet>& resultSet);
   void updateActiveContentStates();
 
+  // [Reuse]
+  void copyFrom(const RBAResultSet& resultSet);
+  void clearResults();
+
   // [Property]
   void copyProperties(const std::unique_ptr<RBAResultSet>& resultSet);
   void setSceneProperty(const RBAScene* const scene,
@@ -200,6 +207,7 @@ public:
 private:
   const std::unordered_map<const RBAAbstractProperty*, std::int32_t>& getScenePropertyMap() const;
   void setOrder(const RBAContentState* const state, const std::int32_t newOrder) const;
+  std::int32_t getRequestOrder(const RBAContent* const content) const;
 
   std::set<const RBAAllocatable*> outputtingAllocs_;
   std::set<const RBAAllocatable*> hiddenAllocs_;
@@ -227,6 +235,8 @@ private:
   // common
   std::int32_t requestOrderView_ {1};
   std::int32_t requestOrderSound_ {1};
+  // Request order of the contents in activeView/SoundContentStates_
+  std::unordered_map<const RBAContent*, std::int32_t> requestOrders_;
   std::list<const RBAScene*> activeScenes_;
   std::unordered_map<const RBAAbstractProperty*, std::int32_t> propertyMap_;
   std::unordered_map<const RBAEventProcessing*, const RBAContent*> event_content_;
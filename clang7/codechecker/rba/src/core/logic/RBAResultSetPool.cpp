@@ -0,0 +1,140 @@
+/**
+ * Copyright (c) 2019 DENSO CORPORATION.
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/**
+ * ResultSet pool class
+ */
+
+#include <algorithm>
+#include "RBAResultSetPool.hpp"
+#include "RBAResultSet.hpp"
+
+namespace rba
+{
+
+namespace
+{
+// Upper limit of the kept result sets. Arbitration uses about five result
+// sets at a time, and a few more are held by the results being read.
+const std::size_t MAX_RESULT_SETS {16U};
+}
+
+RBAResultSetPool::~RBAResultSetPool() noexcept=default;
+
+/**
+ * Enable or disable the reuse
+ * The kept result sets are released when the pool is disabled.
+ */
+void
+RBAResultSetPool::setEnabled(const bool enabled)
+{
+  const std::lock_guard<std::mutex> lock {mutex_};
+  enabled_.store(enabled, std::memory_order_relaxed);
+  if (!enabled) {
+    resultSets_.clear();
+    resultSets_.shrink_to_fit();
+  }
+}
+
+bool
+RBAResultSetPool::isEnabled() const
+{
+  return enabled_.load(std::memory_order_relaxed);
+}
+
+/**
+ * Create result sets in advance
+ * @param count number of the result sets to be kept
+ */
+void
+RBAResultSetPool::reserve(const std::size_t count)
+{
+  const std::lock_guard<std::mutex> lock {mutex_};
+  if (!enabled_.load(std::memory_order_relaxed)) {
+    return;
+  }
+  resultSets_.reserve(MAX_RESULT_SETS);
+  while (resultSets_.size() < std::min(count, MAX_RESULT_SETS)) {
+    resultSets_.push_back(std::make_unique<RBAResultSet>());
+  }
+}
+
+/**
+ * @return the same result set as the copy constructor creates
+ */
+std::unique_ptr<RBAResultSet>
+RBAResultSetPool::copy(const RBAResultSet& resultSet)
+{
+  std::unique_ptr<RBAResultSet> dst {acquire()};
+  if (dst == nullptr) {
+    return std::make_unique<RBAResultSet>(resultSet);
+  }
+  dst->copyFrom(resultSet);
+  return dst;
+}
+
+/**
+ * @return result set that has only the active content states and the
+ *         scene properties of resultSet
+ */
+std::unique_ptr<RBAResultSet>
+RBAResultSetPool::copyActives(const std::unique_ptr<RBAResultSet>& resultSet)
+{
+  std::unique_ptr<RBAResultSet> dst {acquire()};
+  if (dst == nullptr) {
+    dst = std::make_unique<RBAResultSet>();
+  } else {
+    dst->clearResults();
+  }
+  dst->copyActives(resultSet);
+  dst->copyProperties(resultSet);
+  return dst;
+}
+
+/**
+ * Give back a result set that is no longer used
+ * It is destroyed if the pool is disabled or full.
+ */
+void
+RBAResultSetPool::release(std::unique_ptr<RBAResultSet> resultSet)
+{
+  if ((resultSet == nullptr) || !enabled_.load(std::memory_order_relaxed)) {
+    return;
+  }
+  const std::lock_guard<std::mutex> lock {mutex_};
+  if (enabled_.load(std::memory_order_relaxed)
+      && (resultSets_.size() < MAX_RESULT_SETS)) {
+    resultSets_.push_back(std::move(resultSet));
+  }
+}
+
+std::unique_ptr<RBAResultSet>
+RBAResultSetPool::acquire()
+{
+  if (!enabled_.load(std::memory_order_relaxed)) {
+    return nullptr;
+  }
+  const std::lock_guard<std::mutex> lock {mutex_};
+  if (resultSets_.empty()) {
+    return nullptr;
+  }
+  std::unique_ptr<RBAResultSet> resultSet {std::move(resultSets_.back())};
+  resultSets_.pop_back();
+  return resultSet;
+}
+
+}
@@ -0,0 +1,83 @@
+/**
+ * Copyright (c) 2019 DENSO CORPORATION.
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/**
+ * ResultSet pool class header
+ *
+ * Keeps the result sets that arbitration no longer uses, so that the next
+ * copies of the result sets are made in them instead of new objects.
+ * Assigning to a kept result set reuses the memory of its containers.
+ * The pool is shared by the arbitrator and its results, because a result
+ * returned by execute() gives back its result sets when it is destroyed,
+ * which may be after the arbitrator is destroyed or on another thread.
+ * While the pool is disabled, it creates and destroys the result sets as
+ * before.
+ */
+
+#ifndef RBARESULTSETPOOL_HPP
+#define RBARESULTSETPOOL_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include "RBADllExport.hpp"
+
+namespace rba
+{
+
+class RBAResultSet;
+
+class DLL_EXPORT RBAResultSetPool
+{
+public:
+  RBAResultSetPool()=default;
+  RBAResultSetPool(const RBAResultSetPool&)=delete;
+  RBAResultSetPool(const RBAResultSetPool&&)=delete;
+  RBAResultSetPool& operator=(const RBAResultSetPool&)=delete;
+  RBAResultSetPool& operator=(const RBAResultSetPool&&)=delete;
+  virtual ~RBAResultSetPool() noexcept;
+
+public:
+  void setEnabled(const bool enabled);
+  bool isEnabled() const;
+  void reserve(const std::size_t count);
+  std::unique_ptr<RBAResultSet> copy(const RBAResultSet& resultSet);
+  std::unique_ptr<RBAResultSet> copyActives(const std::unique_ptr<RBAResultSet>& resultSet);
+  void release(std::unique_ptr<RBAResultSet> resultSet);
+
+private:
+  std::unique_ptr<RBAResultSet> acquire();
+
+private:
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable:4251)
+#endif
+  std::atomic<bool> enabled_ {false};
+  std::mutex mutex_;
+  std::vector<std::unique_ptr<RBAResultSet>> resultSets_;
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+};
+
+}
+
+#endif
@@ -18,6 +18,7 @@
  * Rollbacker (rollback of arbitration results) class implementation
  */
 
+#include <vector>
 #include "RBARollbacker.hpp"
 #include "RBAModelImpl.hpp"
 #include "RBABackUpAllocatable.hpp"
@@ -59,16 +60,28 @@ RBARollbacker::backup(std::list<const RBAAllocatable*>& backuplist)
 void
 RBARollbacker::rollback()
 {
-  for (auto& Child : children_) {
-    // @Deviation (MEM05-CPP,Rule-7_5_4,A7-5-2)
-    // [Contents that deviate from the rules]
-    //  rollback() is called recursively
-    // [Explanation that there is no problem if you deviate from the rules]
-    //  RBARollbacker is created each time the re-arbitration nest becomes 
-    //  deeper, but since the infinite loop prevention process is implemented 
-    //  in re-arbitration, stack overflow does not occur.
-    Child->rollback();
+  // The children are restored before their parent, in the order of their
+  // registration, as the nested re-arbitrations are undone. Walk the tree
+  // with an explicit stack, since a deep re-arbitration nest makes a deep
+  // tree.
+  std::vector<RBARollbacker*> rollbackers;
+  std::vector<RBARollbacker*> stack {this};
+  while (!stack.empty()) {
+    RBARollbacker* const rollbacker {stack.back()};
+    stack.pop_back();
+    rollbackers.push_back(rollbacker);
+    for (auto& child : rollbacker->children_) {
+      stack.push_back(child.get());
+    }
   }
+  for (auto itr = rollbackers.rbegin(); itr != rollbackers.rend(); ++itr) {
+    (*itr)->restore();
+  }
+}
+
+void
+RBARollbacker::restore()
+{
   for(auto itr = backupMap_.begin(); itr != backupMap_.end(); ++itr) {
     const RBAAllocatable* const original {itr->first};
     const RBAAllocatable* const backupVal {itr->second.get()};
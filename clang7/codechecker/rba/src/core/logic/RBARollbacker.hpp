@@ -67,6 +67,11 @@ class RBARollbacker
   void rollback();
 
  private:
+  /**
+   * Restore the backup of this instance without its children
+   */
+  void restore();
+
   /**
    * @brief Copy Allocable arbitration state
    * @param from source of copy
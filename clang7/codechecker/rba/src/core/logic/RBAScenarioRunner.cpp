@@ -0,0 +1,50 @@
+/**
+ * Copyright (c) 2019 DENSO CORPORATION.
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/**
+ * Scenario runner class definition
+ */
+
+#include "RBAScenarioRunner.hpp"
+#include "RBAScenarioRunnerImpl.hpp"
+
+namespace rba
+{
+
+RBAScenarioRunner::RBAScenarioRunner()
+  : impl_{std::make_unique<RBAScenarioRunner::Impl>()}
+{
+}
+
+RBAScenarioRunner::~RBAScenarioRunner() noexcept
+{
+}
+
+bool
+RBAScenarioRunner::load(const std::string& modelFilename,
+                        const std::string& scenarioFilename)
+{
+  return impl_->load(modelFilename, scenarioFilename);
+}
+
+std::vector<RBAScenarioReport>
+RBAScenarioRunner::run(const std::uint32_t threads)
+{
+  return impl_->run(threads);
+}
+
+}
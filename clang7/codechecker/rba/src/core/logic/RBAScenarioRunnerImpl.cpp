@@ -0,0 +1,261 @@
+/**
+ * Copyright (c) 2019 DENSO CORPORATION.
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/**
+ * Scenario runner implementation class definition
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <list>
+#include <sstream>
+#include <thread>
+#include "RBAScenarioRunnerImpl.hpp"
+#include "RBAArbitrator.hpp"
+#include "RBAArea.hpp"
+#include "RBAJsonParser.hpp"
+#include "RBAModel.hpp"
+#include "RBAResult.hpp"
+#include "RBASoundContentState.hpp"
+#include "RBAViewContentState.hpp"
+#include "RBAZone.hpp"
+
+namespace rba
+{
+
+/**
+ * Load the model and the scenarios
+ * The model is parsed here for the first thread of run().
+ */
+bool
+RBAScenarioRunner::Impl::load(const std::string& modelFilename,
+                              const std::string& scenarioFilename)
+{
+  models_.clear();
+  scenarios_.clear();
+  modelFilename_ = modelFilename;
+  RBAJsonParser parser;
+  std::unique_ptr<RBAModel> model {parser.parse(modelFilename)};
+  if (model == nullptr) {
+    std::cerr << "ERROR: Could not read " << modelFilename << std::endl;
+    return false;
+  }
+  models_.push_back(std::move(model));
+  return loadScenarios(scenarioFilename);
+}
+
+bool
+RBAScenarioRunner::Impl::loadScenarios(const std::string& scenarioFilename)
+{
+  std::ifstream file {scenarioFilename};
+  if (!file) {
+    std::cerr << "ERROR: Could not read " << scenarioFilename << std::endl;
+    return false;
+  }
+  std::string line;
+  std::uint32_t lineNumber {0U};
+  while (std::getline(file, line)) {
+    lineNumber++;
+    std::istringstream tokens {line};
+    std::string command;
+    if (!(tokens >> command) || (command[0] == '#')) {
+      continue;
+    }
+    std::string arg0;
+    std::string arg1;
+    std::string arg2;
+    tokens >> arg0 >> arg1 >> arg2;
+    bool isValid {!arg0.empty()};
+    if (command == "scenario") {
+      scenarios_.emplace_back();
+      scenarios_.back().name = arg0;
+    } else if (scenarios_.empty()) {
+      isValid = false;
+    } else if (command == "execute") {
+      Step step;
+      step.context = arg0;
+      step.require = (arg1 != "off");
+      isValid = isValid && (arg1.empty() || (arg1 == "on") || (arg1 == "off"));
+      scenarios_.back().steps.push_back(std::move(step));
+    } else if (command == "property") {
+      Step step;
+      step.context = arg0;
+      step.property = arg1;
+      char* end {nullptr};
+      step.value = static_cast<std::int32_t>(std::strtol(arg2.c_str(), &end, 10));
+      isValid = isValid && !arg1.empty() && !arg2.empty() && (*end == '\0');
+      scenarios_.back().steps.push_back(std::move(step));
+    } else if ((command == "visible") || (command == "sounding")) {
+      isValid = isValid && !arg1.empty() && !scenarios_.back().steps.empty();
+      if (isValid) {
+        Expectation expectation;
+        expectation.isArea = (command == "visible");
+        expectation.allocatable = arg0;
+        expectation.state = arg1;
+        expectation.line = lineNumber;
+        scenarios_.back().steps.back().expectations.push_back(std::move(expectation));
+      }
+    } else {
+      isValid = false;
+    }
+    if (!isValid) {
+      std::cerr << scenarioFilename << ":" << lineNumber
+                << ": ERROR: Invalid line: " << line << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * Run the scenarios on the threads
+ * The models of the threads are parsed on this thread before the threads
+ * start, because the model factory is not reentrant. They are kept for the
+ * next run.
+ */
+std::vector<RBAScenarioReport>
+RBAScenarioRunner::Impl::run(const std::uint32_t threads)
+{
+  std::vector<RBAScenarioReport> reports(scenarios_.size());
+  if (models_.empty() || scenarios_.empty()) {
+    return reports;
+  }
+  std::size_t threadCount {static_cast<std::size_t>(threads)};
+  if (threadCount == 0U) {
+    threadCount = std::max(1U, std::thread::hardware_concurrency());
+  }
+  threadCount = std::min(threadCount, scenarios_.size());
+  while (models_.size() < threadCount) {
+    RBAJsonParser parser;
+    std::unique_ptr<RBAModel> model {parser.parse(modelFilename_)};
+    if (model == nullptr) {
+      break;
+    }
+    models_.push_back(std::move(model));
+  }
+  threadCount = std::min(threadCount, models_.size());
+
+  std::atomic<std::size_t> nextScenario {0U};
+  const auto worker = [this, &reports, &nextScenario](RBAModel* const model) {
+    RBAArbitrator arb {model};
+    std::size_t index {nextScenario.fetch_add(1U)};
+    while (index < scenarios_.size()) {
+      arb.clearArbitration();
+      runScenario(arb, *model, scenarios_[index], reports[index]);
+      index = nextScenario.fetch_add(1U);
+    }
+  };
+  std::vector<std::thread> workers;
+  for (std::size_t i {1U}; i < threadCount; i++) {
+    workers.emplace_back(worker, models_[i].get());
+  }
+  worker(models_[0U].get());
+  for (std::thread& t : workers) {
+    t.join();
+  }
+  return reports;
+}
+
+void
+RBAScenarioRunner::Impl::runScenario(RBAArbitrator& arb, const RBAModel& model,
+                                     const Scenario& scenario,
+                                     RBAScenarioReport& report) const
+{
+  const auto start = std::chrono::steady_clock::now();
+  report.name = scenario.name;
+  report.passed = true;
+  std::unique_ptr<RBAResult> result;
+  for (std::size_t i {0U}; (i < scenario.steps.size()) && report.passed; i++) {
+    const Step& step {scenario.steps[i]};
+    if (step.property.empty()) {
+      arb.execute(step.context, step.require, result);
+    } else {
+      std::list<std::pair<std::string, std::int32_t>> properties
+        {{step.property, step.value}};
+      result = arb.execute(step.context, properties);
+    }
+    if (result->getStatusType() != RBAResultStatusType::SUCCESS) {
+      report.divergence = "Could not execute " + step.context;
+      report.passed = false;
+    }
+    for (const Expectation& expectation : step.expectations) {
+      if (!report.passed) {
+        break;
+      }
+      report.passed = check(model, *result, expectation, report.divergence);
+    }
+    if (!report.passed) {
+      report.failedStep = static_cast<std::int32_t>(i);
+    }
+  }
+  report.elapsedMicroseconds = std::chrono::duration_cast<std::chrono::microseconds>(
+      std::chrono::steady_clock::now() - start).count();
+}
+
+/**
+ * Check an expectation on a result
+ * @param divergence set to the description of the difference if the
+ *        expectation is not met
+ * @return true if the expectation is met
+ */
+bool
+RBAScenarioRunner::Impl::check(const RBAModel& model, const RBAResult& result,
+                               const Expectation& expectation,
+                               std::string& divergence)
+{
+  std::string actual {"-"};
+  if (expectation.isArea) {
+    const RBAArea* const area {model.findArea(expectation.allocatable)};
+    if (area == nullptr) {
+      divergence = "line " + std::to_string(expectation.line)
+          + ": Unknown area " + expectation.allocatable;
+      return false;
+    }
+    if (result.isVisible(area)) {
+      const RBAViewContentState* const state {result.getContentState(area)};
+      if (state != nullptr) {
+        actual = state->getUniqueName();
+      }
+    }
+  } else {
+    const RBAZone* const zone {model.findZone(expectation.allocatable)};
+    if (zone == nullptr) {
+      divergence = "line " + std::to_string(expectation.line)
+          + ": Unknown zone " + expectation.allocatable;
+      return false;
+    }
+    if (result.isSounding(zone)) {
+      const RBASoundContentState* const state {result.getContentState(zone)};
+      if (state != nullptr) {
+        actual = state->getUniqueName();
+      }
+    }
+  }
+  if (actual != expectation.state) {
+    divergence = "line " + std::to_string(expectation.line) + ": "
+        + expectation.allocatable + " expected " + expectation.state
+        + " but " + actual;
+    return false;
+  }
+  return true;
+}
+
+}
@@ -0,0 +1,94 @@
+/**
+ * Copyright (c) 2019 DENSO CORPORATION.
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/**
+ * Scenario runner implementation class header
+ */
+
+#ifndef RBASCENARIORUNNERIMPL_HPP
+#define RBASCENARIORUNNERIMPL_HPP
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include "RBAScenarioRunner.hpp"
+#include "RBAModel.hpp"
+
+namespace rba
+{
+
+class RBAArbitrator;
+class RBAResult;
+
+class RBAScenarioRunner::Impl
+{
+ public:
+  Impl()=default;
+  Impl(const Impl&)=delete;
+  Impl(const Impl&&)=delete;
+  Impl& operator=(const Impl&)=delete;
+  Impl& operator=(const Impl&&)=delete;
+  virtual ~Impl()=default;
+
+  bool load(const std::string& modelFilename,
+            const std::string& scenarioFilename);
+  std::vector<RBAScenarioReport> run(const std::uint32_t threads);
+
+ private:
+  // Expected output of an area or a zone
+  struct Expectation
+  {
+    bool isArea {true};
+    std::string allocatable;
+    // Unique name of the content state, "-" for no output
+    std::string state;
+    std::uint32_t line {0U};
+  };
+  // Request and the expectations on its result
+  struct Step
+  {
+    std::string context;
+    bool require {true};
+    // Scene property set with the scene of context, if not empty
+    std::string property;
+    std::int32_t value {0};
+    std::vector<Expectation> expectations;
+  };
+  struct Scenario
+  {
+    std::string name;
+    std::vector<Step> steps;
+  };
+
+  bool loadScenarios(const std::string& scenarioFilename);
+  void runScenario(RBAArbitrator& arb, const RBAModel& model,
+                   const Scenario& scenario, RBAScenarioReport& report) const;
+  static bool check(const RBAModel& model, const RBAResult& result,
+                    const Expectation& expectation, std::string& divergence);
+
+ private:
+  std::string modelFilename_;
+  // Model of each thread
+  std::vector<std::unique_ptr<RBAModel>> models_;
+  std::vector<Scenario> scenarios_;
+
+};
+
+}
+
+#endif
@@ -0,0 +1,49 @@
+/**
+ * Copyright (c) 2019 DENSO CORPORATION.
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/**
+ * State explorer class definition
+ */
+
+#include "RBAStateExplorer.hpp"
+#include "RBAStateExplorerImpl.hpp"
+
+namespace rba
+{
+
+RBAStateExplorer::RBAStateExplorer()
+  : impl_{std::make_unique<RBAStateExplorer::Impl>()}
+{
+}
+
+RBAStateExplorer::~RBAStateExplorer() noexcept
+{
+}
+
+bool
+RBAStateExplorer::load(const std::string& modelFilename)
+{
+  return impl_->load(modelFilename);
+}
+
+RBAExplorationReport
+RBAStateExplorer::explore(const RBAExplorationOption& option)
+{
+  return impl_->explore(option);
+}
+
+}
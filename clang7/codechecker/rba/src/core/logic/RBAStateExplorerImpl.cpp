@@ -0,0 +1,379 @@
+/**
+ * Copyright (c) 2019 DENSO CORPORATION.
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/**
+ * State explorer implementation class definition
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <limits>
+#include <list>
+#include <random>
+#include <thread>
+#include "RBAStateExplorerImpl.hpp"
+#include "RBAArbitrator.hpp"
+#include "RBAArbitratorImpl.hpp"
+#include "RBAConstraintImpl.hpp"
+#include "RBAJsonParser.hpp"
+#include "RBAResult.hpp"
+#include "RBAScene.hpp"
+#include "RBASoundContentState.hpp"
+#include "RBAViewContentState.hpp"
+
+namespace rba
+{
+
+/**
+ * Load the model
+ * The model is parsed here for the first thread of explore().
+ */
+bool
+RBAStateExplorer::Impl::load(const std::string& modelFilename)
+{
+  models_.clear();
+  modelFilename_ = modelFilename;
+  RBAJsonParser parser;
+  std::unique_ptr<RBAModel> model {parser.parse(modelFilename)};
+  if (model == nullptr) {
+    std::cerr << "ERROR: Could not read " << modelFilename << std::endl;
+    return false;
+  }
+  models_.push_back(std::move(model));
+  return true;
+}
+
+/**
+ * Run the traces on the threads
+ * The models of the threads are parsed on this thread before the threads
+ * start, because the model factory is not reentrant.
+ */
+RBAExplorationReport
+RBAStateExplorer::Impl::explore(const RBAExplorationOption& option)
+{
+  RBAExplorationReport report;
+  if (models_.empty()) {
+    return report;
+  }
+  createInputs(*models_[0U], option.maxPropertyValue);
+  if (inputs_.empty() || (option.traceLength == 0U)) {
+    return report;
+  }
+
+  std::uint64_t traceCount {option.traceCount};
+  if (option.exhaustive) {
+    traceCount = 1U;
+    for (std::uint32_t i {0U}; i < option.traceLength; i++) {
+      if (traceCount > (std::numeric_limits<std::uint64_t>::max() / inputs_.size())) {
+        std::cerr << "ERROR: Too many traces for the exhaustive exploration"
+                  << std::endl;
+        return report;
+      }
+      traceCount *= inputs_.size();
+    }
+  }
+
+  std::uint64_t threadCount {static_cast<std::uint64_t>(option.threads)};
+  if (threadCount == 0U) {
+    threadCount = std::max(1U, std::thread::hardware_concurrency());
+  }
+  threadCount = std::max(std::min(threadCount, traceCount),
+                         static_cast<std::uint64_t>(1U));
+  while (models_.size() < threadCount) {
+    RBAJsonParser parser;
+    std::unique_ptr<RBAModel> model {parser.parse(modelFilename_)};
+    if (model == nullptr) {
+      break;
+    }
+    models_.push_back(std::move(model));
+  }
+  threadCount = std::min(threadCount, static_cast<std::uint64_t>(models_.size()));
+
+  std::vector<Findings> findings(static_cast<std::size_t>(threadCount));
+  std::atomic<std::uint64_t> nextTrace {0U};
+  const auto worker = [this, &option, traceCount, &nextTrace]
+      (RBAModel* const model, Findings& threadFindings) {
+    RBAArbitrator arb {model};
+    std::uint64_t index {nextTrace.fetch_add(1U)};
+    while (index < traceCount) {
+      runTrace(arb, index, createTrace(option, index), threadFindings);
+      index = nextTrace.fetch_add(1U);
+    }
+  };
+  std::vector<std::thread> workers;
+  for (std::size_t i {1U}; i < findings.size(); i++) {
+    workers.emplace_back(worker, models_[i].get(), std::ref(findings[i]));
+  }
+  worker(models_[0U].get(), findings[0U]);
+  for (std::thread& t : workers) {
+    t.join();
+  }
+
+  Findings total;
+  for (const Findings& f : findings) {
+    merge(f, total);
+  }
+  report.traceCount = total.traceCount;
+  report.stepCount = total.stepCount;
+  for (const auto& violation : total.violations) {
+    report.violations.push_back({violation.first, violation.second.runtime,
+                                 format(violation.second.trace)});
+  }
+  report.deepestNest = total.deepestNest;
+  report.deepestTrace = format(total.deepestTrace);
+  report.slowestMicroseconds = total.slowestMicroseconds;
+  report.slowestTrace = format(total.slowestTrace);
+  return report;
+}
+
+/**
+ * Create the requests of a step: each content state and scene on and off,
+ * and each scene property with each value
+ */
+void
+RBAStateExplorer::Impl::createInputs(const RBAModel& model,
+                                     const std::int32_t maxPropertyValue)
+{
+  inputs_.clear();
+  for (const RBAViewContentState* const state : model.getViewContentStates()) {
+    inputs_.push_back({state->getUniqueName(), true, "", 0});
+    inputs_.push_back({state->getUniqueName(), false, "", 0});
+  }
+  for (const RBASoundContentState* const state : model.getSoundContentStates()) {
+    inputs_.push_back({state->getUniqueName(), true, "", 0});
+    inputs_.push_back({state->getUniqueName(), false, "", 0});
+  }
+  for (const RBAScene* const scene : model.getScenes()) {
+    inputs_.push_back({scene->getName(), true, "", 0});
+    inputs_.push_back({scene->getName(), false, "", 0});
+    for (const std::string& property : scene->getPropertyNames()) {
+      for (std::int32_t value {0}; value <= maxPropertyValue; value++) {
+        inputs_.push_back({scene->getName(), true, property, value});
+      }
+    }
+  }
+}
+
+/**
+ * Create the trace of an index
+ * A random trace depends only on the seed and the index, and the
+ * exhaustive exploration takes the index as the digits of the trace.
+ */
+RBAStateExplorer::Impl::Trace
+RBAStateExplorer::Impl::createTrace(const RBAExplorationOption& option,
+                                    const std::uint64_t index) const
+{
+  Trace trace(option.traceLength);
+  if (option.exhaustive) {
+    std::uint64_t digits {index};
+    for (std::size_t& input : trace) {
+      input = static_cast<std::size_t>(digits % inputs_.size());
+      digits /= inputs_.size();
+    }
+  } else {
+    std::mt19937_64 random {option.seed ^ (index * 0x9E3779B97F4A7C15U)};
+    std::uniform_int_distribution<std::size_t> distribution {0U, inputs_.size() - 1U};
+    for (std::size_t& input : trace) {
+      input = distribution(random);
+    }
+  }
+  return trace;
+}
+
+/**
+ * Run a trace from the initial state and record what it finds
+ * A constraint that this thread has found is not minimized again. Each
+ * thread runs the traces in the order of the index, so the trace that
+ * this thread found first has the lowest index.
+ */
+void
+RBAStateExplorer::Impl::runTrace(RBAArbitrator& arb,
+                                 const std::uint64_t traceIndex,
+                                 const Trace& trace, Findings& findings) const
+{
+  arb.clearArbitration();
+  findings.traceCount++;
+  std::unique_ptr<RBAResult> result;
+  std::list<const RBAConstraintImpl*> failedConstraints;
+  for (std::size_t i {0U}; i < trace.size(); i++) {
+    const std::int64_t elapsed {execute(arb, trace[i], result)};
+    findings.stepCount++;
+    const std::int32_t nest {arb.getMaxReArbitrationNest()};
+    if (nest > findings.deepestNest) {
+      findings.deepestNest = nest;
+      findings.deepestTrace.assign(trace.begin(), trace.begin() + i + 1);
+    }
+    if (elapsed > findings.slowestMicroseconds) {
+      findings.slowestMicroseconds = elapsed;
+      findings.slowestTrace.assign(trace.begin(), trace.begin() + i + 1);
+    }
+    failedConstraints.clear();
+    arb.getImpl()->getFailedConstraints(failedConstraints);
+    for (const RBAConstraintImpl* const constraint : failedConstraints) {
+      const std::string& name {constraint->getElementName()};
+      if (findings.violations.find(name) == findings.violations.end()) {
+        const Trace prefix(trace.begin(), trace.begin() + i + 1);
+        findings.violations[name] = {constraint->isRuntime(), traceIndex,
+                                     minimize(arb, prefix, name)};
+        // The minimization has changed the state of arbitration
+        arb.clearArbitration();
+        for (std::size_t j {0U}; j <= i; j++) {
+          static_cast<void>(execute(arb, trace[j], result));
+        }
+      }
+    }
+  }
+}
+
+/**
+ * @return true if a step of the trace fails the constraint
+ */
+bool
+RBAStateExplorer::Impl::failsConstraint(RBAArbitrator& arb, const Trace& trace,
+                                        const std::string& constraint) const
+{
+  arb.clearArbitration();
+  std::unique_ptr<RBAResult> result;
+  std::list<const RBAConstraintImpl*> failedConstraints;
+  for (const std::size_t input : trace) {
+    static_cast<void>(execute(arb, input, result));
+    failedConstraints.clear();
+    arb.getImpl()->getFailedConstraints(failedConstraints);
+    for (const RBAConstraintImpl* const failed : failedConstraints) {
+      if (failed->getElementName() == constraint) {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+/**
+ * Minimize a trace that fails a constraint by delta debugging (ddmin)
+ * The trace is split into chunks, and a chunk or all but a chunk that
+ * still fails the constraint replaces the trace. The chunks are made
+ * smaller until no chunk of a single request can be removed.
+ */
+RBAStateExplorer::Impl::Trace
+RBAStateExplorer::Impl::minimize(RBAArbitrator& arb, const Trace& trace,
+                                 const std::string& constraint) const
+{
+  Trace current {trace};
+  std::size_t chunkCount {2U};
+  while (current.size() >= 2U) {
+    const std::size_t chunkSize {(current.size() + chunkCount - 1U) / chunkCount};
+    bool isReduced {false};
+    for (std::size_t begin {0U}; (begin < current.size()) && !isReduced; begin += chunkSize) {
+      const std::size_t end {std::min(begin + chunkSize, current.size())};
+      const Trace chunk(current.begin() + begin, current.begin() + end);
+      if (failsConstraint(arb, chunk, constraint)) {
+        current = chunk;
+        chunkCount = 2U;
+        isReduced = true;
+      }
+    }
+    for (std::size_t begin {0U}; (begin < current.size()) && !isReduced; begin += chunkSize) {
+      const std::size_t end {std::min(begin + chunkSize, current.size())};
+      Trace complement(current.begin(), current.begin() + begin);
+      static_cast<void>(complement.insert(complement.end(), current.begin() + end, current.end()));
+      if (failsConstraint(arb, complement, constraint)) {
+        current = std::move(complement);
+        chunkCount = std::max(chunkCount - 1U, static_cast<std::size_t>(2U));
+        isReduced = true;
+      }
+    }
+    if (!isReduced) {
+      if (chunkCount >= current.size()) {
+        break;
+      }
+      chunkCount = std::min(chunkCount * 2U, current.size());
+    }
+  }
+  return current;
+}
+
+/**
+ * Execute a request
+ * @return execution time in microseconds
+ */
+std::int64_t
+RBAStateExplorer::Impl::execute(RBAArbitrator& arb, const std::size_t input,
+                                std::unique_ptr<RBAResult>& result) const
+{
+  const Input& request {inputs_[input]};
+  const auto start = std::chrono::steady_clock::now();
+  if (request.property.empty()) {
+    arb.execute(request.context, request.require, result);
+  } else {
+    std::list<std::pair<std::string, std::int32_t>> properties
+      {{request.property, request.value}};
+    result = arb.execute(request.context, properties);
+  }
+  return std::chrono::duration_cast<std::chrono::microseconds>(
+      std::chrono::steady_clock::now() - start).count();
+}
+
+/**
+ * Format a trace as the lines of a scenario file of RBAScenarioRunner
+ */
+std::vector<std::string>
+RBAStateExplorer::Impl::format(const Trace& trace) const
+{
+  std::vector<std::string> lines;
+  for (const std::size_t input : trace) {
+    const Input& request {inputs_[input]};
+    if (request.property.empty()) {
+      lines.push_back("execute " + request.context
+                      + (request.require ? " on" : " off"));
+    } else {
+      lines.push_back("property " + request.context + " " + request.property
+                      + " " + std::to_string(request.value));
+    }
+  }
+  return lines;
+}
+
+/**
+ * Merge the findings of a thread
+ * The violation found by the trace of the lowest index is kept, so that
+ * the report does not depend on the number of the threads.
+ */
+void
+RBAStateExplorer::Impl::merge(const Findings& findings, Findings& total)
+{
+  total.traceCount += findings.traceCount;
+  total.stepCount += findings.stepCount;
+  for (const auto& violation : findings.violations) {
+    const auto it = total.violations.find(violation.first);
+    if ((it == total.violations.end())
+        || (violation.second.traceIndex < it->second.traceIndex)) {
+      total.violations[violation.first] = violation.second;
+    }
+  }
+  if (findings.deepestNest > total.deepestNest) {
+    total.deepestNest = findings.deepestNest;
+    total.deepestTrace = findings.deepestTrace;
+  }
+  if (findings.slowestMicroseconds > total.slowestMicroseconds) {
+    total.slowestMicroseconds = findings.slowestMicroseconds;
+    total.slowestTrace = findings.slowestTrace;
+  }
+}
+
+}
@@ -0,0 +1,107 @@
+/**
+ * Copyright (c) 2019 DENSO CORPORATION.
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/**
+ * State explorer implementation class header
+ */
+
+#ifndef RBASTATEEXPLORERIMPL_HPP
+#define RBASTATEEXPLORERIMPL_HPP
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+#include "RBAStateExplorer.hpp"
+#include "RBAModel.hpp"
+
+namespace rba
+{
+
+class RBAArbitrator;
+class RBAResult;
+
+class RBAStateExplorer::Impl
+{
+ public:
+  Impl()=default;
+  Impl(const Impl&)=delete;
+  Impl(const Impl&&)=delete;
+  Impl& operator=(const Impl&)=delete;
+  Impl& operator=(const Impl&&)=delete;
+  virtual ~Impl()=default;
+
+  bool load(const std::string& modelFilename);
+  RBAExplorationReport explore(const RBAExplorationOption& option);
+
+ private:
+  // Request of a step of a trace
+  struct Input
+  {
+    std::string context;
+    bool require {true};
+    // Scene property set with the scene of context, if not empty
+    std::string property;
+    std::int32_t value {0};
+  };
+  // Trace is the indexes of inputs_
+  using Trace = std::vector<std::size_t>;
+  struct Violation
+  {
+    bool runtime {false};
+    // Index of the trace that first failed the constraint
+    std::uint64_t traceIndex {0U};
+    Trace trace;
+  };
+  // Findings of a thread, merged into the report after the threads
+  struct Findings
+  {
+    std::uint64_t traceCount {0U};
+    std::uint64_t stepCount {0U};
+    std::map<std::string, Violation> violations;
+    std::int32_t deepestNest {0};
+    Trace deepestTrace;
+    std::int64_t slowestMicroseconds {0};
+    Trace slowestTrace;
+  };
+
+  void createInputs(const RBAModel& model, const std::int32_t maxPropertyValue);
+  Trace createTrace(const RBAExplorationOption& option,
+                    const std::uint64_t index) const;
+  void runTrace(RBAArbitrator& arb, const std::uint64_t traceIndex,
+                const Trace& trace, Findings& findings) const;
+  bool failsConstraint(RBAArbitrator& arb, const Trace& trace,
+                       const std::string& constraint) const;
+  Trace minimize(RBAArbitrator& arb, const Trace& trace,
+                 const std::string& constraint) const;
+  std::int64_t execute(RBAArbitrator& arb, const std::size_t input,
+                       std::unique_ptr<RBAResult>& result) const;
+  std::vector<std::string> format(const Trace& trace) const;
+  static void merge(const Findings& findings, Findings& total);
+
+ private:
+  std::string modelFilename_;
+  // Model of each thread
+  std::vector<std::unique_ptr<RBAModel>> models_;
+  std::vector<Input> inputs_;
+
+};
+
+}
+
+#endif
@@ -27,6 +27,7 @@
 #include "RBAConstraintImpl.hpp"
 #include "RBAConstraintInfo.hpp"
 #include "RBAConstraintMap.hpp"
+#include "RBAInputRecorder.hpp"
 
 namespace rba
 {
@@ -35,6 +36,7 @@ RBAAllocatable::RBAAllocatable(const std::string& name)
   : RBARuleObject{name},
     RBAAbstractAllocatable{name}
 {
+  setDerivedObject(this);
 }
 
 void RBAAllocatable::clearStatus()
@@ -253,9 +255,43 @@ bool RBAAllocatable::hasConstraint(const RBAConstraintImpl* const constraint) co
   return false;
 }
 
+std::list<RBAConstraintImpl*>&
+RBAAllocatable::getConstraintList(const RBAConstraintMap kind)
+{
+  if (kind == RBAConstraintMap::CONTENT_ALLOCATE_CONSTRAINTS) {
+    return constraints_;
+  } else if (kind == RBAConstraintMap::HIDDEN_TRUE_CHECK_CONSTRAINTS) {
+    return hiddenTrueCheckConstraints_;
+  } else if (kind == RBAConstraintMap::HIDDEN_FALSE_CHECK_CONSTRAINTS) {
+    return hiddenFalseCheckConstraints_;
+  } else if (kind == RBAConstraintMap::ATTENUATE_TRUE_CHECK_CONSTRAINTS) {
+    return attenuateTrueCheckConstraints_;
+  } else {
+    return attenuateFalseCheckConstraints_;
+  }
+}
+
+/**
+ * @return constraints of the kind, which are kept in the contiguous table
+ *         created by RBAModelImpl::createSortedAllocatables()
+ */
+RBAElementArray<RBAConstraintImpl*>
+RBAAllocatable::getConstraintArray(const RBAConstraintMap kind) const
+{
+  return constraintArrays_[static_cast<std::size_t>(kind)];
+}
+
+void
+RBAAllocatable::setConstraintArray(const RBAConstraintMap kind,
+                                   const RBAElementArray<RBAConstraintImpl*>& constraints)
+{
+  constraintArrays_[static_cast<std::size_t>(kind)] = constraints;
+}
+
 bool
 RBAAllocatable::isChecked() const
 {
+  RBAInputRecorder::recordValue(RBAInputType::CHECKED, this, checked_);
   return checked_;
 }
 
@@ -268,6 +304,7 @@ RBAAllocatable::setChecked(const bool checked)
 bool
 RBAAllocatable::isHiddenChecked() const
 {
+  RBAInputRecorder::recordValue(RBAInputType::HIDDEN_CHECKED, this, hiddenChecked_);
   return hiddenChecked_;
 }
 
@@ -280,6 +317,7 @@ RBAAllocatable::setHiddenChecked(const bool hiddenChecked)
 bool
 RBAAllocatable::isAttenuateChecked() const
 {
+  RBAInputRecorder::recordValue(RBAInputType::ATTENUATE_CHECKED, this, attenuateChecked_);
   return attenuateChecked_;
 }
 
@@ -292,6 +330,7 @@ RBAAllocatable::setAttenuateChecked(const bool attenuateChecked)
 bool
 RBAAllocatable::isAttenuated() const
 {
+  RBAInputRecorder::recordValue(RBAInputType::ATTENUATED, this, attenuated_);
   return attenuated_;
 }
 
@@ -304,6 +343,7 @@ RBAAllocatable::setAttenuated(const bool attenuated)
 bool
 RBAAllocatable::isHidden() const
 {
+  RBAInputRecorder::recordValue(RBAInputType::HIDDEN, this, hidden_);
   return hidden_;
 }
 
@@ -316,6 +356,7 @@ RBAAllocatable::setHidden(const bool hidden)
 const RBAContentState*
 RBAAllocatable::getState() const
 {
+  RBAInputRecorder::recordState(RBAInputType::STATE, this, state_);
   return state_;
 }
 
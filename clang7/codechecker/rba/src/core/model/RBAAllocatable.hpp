@@ -21,8 +21,10 @@
 #ifndef RBAALLOCATABLE_HPP
 #define RBAALLOCATABLE_HPP
 
+#include <array>
 #include "RBAAbstractAllocatable.hpp"
 #include "RBAArbitrationPolicy.hpp"
+#include "RBAElementArray.hpp"
 
 namespace rba
 {
@@ -70,7 +72,11 @@ public:
   std::list<RBAConstraintImpl*>& getHiddenFalseCheckConstraints();
   std::list<RBAConstraintImpl*>& getAttenuateTrueCheckConstraints();
   std::list<RBAConstraintImpl*>& getAttenuateFalseCheckConstraints();
+  std::list<RBAConstraintImpl*>& getConstraintList(const RBAConstraintMap kind);
   bool hasConstraint(const RBAConstraintImpl* const constraint) const;
+  RBAElementArray<RBAConstraintImpl*> getConstraintArray(const RBAConstraintMap kind) const;
+  void setConstraintArray(const RBAConstraintMap kind,
+                          const RBAElementArray<RBAConstraintImpl*>& constraints);
 
   bool isChecked() const;
   void setChecked(const bool checked);
@@ -100,6 +106,8 @@ public:
 protected:
   // Zone should be a Z-order below the minimum Area
   const static std::int32_t ZONE_ZORDER = -2;
+  // Number of the kinds of RBAConstraintMap
+  const static std::size_t CONSTRAINT_MAP_COUNT = 5U;
 
 private:
 #ifdef _MSC_VER
@@ -112,6 +120,8 @@ private:
   std::list<RBAConstraintImpl*> hiddenFalseCheckConstraints_;
   std::list<RBAConstraintImpl*> attenuateTrueCheckConstraints_;
   std::list<RBAConstraintImpl*> attenuateFalseCheckConstraints_;
+  // Rows of the constraint table of the model for each RBAConstraintMap
+  std::array<RBAElementArray<RBAConstraintImpl*>, CONSTRAINT_MAP_COUNT> constraintArrays_;
 #ifdef _MSC_VER
 #pragma warning(pop)
 #endif
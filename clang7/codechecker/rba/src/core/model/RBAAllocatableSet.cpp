@@ -28,6 +28,7 @@ RBAAllocatableSet::RBAAllocatableSet(const std::string& name)
   : RBARuleObject{name},
     RBAAbstractAllocatable{name}
 {
+  setDerivedObject(this);
 }
 
 void
@@ -20,12 +20,29 @@
 
 #include "RBAConstraintImpl.hpp"
 
+#include "RBAAllocatable.hpp"
+#include "RBAConstraintInfo.hpp"
 #include "RBAExpression.hpp"
 #include "RBALogManager.hpp"
 
 namespace rba
 {
 
+namespace
+{
+
+// Number of short-circuit evaluations before the statistics are used
+const std::uint32_t SHORT_CIRCUIT_WARMUP {16U};
+// A constraint that is rarely decided by the short-circuit evaluation
+// tries it again once in this number of checks
+const std::uint32_t SHORT_CIRCUIT_RETRY {64U};
+// Upper limit of the statistics. Older results are halved.
+const std::uint32_t SHORT_CIRCUIT_HISTORY {1024U};
+// Number of evaluation results kept for each constraint
+const std::size_t CACHE_SIZE {8U};
+
+}
+
 RBAConstraintImpl::RBAConstraintImpl(const std::string& name)
   : RBAConstraint(),
     RBAAbstractConstraint{name}
@@ -67,7 +84,17 @@ RBAConstraintImpl::execute(RBAArbitratorImpl* const arb)
 
   clearInfo();
 
-  bool res {getExpression()->execute(getInfo(), arb)};
+  bool res {false};
+#ifdef RBA_USE_LOG
+  // The compiled code does not output logs
+  if ((compiled_ != nullptr) && (RBALogManager::getLogManager() == nullptr)) {
+#else
+  if (compiled_ != nullptr) {
+#endif
+    res = compiled_(getInfo(), arb, compiledNodes_.data());
+  } else {
+    res = getExpression()->execute(getInfo(), arb);
+  }
 #ifdef RBA_USE_LOG
   std::string log = "    constraint expression[" + getExpression()->getExpressionText();
 
@@ -93,4 +120,186 @@ RBAConstraintImpl::execute(RBAArbitratorImpl* const arb)
   return res;
 }
 
+/**
+ * Replace the evaluation of the expression with compiled code
+ * @param compiled compiled function
+ * @param nodes model objects that the compiled function refers to
+ */
+void
+RBAConstraintImpl::setCompiled(const RBACompiledConstraint compiled,
+                               const std::vector<const void*>& nodes)
+{
+  compiled_ = compiled;
+  compiledNodes_ = nodes;
+}
+
+void
+RBAConstraintImpl::clearCompiled()
+{
+  compiled_ = nullptr;
+  compiledNodes_.clear();
+}
+
+bool
+RBAConstraintImpl::isCompiled() const
+{
+  return (compiled_ != nullptr);
+}
+
+/**
+ * Whether the arbitrator should evaluate this constraint with the
+ * short-circuit evaluation first
+ * The short-circuit evaluation is useful only if it often decides that the
+ * constraint is satisfied, because otherwise the constraint is evaluated
+ * again to collect the allocatables.
+ */
+bool
+RBAConstraintImpl::usesShortCircuit()
+{
+  // The compiled code always evaluates all operands
+  if (compiled_ != nullptr) {
+    return false;
+  }
+  checkCount_++;
+  if ((shortCircuitCount_ < SHORT_CIRCUIT_WARMUP)
+      || ((decidedCount_ * 2U) >= shortCircuitCount_)) {
+    return true;
+  }
+  return ((checkCount_ % SHORT_CIRCUIT_RETRY) == 0U);
+}
+
+/**
+ * Add the result of a short-circuit evaluation
+ * @param decided true if the result was used without the full evaluation
+ */
+void
+RBAConstraintImpl::addShortCircuitResult(const bool decided)
+{
+  shortCircuitCount_++;
+  if (decided) {
+    decidedCount_++;
+  }
+  if (shortCircuitCount_ >= SHORT_CIRCUIT_HISTORY) {
+    shortCircuitCount_ /= 2U;
+    decidedCount_ /= 2U;
+  }
+}
+
+/**
+ * Search an evaluation result whose inputs have not changed
+ * The ConstraintInfo of the result is set to this constraint.
+ * @param result result of the arbitrator, which has the requests and
+ *               the previous result
+ * @param isPassed result of execute()
+ * @return false if no result can be used
+ */
+bool
+RBAConstraintImpl::findCachedResult(const RBAResultImpl* const result,
+                                    bool& isPassed)
+{
+  // Search from the newest entry
+  for (std::size_t i {0U}; i < cache_.size(); i++) {
+    const CacheEntry& entry
+      {cache_[(nextCacheEntry_ + cache_.size() - 1U - i) % cache_.size()]};
+    if (RBAInputRecorder::isUnchanged(entry.inputs, result)) {
+      getInfo()->copyResult(*entry.info);
+      isPassed = entry.isPassed;
+      return true;
+    }
+  }
+  return false;
+}
+
+/**
+ * Keep the result of the last execute()
+ * @param recorder recorder that recorded the inputs of execute()
+ * @param inputsBegin position of the recorder before execute()
+ * @param isPassed result of execute()
+ */
+void
+RBAConstraintImpl::storeResult(const RBAInputRecorder& recorder,
+                               const std::size_t inputsBegin,
+                               const bool isPassed)
+{
+  if (cache_.size() < CACHE_SIZE) {
+    cache_.emplace_back();
+    nextCacheEntry_ = cache_.size() - 1U;
+  }
+  CacheEntry& entry {cache_[nextCacheEntry_]};
+  recorder.getInputs(inputsBegin, entry.inputs);
+  entry.info = getInfo()->shareResult();
+  entry.isPassed = isPassed;
+  nextCacheEntry_ = (nextCacheEntry_ + 1U) % CACHE_SIZE;
+}
+
+/**
+ * Set the allocatables that the constraint can affect
+ * They are the allocatables that can be put in the ConstraintInfo when
+ * the constraint is evaluated, which are found from the model when it
+ * is loaded. The set may contain more allocatables than the evaluation
+ * puts, but never less.
+ * @param allocatables allocatables sorted by the index
+ * @param allocatableCount number of the allocatables of the model
+ */
+void
+RBAConstraintImpl::setAffectAllocatables(
+    const std::vector<const RBAAllocatable*>& allocatables,
+    const std::size_t allocatableCount)
+{
+  affectAllocatables_ = allocatables;
+  affectIndexes_.resize(allocatableCount);
+  for (const RBAAllocatable* const allocatable : allocatables) {
+    affectIndexes_.set(static_cast<std::size_t>(allocatable->getIndex()));
+  }
+  hasAffectAllocatables_ = true;
+}
+
+/**
+ * @return false if the allocatables that the constraint can affect are
+ *         unknown, in which case the constraint can affect any allocatable
+ */
+bool
+RBAConstraintImpl::hasAffectAllocatables() const
+{
+  return hasAffectAllocatables_;
+}
+
+const std::vector<const RBAAllocatable*>&
+RBAConstraintImpl::getAffectAllocatables() const
+{
+  return affectAllocatables_;
+}
+
+/**
+ * @return false if the ConstraintInfo never contains allocatable
+ */
+bool
+RBAConstraintImpl::mayAffect(const RBAAllocatable* const allocatable) const
+{
+  return (!hasAffectAllocatables_
+          || affectIndexes_.test(static_cast<std::size_t>(allocatable->getIndex())));
+}
+
+/**
+ * @return false if the ConstraintInfo never contains an allocatable
+ *         other than allocatable
+ */
+bool
+RBAConstraintImpl::mayAffectOtherThan(const RBAAllocatable* const allocatable) const
+{
+  return (!hasAffectAllocatables_
+          || affectIndexes_.anyExcept(static_cast<std::size_t>(allocatable->getIndex())));
+}
+
+/**
+ * @return false if the ConstraintInfo never contains an allocatable
+ *         whose priority is lower than allocatable
+ */
+bool
+RBAConstraintImpl::mayAffectLowerThan(const RBAAllocatable* const allocatable) const
+{
+  return (!hasAffectAllocatables_
+          || affectIndexes_.anyAbove(static_cast<std::size_t>(allocatable->getIndex())));
+}
+
 }
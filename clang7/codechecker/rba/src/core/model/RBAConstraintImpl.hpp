@@ -21,13 +21,29 @@
 #ifndef RBACONSTRAINTIMPL_HPP
 #define RBACONSTRAINTIMPL_HPP
 
+#include <cstdint>
+#include <memory>
+#include <vector>
 #include "RBAConstraint.hpp"
 #include "RBAAbstractConstraint.hpp"
+#include "RBABitSet.hpp"
+#include "RBAInputRecorder.hpp"
 
 namespace rba
 {
 
+class RBAAllocatable;
 class RBAArbitratorImpl;
+class RBAConstraintInfo;
+class RBAResultImpl;
+
+/// Constraint expression compiled to native code by rbaconstraintgen
+/// @param info constraint information of the root expression
+/// @param arb arbitrator
+/// @param nodes model objects referenced by the compiled code
+using RBACompiledConstraint = bool (*)(RBAConstraintInfo* const info,
+                                       RBAArbitratorImpl* const arb,
+                                       const void* const* const nodes);
 
 class DLL_EXPORT RBAConstraintImpl : public RBAConstraint,
                                      public RBAAbstractConstraint
@@ -46,9 +62,55 @@ public:
   bool isConstraint() const override;
   bool isRuntime() const;
   bool execute(RBAArbitratorImpl* const arb);
+  void setCompiled(const RBACompiledConstraint compiled,
+                   const std::vector<const void*>& nodes);
+  void clearCompiled();
+  bool isCompiled() const;
+  bool usesShortCircuit();
+  void addShortCircuitResult(const bool decided);
+  bool findCachedResult(const RBAResultImpl* const result, bool& isPassed);
+  void storeResult(const RBAInputRecorder& recorder,
+                   const std::size_t inputsBegin, const bool isPassed);
+  void setAffectAllocatables(const std::vector<const RBAAllocatable*>& allocatables,
+                             const std::size_t allocatableCount);
+  bool hasAffectAllocatables() const;
+  const std::vector<const RBAAllocatable*>& getAffectAllocatables() const;
+  bool mayAffect(const RBAAllocatable* const allocatable) const;
+  bool mayAffectOtherThan(const RBAAllocatable* const allocatable) const;
+  bool mayAffectLowerThan(const RBAAllocatable* const allocatable) const;
+
+private:
+  // Result of an evaluation and the inputs that it read
+  struct CacheEntry
+  {
+    std::vector<RBAInput> inputs;
+    std::shared_ptr<RBAConstraintInfo> info;
+    bool isPassed {false};
+  };
 
 private:
   bool runtime_ {RUNTIME_EDEFAULT};
+  RBACompiledConstraint compiled_ {nullptr};
+  // Statistics of the short-circuit evaluation
+  std::uint32_t checkCount_ {0U};
+  std::uint32_t shortCircuitCount_ {0U};
+  std::uint32_t decidedCount_ {0U};
+  // Entry of cache_ to be replaced next
+  std::size_t nextCacheEntry_ {0U};
+  // false until the allocatables that the constraint can affect are given
+  bool hasAffectAllocatables_ {false};
+  // Indexes of affectAllocatables_
+  RBABitSet affectIndexes_;
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable:4251)
+#endif
+  std::vector<const void*> compiledNodes_;
+  std::vector<CacheEntry> cache_;
+  std::vector<const RBAAllocatable*> affectAllocatables_;
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
 };
 
 }
@@ -31,6 +31,7 @@ RBAContent::RBAContent(const std::string& name)
   : RBARuleObject{name},
     RBAAbstractContent{name}
 {
+  setDerivedObject(this);
 }
 
 bool
@@ -69,6 +70,22 @@ RBAContent::addAllocatable(const RBAAllocatable* const alloc)
   allocatableSet_->addTarget(alloc);
 }
 
+/**
+ * @return same allocatables as getAllocatables(), which are kept in the
+ *         contiguous table created by RBAModelImpl::createSortedAllocatables()
+ */
+RBAElementArray<const RBAAllocatable*>
+RBAContent::getAllocatableArray() const
+{
+  return allocatableArray_;
+}
+
+void
+RBAContent::setAllocatableArray(const RBAElementArray<const RBAAllocatable*>& allocatables)
+{
+  allocatableArray_ = allocatables;
+}
+
 RBAContentLoserType
 RBAContent::getContentLoserType() const
 {
@@ -26,6 +26,7 @@
 #include "RBAAbstractContent.hpp"
 #include "RBAAllocatableSet.hpp"
 #include "RBAContentLoserType.hpp"
+#include "RBAElementArray.hpp"
 
 namespace rba
 {
@@ -56,6 +57,8 @@ public:
   void addState(const RBAContentState* const state);
   const std::list<const RBAAllocatable*>& getAllocatables() const;
   void addAllocatable(const RBAAllocatable* const alloc);
+  RBAElementArray<const RBAAllocatable*> getAllocatableArray() const;
+  void setAllocatableArray(const RBAElementArray<const RBAAllocatable*>& allocatables);
   RBAContentLoserType getContentLoserType() const;
   void setLoserType(const RBAContentLoserType newLoserType);
   const RBAAllocatableSet* getAllocatableSet() const;
@@ -75,6 +78,8 @@ private:
 #endif
   std::list<const RBAContentState*> states_;
   std::unique_ptr<RBAAllocatableSet> allocatableSet_ {std::make_unique<RBAAllocatableSet>()};
+  // Row of the content-allocatable table of the model
+  RBAElementArray<const RBAAllocatable*> allocatableArray_;
 #ifdef _MSC_VER
 #pragma warning(pop)
 #endif
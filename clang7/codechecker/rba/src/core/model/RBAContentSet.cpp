@@ -29,6 +29,7 @@ RBAContentSet::RBAContentSet(const std::string& name)
   : RBARuleObject{name},
     RBAAbstractContent{name}
 {
+  setDerivedObject(this);
 }
 
 void
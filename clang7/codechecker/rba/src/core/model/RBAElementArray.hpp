@@ -0,0 +1,81 @@
+/**
+ * Copyright (c) 2019 DENSO CORPORATION.
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/**
+ * Element array class header
+ *
+ * Read-only view of a part of a contiguous array owned by the model.
+ * The model keeps the adjacency of its elements, such as the allocatables
+ * of each content, as one array for all elements, and each element refers
+ * to its row with this class.
+ */
+
+#ifndef RBAELEMENTARRAY_HPP
+#define RBAELEMENTARRAY_HPP
+
+#include <cstddef>
+
+namespace rba
+{
+
+template<typename T>
+class RBAElementArray
+{
+public:
+  RBAElementArray()=default;
+  RBAElementArray(const T* const data, const std::size_t size)
+    : data_{data},
+      size_{size}
+  {
+  }
+  RBAElementArray(const RBAElementArray&)=default;
+  RBAElementArray(RBAElementArray&&)=default;
+  RBAElementArray& operator=(const RBAElementArray&)=default;
+  RBAElementArray& operator=(RBAElementArray&&)=default;
+  ~RBAElementArray()=default;
+
+public:
+  const T* begin() const
+  {
+    return data_;
+  }
+  const T* end() const
+  {
+    return data_ + size_;
+  }
+  std::size_t size() const
+  {
+    return size_;
+  }
+  bool empty() const
+  {
+    return (size_ == 0U);
+  }
+  const T& operator[](const std::size_t index) const
+  {
+    return data_[index];
+  }
+
+private:
+  const T* data_ {nullptr};
+  std::size_t size_ {0U};
+
+};
+
+}
+
+#endif
@@ -0,0 +1,77 @@
+/**
+ * Copyright (c) 2019 DENSO CORPORATION.
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/**
+ * Element cast class header
+ *
+ * Casts between the model element classes without RTTI. The caller
+ * checks the type of the object with the type tag of the element, such
+ * as isModelElementType() or isArea(), before the cast. If RBA_CHECK_CAST
+ * is defined, the result is compared with dynamic_cast.
+ */
+
+#ifndef RBAELEMENTCAST_HPP
+#define RBAELEMENTCAST_HPP
+
+#ifdef RBA_CHECK_CAST
+#include <cassert>
+#endif
+
+namespace rba
+{
+
+class RBAElementCast
+{
+public:
+  RBAElementCast()=delete;
+  RBAElementCast(const RBAElementCast&)=delete;
+  RBAElementCast(const RBAElementCast&&)=delete;
+  RBAElementCast& operator=(const RBAElementCast&)=delete;
+  RBAElementCast& operator=(const RBAElementCast&&)=delete;
+  ~RBAElementCast()=delete;
+
+public:
+  /**
+   * static_cast to a derived class
+   * @param obj object whose type has been checked
+   */
+  template<typename T, typename S>
+  static T staticCast(S* const obj)
+  {
+    return verify<T>(static_cast<T>(obj), obj);
+  }
+
+  /**
+   * @param result object of the derived class found without RTTI
+   * @param obj source object
+   * @return result
+   */
+  template<typename T, typename S>
+  static T verify(const T result, S* const obj)
+  {
+#ifdef RBA_CHECK_CAST
+    assert(result == dynamic_cast<T>(obj));
+#endif
+    static_cast<void>(obj);
+    return result;
+  }
+
+};
+
+}
+
+#endif
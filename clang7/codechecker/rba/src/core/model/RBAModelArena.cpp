@@ -0,0 +1,124 @@
+/**
+ * Copyright (c) 2019 DENSO CORPORATION.
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/**
+ * Model arena class
+ */
+
+#include <new>
+#include "RBAModelArena.hpp"
+
+namespace rba
+{
+
+namespace
+{
+
+// Size of a chunk. A larger block gets a chunk of its own.
+const std::size_t CHUNK_SIZE {64U * 1024U};
+// Every block starts with a header that holds the arena of the block
+// (nullptr for the heap), so that deallocate() knows where it came from.
+// The header keeps the alignment of the block.
+const std::size_t HEADER_SIZE {alignof(std::max_align_t)};
+
+// Arena of the innermost Scope of the thread
+thread_local RBAModelArena* currentArena {nullptr};
+
+std::size_t alignSize(const std::size_t size)
+{
+  return (size + HEADER_SIZE - 1U) & ~(HEADER_SIZE - 1U);
+}
+
+}
+
+RBAModelArena::Scope::Scope(RBAModelArena* const arena)
+  : previous_{currentArena}
+{
+  currentArena = arena;
+}
+
+RBAModelArena::Scope::~Scope() noexcept
+{
+  currentArena = previous_;
+}
+
+/**
+ * Allocate the memory of an element
+ * @param size size of the element
+ * @return memory in the arena of the current scope, or in the heap if
+ *         there is no scope
+ */
+void*
+RBAModelArena::allocate(const std::size_t size)
+{
+  RBAModelArena* const arena {currentArena};
+  const std::size_t blockSize {HEADER_SIZE + alignSize(size)};
+  void* const block {(arena != nullptr) ? arena->allocateBlock(blockSize)
+                                        : ::operator new(blockSize)};
+  *static_cast<RBAModelArena**>(block) = arena;
+  return static_cast<char*>(block) + HEADER_SIZE;
+}
+
+/**
+ * Release the memory of an element
+ * The memory in an arena is kept until the arena is destroyed.
+ */
+void
+RBAModelArena::deallocate(void* const ptr)
+{
+  if (ptr == nullptr) {
+    return;
+  }
+  void* const block {static_cast<char*>(ptr) - HEADER_SIZE};
+  if (*static_cast<RBAModelArena**>(block) == nullptr) {
+    ::operator delete(block);
+  }
+}
+
+std::size_t
+RBAModelArena::getSize() const
+{
+  return size_;
+}
+
+// @Deviation (A18-5-2)
+//  [Contents that deviate from the rules]
+//   Operators new and delete shall not be called explicitly.
+//  [Explain that it is okay to deviate from the rules]
+//   The chunks are owned by unique_ptr. They are not value-initialized,
+//   because the elements are constructed in them.
+void*
+RBAModelArena::allocateBlock(const std::size_t size)
+{
+  size_ += size;
+  if (size > rest_) {
+    if (size > (CHUNK_SIZE / 4U)) {
+      // Keep the rest of the current chunk for the following blocks
+      chunks_.push_back(std::unique_ptr<char[]>{new char[size]});
+      return chunks_.back().get();
+    }
+    chunks_.push_back(std::unique_ptr<char[]>{new char[CHUNK_SIZE]});
+    next_ = chunks_.back().get();
+    rest_ = CHUNK_SIZE;
+  }
+  char* const block {next_};
+  next_ += size;
+  rest_ -= size;
+  return block;
+}
+
+}
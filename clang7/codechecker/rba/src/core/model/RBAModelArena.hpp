@@ -0,0 +1,97 @@
+/**
+ * Copyright (c) 2019 DENSO CORPORATION.
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/**
+ * Model arena class header
+ */
+
+#ifndef RBAMODELARENA_HPP
+#define RBAMODELARENA_HPP
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+#include "RBADllExport.hpp"
+
+namespace rba
+{
+
+/**
+ * Monotonic memory of the elements of one model
+ * While a Scope is alive, the model elements created on the thread are
+ * placed one after another in the arena of the scope, so the nodes of a
+ * constraint tree are next to each other. The memory is released all at
+ * once when the arena is destroyed. Elements created out of a scope use
+ * the usual heap.
+ */
+class DLL_EXPORT RBAModelArena
+{
+public:
+  /**
+   * Makes an arena the destination of the elements created on the thread
+   * until the scope ends
+   */
+  class DLL_EXPORT Scope
+  {
+  public:
+    explicit Scope(RBAModelArena* const arena);
+    Scope(const Scope&)=delete;
+    Scope(const Scope&&)=delete;
+    Scope& operator=(const Scope&)=delete;
+    Scope& operator=(const Scope&&)=delete;
+    ~Scope() noexcept;
+
+  private:
+    RBAModelArena* const previous_;
+  };
+
+public:
+  RBAModelArena()=default;
+  RBAModelArena(const RBAModelArena&)=delete;
+  RBAModelArena(const RBAModelArena&&)=delete;
+  RBAModelArena& operator=(const RBAModelArena&)=delete;
+  RBAModelArena& operator=(const RBAModelArena&&)=delete;
+  ~RBAModelArena() noexcept=default;
+
+public:
+  static void* allocate(const std::size_t size);
+  static void deallocate(void* const ptr);
+  std::size_t getSize() const;
+
+private:
+  void* allocateBlock(const std::size_t size);
+
+private:
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable:4251)
+#endif
+  std::vector<std::unique_ptr<char[]>> chunks_;
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+  // Unused part of the last chunk
+  char* next_ {nullptr};
+  std::size_t rest_ {0U};
+  // Total size of the blocks given by allocateBlock()
+  std::size_t size_ {0U};
+
+};
+
+}
+
+#endif
@@ -18,11 +18,31 @@
  */
 
 #include "RBAModelElement.hpp"
+#include "RBAModelArena.hpp"
 #include "RBAModelElementType.hpp"
 
+#ifdef RBA_CHECK_CAST
+#include <cassert>
+#endif
+
 namespace rba
 {
 
+/**
+ * Elements are placed in the arena of the model while it is loaded
+ */
+void*
+RBAModelElement::operator new(const std::size_t size)
+{
+  return RBAModelArena::allocate(size);
+}
+
+void
+RBAModelElement::operator delete(void* const ptr)
+{
+  RBAModelArena::deallocate(ptr);
+}
+
 void RBAModelElement::clearStatus()
 {
   // This function is called from a ModelElement that has no internal state 
@@ -41,7 +61,27 @@ RBAModelElement::getModelElementType() const
 bool
 RBAModelElement::isModelElementType(const RBAModelElementType elemType) const
 {
-  return (elemType == getModelElementType());
+  return (elemType == getElementType());
+}
+
+/**
+ * Type tag of the element
+ * It is the same as getModelElementType(), which is kept after the first
+ * call so that the hot paths do not call the virtual function each time.
+ * The type never changes after the element is constructed.
+ */
+RBAModelElementType
+RBAModelElement::getElementType() const
+{
+  RBAModelElementType type {elementType_.load(std::memory_order_relaxed)};
+  if (type == RBAModelElementType::None) {
+    type = getModelElementType();
+    elementType_.store(type, std::memory_order_relaxed);
+  }
+#ifdef RBA_CHECK_CAST
+  assert(type == getModelElementType());
+#endif
+  return type;
 }
 
 }
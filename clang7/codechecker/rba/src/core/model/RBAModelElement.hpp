@@ -20,14 +20,15 @@
 #ifndef RBAMODELELEMENT_HPP
 #define RBAMODELELEMENT_HPP
 
+#include <atomic>
+#include <cstddef>
 #include <cstdint>
 #include "RBADllExport.hpp"
+#include "RBAModelElementType.hpp"
 
 namespace rba
 {
 
-enum class RBAModelElementType : std::uint8_t;
-
 class DLL_EXPORT RBAModelElement
 {
 protected:
@@ -40,10 +41,26 @@ protected:
 public:
   virtual ~RBAModelElement()=default;
 
+public:
+  static void* operator new(const std::size_t size);
+  static void operator delete(void* const ptr);
+
 public:
   virtual void clearStatus();
   virtual RBAModelElementType getModelElementType() const;
   bool isModelElementType(const RBAModelElementType elemType) const;
+  RBAModelElementType getElementType() const;
+
+private:
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable:4251)
+#endif
+  // getModelElementType() of the first call of getElementType()
+  mutable std::atomic<RBAModelElementType> elementType_ {RBAModelElementType::None};
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
 
 };
 
@@ -108,6 +108,7 @@ enum class RBAModelElementType : std::uint8_t
   Undisplayed,
   IsTypeOfOperator,
   Displayed,
+  ConstantExpression,
   None
 };
 
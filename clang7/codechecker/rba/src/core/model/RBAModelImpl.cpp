@@ -18,6 +18,8 @@
 
 #include "RBAModelImpl.hpp"
 #include "RBAConstraintImpl.hpp"
+#include "RBAConstraintMap.hpp"
+#include "RBAConstraintPlugin.hpp"
 #include "RBAAreaSet.hpp"
 #include "RBAZoneSet.hpp"
 #include "RBAViewContentSet.hpp"
@@ -26,9 +28,17 @@
 namespace rba
 {
 
+RBAModelImpl::RBAModelImpl()=default;
+RBAModelImpl::~RBAModelImpl()=default;
+
 const RBAContentState*
 RBAModelImpl::findContentState(const std::string& stateName)
 {
+  const RBANameIndex& nameIndex {getNameIndex()};
+  if(nameIndex.isBuilt()) {
+    const RBANameIndexEntry* const entry {nameIndex.find(stateName)};
+    return (entry != nullptr) ? entry->contentState : nullptr;
+  }
   const auto elem = findModelElementImpl(stateName);
   auto contentState = dynamic_cast<const RBAContentState*>(elem);
   if (contentState == nullptr) {
@@ -287,50 +297,35 @@ void RBAModelImpl::clearElementsStatus()
 const RBAAllocatable*
 RBAModelImpl::findAllocatable(const std::string& allocatableName) const
 {
-  auto it = nameToObject_.find(allocatableName);
-  if(it != nameToObject_.end()) {
-    return dynamic_cast<const RBAAllocatable*>(it->second.get());
-  }
-
-  return nullptr;
+  return findElement(allocatableName, &RBANameIndexEntry::allocatable);
 }
 
 const RBAContent*
 RBAModelImpl::findContent(const std::string& contentName) const
 {
-  auto it = nameToObject_.find(contentName);
-  if(it != nameToObject_.end()) {
-    return dynamic_cast<const RBAContent*>(it->second.get());
-  }
-
-  return nullptr;
+  return findElement(contentName, &RBANameIndexEntry::content);
 }
 
 const RBAAreaImpl*
 RBAModelImpl::findAreaImpl(const std::string& areaName) const
 {
-  auto it = nameToObject_.find(areaName);
-  if(it != nameToObject_.end()) {
-    return dynamic_cast<const RBAAreaImpl*>(it->second.get());
-  }
-
-  return nullptr;
+  return findElement(areaName, &RBANameIndexEntry::area);
 }
   
 const RBAViewContentImpl*
 RBAModelImpl::findViewContentImpl(const std::string& contName) const
 {
-  auto it = nameToObject_.find(contName);
-  if(it != nameToObject_.end()) {
-    return dynamic_cast<const RBAViewContentImpl*>(it->second.get());
-  }
-
-  return nullptr;
+  return findElement(contName, &RBANameIndexEntry::viewContent);
 }
   
 const RBAViewContentStateImpl*
 RBAModelImpl::findViewContentStateImpl(const std::string& stateName) const
 {
+  const RBANameIndex& nameIndex {getNameIndex()};
+  if(nameIndex.isBuilt()) {
+    const RBANameIndexEntry* const entry {nameIndex.find(stateName)};
+    return (entry != nullptr) ? entry->viewContentState : nullptr;
+  }
   const RBAViewContentStateImpl* ret {nullptr};
   if(RBAViewContentState::isUniqueName(stateName)) {
     auto it = nameToObject_.find(stateName);
@@ -352,39 +347,29 @@ RBAModelImpl::findViewContentStateImpl(const std::string& stateName) const
 const RBASizeImpl*
 RBAModelImpl::findSizeImpl(const std::string& sizeName) const
 {
-  auto it = nameToObject_.find(sizeName);
-  if(it != nameToObject_.end()) {
-    return dynamic_cast<const RBASizeImpl*>(it->second.get());
-  }
-
-  return nullptr;
+  return findElement(sizeName, &RBANameIndexEntry::size);
 }
   
 const RBAZoneImpl*
 RBAModelImpl::findZoneImpl(const std::string& zoneName) const
 {
-  auto it = nameToObject_.find(zoneName);
-  if(it != nameToObject_.end()) {
-    return dynamic_cast<const RBAZoneImpl*>(it->second.get());
-  }
-
-  return nullptr;
+  return findElement(zoneName, &RBANameIndexEntry::zone);
 }
   
 const RBASoundContentImpl*
 RBAModelImpl::findSoundContentImpl(const std::string& contName) const
 {
-  auto it = nameToObject_.find(contName);
-  if(it != nameToObject_.end()) {
-    return dynamic_cast<const RBASoundContentImpl*>(it->second.get());
-  }
-
-  return nullptr;
+  return findElement(contName, &RBANameIndexEntry::soundContent);
 }
   
 const RBASoundContentStateImpl*
 RBAModelImpl::findSoundContentStateImpl(const std::string& stateName) const
 {
+  const RBANameIndex& nameIndex {getNameIndex()};
+  if(nameIndex.isBuilt()) {
+    const RBANameIndexEntry* const entry {nameIndex.find(stateName)};
+    return (entry != nullptr) ? entry->soundContentState : nullptr;
+  }
   const RBASoundContentStateImpl* ret {nullptr};
   if(RBASoundContentState::isUniqueName(stateName)) {
     auto it = nameToObject_.find(stateName);
@@ -406,34 +391,19 @@ RBAModelImpl::findSoundContentStateImpl(const std::string& stateName) const
 const RBASceneImpl*
 RBAModelImpl::findSceneImpl(const std::string& sceneName) const
 {
-  auto it = nameToObject_.find(sceneName);
-  if(it != nameToObject_.end()) {
-    return dynamic_cast<const RBASceneImpl*>(it->second.get());
-  }
-
-  return nullptr;
+  return findElement(sceneName, &RBANameIndexEntry::scene);
 }
 
 const RBADisplayImpl*
 RBAModelImpl::findDisplayImpl(const std::string& displayName) const
 {
-  auto it = nameToObject_.find(displayName);
-  if(it != nameToObject_.end()) {
-    return dynamic_cast<const RBADisplayImpl*>(it->second.get());
-  }
-
-  return nullptr;
+  return findElement(displayName, &RBANameIndexEntry::display);
 }
 
 const RBAModelElement*
 RBAModelImpl::findModelElementImpl(const std::string& elementName) const
 {
-  auto it = nameToObject_.find(elementName);
-  if(it != nameToObject_.end()) {
-    return dynamic_cast<const RBAModelElement*>(it->second.get());
-  }
-
-  return nullptr;
+  return findElement(elementName, &RBANameIndexEntry::element);
 }
 
 const std::list<const RBAAllocatable*>&
@@ -531,6 +501,179 @@ RBAModelImpl::createSortedAllocatables()
     allocatable->setIndex(index);
     index++;
   }
+
+  createElementTables();
+}
+
+/**
+ * Create the contiguous tables of the elements and their adjacency
+ * The rows of the adjacency are set to the contents and allocatables
+ * after each table has its final size, because they point into it.
+ */
+void
+RBAModelImpl::createElementTables()
+{
+  allocatableTable_.assign(sortedAllocatables_.begin(), sortedAllocatables_.end());
+  contentTable_.assign(contents_.begin(), contents_.end());
+  contentStateTable_.assign(contentStates_.begin(), contentStates_.end());
+
+  // content -> allocatables
+  std::vector<std::size_t> offsets;
+  offsets.reserve(contentTable_.size() + 1U);
+  contentAllocatables_.clear();
+  for(const RBAContent* const content : contentTable_) {
+    offsets.push_back(contentAllocatables_.size());
+    const std::list<const RBAAllocatable*>& allocs {content->getAllocatables()};
+    static_cast<void>(contentAllocatables_.insert(contentAllocatables_.end(),
+                                                  allocs.begin(), allocs.end()));
+  }
+  offsets.push_back(contentAllocatables_.size());
+  for(std::size_t i {0U}; i < contentTable_.size(); i++) {
+    const_cast<RBAContent*>(contentTable_[i])->setAllocatableArray(
+        RBAElementArray<const RBAAllocatable*>{contentAllocatables_.data() + offsets[i],
+                                               offsets[i + 1U] - offsets[i]});
+  }
+
+  // allocatable -> constraints of each kind
+  const std::array<RBAConstraintMap, 5U> kinds {{
+    RBAConstraintMap::CONTENT_ALLOCATE_CONSTRAINTS,
+    RBAConstraintMap::HIDDEN_TRUE_CHECK_CONSTRAINTS,
+    RBAConstraintMap::HIDDEN_FALSE_CHECK_CONSTRAINTS,
+    RBAConstraintMap::ATTENUATE_TRUE_CHECK_CONSTRAINTS,
+    RBAConstraintMap::ATTENUATE_FALSE_CHECK_CONSTRAINTS}};
+  offsets.clear();
+  allocatableConstraints_.clear();
+  for(RBAAllocatable* const allocatable : allocatableTable_) {
+    for(const RBAConstraintMap kind : kinds) {
+      offsets.push_back(allocatableConstraints_.size());
+      const std::list<RBAConstraintImpl*>& constraints {allocatable->getConstraintList(kind)};
+      static_cast<void>(allocatableConstraints_.insert(allocatableConstraints_.end(),
+                                                       constraints.begin(), constraints.end()));
+    }
+  }
+  offsets.push_back(allocatableConstraints_.size());
+  std::size_t row {0U};
+  for(RBAAllocatable* const allocatable : allocatableTable_) {
+    for(const RBAConstraintMap kind : kinds) {
+      allocatable->setConstraintArray(kind,
+          RBAElementArray<RBAConstraintImpl*>{allocatableConstraints_.data() + offsets[row],
+                                              offsets[row + 1U] - offsets[row]});
+      row++;
+    }
+  }
+}
+
+/**
+ * Set the constraint plugin
+ * The compiled code of the current plugin is removed from the constraints
+ * before the plugin is released.
+ * @param plugin plugin loaded for this model,
+ *               or nullptr to go back to the interpreter
+ */
+void
+RBAModelImpl::setConstraintPlugin(std::unique_ptr<RBAConstraintPlugin> plugin)
+{
+  if(constraintPlugin_ != nullptr) {
+    for(const RBAConstraintImpl* const constraint : constraints_) {
+      const_cast<RBAConstraintImpl*>(constraint)->clearCompiled();
+    }
+  }
+  constraintPlugin_ = std::move(plugin);
+  if(constraintPlugin_ != nullptr) {
+    constraintPlugin_->install(this);
+  }
+}
+
+void
+RBAModelImpl::setSharedExpressionCount(const std::uint32_t count)
+{
+  sharedExpressionCount_ = count;
+}
+
+std::uint32_t
+RBAModelImpl::getSharedExpressionCount() const
+{
+  return sharedExpressionCount_;
+}
+
+/**
+ * Create the name index
+ * The type conversion of each element is done here once,
+ * so that the find functions need neither string hashing of the whole
+ * map nor dynamic_cast.
+ * An element added afterwards makes the next lookup create it again.
+ */
+void
+RBAModelImpl::createNameIndex()
+{
+  const std::lock_guard<std::mutex> lock {nameIndexMutex_};
+  nameIndexEnabled_ = true;
+  buildNameIndex();
+  nameIndexStale_.store(false, std::memory_order_release);
+}
+
+/**
+ * Get the name index, creating it again if an element has been added
+ * since it was created
+ */
+const RBANameIndex&
+RBAModelImpl::getNameIndex() const
+{
+  if(nameIndexStale_.load(std::memory_order_acquire)) {
+    const std::lock_guard<std::mutex> lock {nameIndexMutex_};
+    if(nameIndexStale_.load(std::memory_order_relaxed)) {
+      buildNameIndex();
+      nameIndexStale_.store(false, std::memory_order_release);
+    }
+  }
+  return nameIndex_;
+}
+
+void
+RBAModelImpl::buildNameIndex() const
+{
+  std::vector<RBANameIndexEntry> entries;
+  entries.reserve(nameToObject_.size());
+  for(const auto& o : nameToObject_) {
+    RBANameIndexEntry entry;
+    RBAModelElement* const element {o.second.get()};
+    entry.name = &o.first;
+    entry.element = element;
+    entry.allocatable = dynamic_cast<const RBAAllocatable*>(element);
+    entry.content = dynamic_cast<const RBAContent*>(element);
+    entry.contentState = dynamic_cast<const RBAContentState*>(element);
+    entry.area = dynamic_cast<const RBAAreaImpl*>(element);
+    entry.viewContent = dynamic_cast<const RBAViewContentImpl*>(element);
+    entry.viewContentState = dynamic_cast<const RBAViewContentStateImpl*>(element);
+    entry.size = dynamic_cast<const RBASizeImpl*>(element);
+    entry.zone = dynamic_cast<const RBAZoneImpl*>(element);
+    entry.soundContent = dynamic_cast<const RBASoundContentImpl*>(element);
+    entry.soundContentState = dynamic_cast<const RBASoundContentStateImpl*>(element);
+    entry.scene = dynamic_cast<const RBASceneImpl*>(element);
+    entry.display = dynamic_cast<const RBADisplayImpl*>(element);
+    entry.constraint = dynamic_cast<RBAConstraintImpl*>(element);
+    entry.areaSet = dynamic_cast<const RBAAreaSet*>(element);
+    entry.zoneSet = dynamic_cast<const RBAZoneSet*>(element);
+    entry.viewContentSet = dynamic_cast<const RBAViewContentSet*>(element);
+    entry.soundContentSet = dynamic_cast<const RBASoundContentSet*>(element);
+    // A content name means its first state
+    if((entry.content != nullptr) && !(entry.content->getStates().empty())) {
+      const RBAContentState* const state {entry.content->getStates().front()};
+      entry.contentState = state;
+      if(entry.viewContent != nullptr) {
+        entry.viewContentState = dynamic_cast<const RBAViewContentStateImpl*>(state);
+      }
+      if(entry.soundContent != nullptr) {
+        entry.soundContentState = dynamic_cast<const RBASoundContentStateImpl*>(state);
+      }
+    }
+    if(entry.area != nullptr) {
+      entry.positionContainer = entry.area->getPositionContainer();
+    }
+    entries.push_back(entry);
+  }
+  // If no perfect hash is found, the find functions use nameToObject_
+  static_cast<void>(nameIndex_.build(entries));
 }
 
 std::list<RBAAllocatable*>&
@@ -539,67 +682,89 @@ RBAModelImpl::getSortedAllocatables()
   return sortedAllocatables_;
 }
 
+const std::vector<RBAAllocatable*>&
+RBAModelImpl::getAllocatableTable() const
+{
+  return allocatableTable_;
+}
+
+const std::vector<const RBAContent*>&
+RBAModelImpl::getContentTable() const
+{
+  return contentTable_;
+}
+
+const std::vector<const RBAContentState*>&
+RBAModelImpl::getContentStateTable() const
+{
+  return contentStateTable_;
+}
+
+/**
+ * Arena of the elements of the model
+ * The model elements created in a RBAModelArena::Scope of it are released
+ * with the model.
+ */
+RBAModelArena*
+RBAModelImpl::getArena()
+{
+  return &arena_;
+}
+
 RBAConstraintImpl*
 RBAModelImpl::findConstraintImpl(const std::string& consName) const
 {
-  auto it = nameToObject_.find(consName);
-  if(it != nameToObject_.end()) {
-    return dynamic_cast<RBAConstraintImpl*>(it->second.get());
-  }
-
-  return nullptr;
+  return findElement(consName, &RBANameIndexEntry::constraint);
 }
 
 const RBAAreaSet*
 RBAModelImpl::findAreaSetImpl(const std::string& areaSetName) const
 {
-  auto it = nameToObject_.find(areaSetName);
-  if(it != nameToObject_.end()) {
-    return dynamic_cast<const RBAAreaSet*>(it->second.get());
-  }
-
-  return nullptr;
+  return findElement(areaSetName, &RBANameIndexEntry::areaSet);
 }
 
 const RBAZoneSet*
 RBAModelImpl::findZoneSetImpl(const std::string& zoneSetName) const
 {
-  auto it = nameToObject_.find(zoneSetName);
-  if(it != nameToObject_.end()) {
-    return dynamic_cast<const RBAZoneSet*>(it->second.get());
-  }
-
-  return nullptr;
+  return findElement(zoneSetName, &RBANameIndexEntry::zoneSet);
 }
 
 const RBAViewContentSet*
 RBAModelImpl::findViewContentSetImpl(const std::string& contSetName) const
 {
-  auto it = nameToObject_.find(contSetName);
-  if(it != nameToObject_.end()) {
-    return dynamic_cast<const RBAViewContentSet*>(it->second.get());
-  }
-
-  return nullptr;
+  return findElement(contSetName, &RBANameIndexEntry::viewContentSet);
 }
 
 const RBASoundContentSet*
 RBAModelImpl::findSoundContentSetImpl(const std::string& contSetName) const
 {
-  auto it = nameToObject_.find(contSetName);
-  if(it != nameToObject_.end()) {
-    return dynamic_cast<const RBASoundContentSet*>(it->second.get());
+  return findElement(contSetName, &RBANameIndexEntry::soundContentSet);
+}
+
+const RBAPositionContainerImpl*
+RBAModelImpl::findPositionContainerImpl(const std::string& areaName) const
+{
+  const RBAAreaImpl* const area {findAreaImpl(areaName)};
+  if(area != nullptr) {
+    return area->getPositionContainer();
   }
 
   return nullptr;
 }
 
-const RBAPositionContainerImpl*
-RBAModelImpl::findPositionContainerImpl(const std::string& areaName) const
+template<typename T>
+T*
+RBAModelImpl::findElement(const std::string& name,
+                          T* RBANameIndexEntry::* const member) const
 {
-  auto it = areaNameToPositionContainer_.find(areaName);
-  if(it != areaNameToPositionContainer_.end()) {
-    return dynamic_cast<const RBAPositionContainerImpl*>(it->second);
+  const RBANameIndex& nameIndex {getNameIndex()};
+  if(nameIndex.isBuilt()) {
+    const RBANameIndexEntry* const entry {nameIndex.find(name)};
+    return (entry != nullptr) ? entry->*member : nullptr;
+  }
+  auto it = nameToObject_.find(name);
+  if(it != nameToObject_.end()) {
+    return dynamic_cast<T*>(it->second.get());
   }
 
   return nullptr;
@@ -652,6 +817,8 @@ RBAModelImpl::addNamedElement(std::unique_ptr<RBAModelElement> newElement)
 {
   RBANamedElement* const element {dynamic_cast<RBANamedElement*>(newElement.get())};
   nameToObject_[element->getUniqueName()] = std::move(newElement);
+  nameIndex_.clear();
+  nameIndexStale_.store(nameIndexEnabled_, std::memory_order_release);
   return element;
 }
 
@@ -739,6 +906,8 @@ RBAModelImpl::addSizeInstance(const std::string& ownerName,
   sizes_.push_back(sizeImpl);
   nameToObject_[ownerName+std::string("/")+sizeImpl->getName()]
     = std::move(newSize);
+  nameIndex_.clear();
+  nameIndexStale_.store(nameIndexEnabled_, std::memory_order_release);
   return sizeImpl;
 }
 
@@ -746,8 +915,10 @@ void
 RBAModelImpl::addPositionContainer(const RBAPositionContainerImpl* newPositionContainer)
 {
   positionContainers_.push_back(newPositionContainer);
-  areaNameToPositionContainer_[newPositionContainer->getArea()->getName()]
-    = newPositionContainer;
+  const RBAAreaImpl* const area {newPositionContainer->getAreaImpl()};
+  if(area != nullptr) {
+    const_cast<RBAAreaImpl*>(area)->setPositionContainer(newPositionContainer);
+  }
 }
 
 void
@@ -19,16 +19,21 @@
 #ifndef RBAMODELIMPL_HPP
 #define RBAMODELIMPL_HPP
 
+#include <atomic>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "RBAAreaImpl.hpp"
 #include "RBAConstraintImpl.hpp"
 #include "RBADisplayImpl.hpp"
 #include "RBAExpression.hpp"
 #include "RBAModel.hpp"
+#include "RBAModelArena.hpp"
 #include "RBAModelElement.hpp"
+#include "RBANameIndex.hpp"
 #include "RBAPositionContainerImpl.hpp"
 #include "RBASceneImpl.hpp"
 #include "RBASizeImpl.hpp"
@@ -46,16 +51,17 @@ class RBAAreaSet;
 class RBAZoneSet;
 class RBAViewContentSet;
 class RBASoundContentSet;
+class RBAConstraintPlugin;
 
 class DLL_EXPORT RBAModelImpl : public RBAModel
 {
 public:
-  RBAModelImpl()=default;
+  RBAModelImpl();
   RBAModelImpl(const RBAModelImpl&)=delete;
   RBAModelImpl(const RBAModelImpl&&)=delete;
   RBAModelImpl& operator=(const RBAModelImpl&)=delete;
   RBAModelImpl& operator=(const RBAModelImpl&&)=delete;
-  virtual ~RBAModelImpl()=default;
+  virtual ~RBAModelImpl();
 
 public:
   const RBAArea* findArea(const std::string& areaName) const override;
@@ -116,6 +122,13 @@ public:
   virtual const std::list<const RBADisplayImpl*>& getDisplayImpls() const;
 
   virtual void createSortedAllocatables();
+  /// Create the name index used by the find functions
+  virtual void createNameIndex();
+  /// Set the plugin whose compiled code the constraints use
+  virtual void setConstraintPlugin(std::unique_ptr<RBAConstraintPlugin> plugin);
+  /// Number of the IDs given to the shared expressions of the constraints
+  virtual void setSharedExpressionCount(const std::uint32_t count);
+  virtual std::uint32_t getSharedExpressionCount() const;
 
   virtual RBAConstraintImpl* findConstraintImpl(const std::string& consName) const;
   virtual const RBAAreaSet* findAreaSetImpl(const std::string& areaSetName) const;
@@ -132,6 +145,10 @@ public:
   // Do not set to const because the internal state is changed by arbitration 
   // processing
   virtual std::list<RBAAllocatable*>& getSortedAllocatables();
+  const std::vector<RBAAllocatable*>& getAllocatableTable() const;
+  const std::vector<const RBAContent*>& getContentTable() const;
+  const std::vector<const RBAContentState*>& getContentStateTable() const;
+  RBAModelArena* getArena();
 
   virtual RBAModelElement* addModelElement(std::unique_ptr<RBAModelElement> newElement);
   virtual RBANamedElement* addNamedElement(std::unique_ptr<RBAModelElement> newElement);
@@ -169,12 +186,22 @@ public:
   // Get affected Allocatable list
   const std::list<RBAAllocatable*>* getAffectedAllocs(const RBAModelElement* const owner);
   
+private:
+  template<typename T>
+  T* findElement(const std::string& name,
+                 T* RBANameIndexEntry::* const member) const;
+  const RBANameIndex& getNameIndex() const;
+  void buildNameIndex() const;
+  void createElementTables();
 
 private:
 #ifdef _MSC_VER
 #pragma warning(push)
 #pragma warning(disable:4251)
 #endif
+  // Memory of the elements. Released last, because of the member order.
+  RBAModelArena arena_;
+
   std::list<const RBAAllocatable*> allocatables_;
   std::list<const RBAContent*> contents_;
   std::list<const RBAContentState*> contentStates_;
@@ -198,14 +225,30 @@ private:
   // processing
   std::list<RBAAllocatable*> sortedAllocatables_;
 
+  // Contiguous copies of the lists created by createSortedAllocatables(),
+  // which are iterated by arbitration processing.
+  // allocatableTable_ is in the order of sortedAllocatables_.
+  std::vector<RBAAllocatable*> allocatableTable_;
+  std::vector<const RBAContent*> contentTable_;
+  std::vector<const RBAContentState*> contentStateTable_;
+  // Adjacency of the elements. Each content and allocatable refers to its
+  // rows with RBAElementArray.
+  std::vector<const RBAAllocatable*> contentAllocatables_;
+  std::vector<RBAConstraintImpl*> allocatableConstraints_;
+
   // For storing objects not managed by name
   // expression, variable are applicable.
   std::list<std::unique_ptr<RBAModelElement>> unnamedObjects_;
 
   // Managing RBARuleObject and RBASize
   std::unordered_map<std::string, std::unique_ptr<RBAModelElement>> nameToObject_;
-  // Position container is managed by map paired with Area name
-  std::unordered_map<std::string, const RBAPositionContainerImpl*> areaNameToPositionContainer_;
+  // Perfect hash over nameToObject_, created when loading is complete.
+  // An element added afterwards marks it stale, and the next lookup
+  // creates it again.
+  mutable RBANameIndex nameIndex_;
+  bool nameIndexEnabled_ {false};
+  mutable std::atomic<bool> nameIndexStale_ {false};
+  mutable std::mutex nameIndexMutex_;
 
   // Managing Labeled element model for extensions
   std::unordered_map<std::string, std::list<const RBAModelElement*>> labelToElements_;
@@ -215,6 +258,11 @@ private:
   // Allocatable map
   std::unordered_map<const RBAModelElement*, std::list<RBAAllocatable*>> affectedAllocsMap_; 
 
+  std::uint32_t sharedExpressionCount_ {0U};
+
+  // Compiled constraints. Released first, because of the member order.
+  std::unique_ptr<RBAConstraintPlugin> constraintPlugin_;
+
 #ifdef _MSC_VER
 #pragma warning(pop)
 #endif
@@ -0,0 +1,196 @@
+/**
+ * Copyright (c) 2019 DENSO CORPORATION.
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Name index class definition file
+ *
+ * The index is a hash-and-displace perfect hash. The names are divided
+ * into buckets by their hash value, and for each bucket, largest first,
+ * a displacement is searched so that every name of the bucket lands in
+ * a free slot. The number of slots is equal to the number of names.
+ */
+
+#include <algorithm>
+#include "RBANameIndex.hpp"
+
+namespace rba
+{
+
+namespace
+{
+
+// Average number of names per bucket
+const std::uint32_t BUCKET_LOAD {2U};
+// Upper limit of the displacement search for one bucket
+const std::uint32_t MAX_DISPLACEMENT {1U << 20U};
+// Number of hash seeds tried before giving up
+const std::uint64_t MAX_SEED {8U};
+
+}
+
+/**
+ * Build the index
+ * @param entries Slots to be placed. The name of each slot must be unique
+ *                and must live as long as the index.
+ * @return false if no perfect hash was found
+ */
+bool
+RBANameIndex::build(std::vector<RBANameIndexEntry>& entries)
+{
+  clear();
+  for (std::uint64_t seed {0U}; seed < MAX_SEED; seed++) {
+    if (place(entries, seed)) {
+      seed_ = seed;
+      built_ = true;
+      return true;
+    }
+  }
+  clear();
+  return false;
+}
+
+void
+RBANameIndex::clear()
+{
+  displacements_.clear();
+  slots_.clear();
+  seed_ = 0U;
+  built_ = false;
+}
+
+bool
+RBANameIndex::isBuilt() const
+{
+  return built_;
+}
+
+std::size_t
+RBANameIndex::getSize() const
+{
+  return slots_.size();
+}
+
+/**
+ * Search the slot of a name
+ * @return nullptr if the name is not in the index
+ */
+const RBANameIndexEntry*
+RBANameIndex::find(const std::string& name) const
+{
+  if (slots_.empty()) {
+    return nullptr;
+  }
+  const std::uint64_t hashValue {hash(name, seed_)};
+  const std::uint32_t displacement
+    {displacements_[hashValue % displacements_.size()]};
+  const RBANameIndexEntry& entry
+    {slots_[getSlot(hashValue, displacement,
+                    static_cast<std::uint32_t>(slots_.size()))]};
+  if (*entry.name != name) {
+    return nullptr;
+  }
+  return &entry;
+}
+
+std::uint64_t
+RBANameIndex::hash(const std::string& name, const std::uint64_t seed)
+{
+  // FNV-1a
+  std::uint64_t value {14695981039346656037ULL ^ seed};
+  for (const char c : name) {
+    value ^= static_cast<std::uint8_t>(c);
+    value *= 1099511628211ULL;
+  }
+  return value;
+}
+
+std::uint32_t
+RBANameIndex::getSlot(const std::uint64_t hashValue,
+                      const std::uint32_t displacement,
+                      const std::uint32_t slotCount)
+{
+  // splitmix64 finalizer
+  std::uint64_t value {hashValue + (displacement * 0x9E3779B97F4A7C15ULL)};
+  value = (value ^ (value >> 30U)) * 0xBF58476D1CE4E5B9ULL;
+  value = (value ^ (value >> 27U)) * 0x94D049BB133111EBULL;
+  value ^= (value >> 31U);
+  return static_cast<std::uint32_t>(value % slotCount);
+}
+
+bool
+RBANameIndex::place(std::vector<RBANameIndexEntry>& entries,
+                    const std::uint64_t seed)
+{
+  const std::uint32_t slotCount {static_cast<std::uint32_t>(entries.size())};
+  const std::uint32_t bucketCount {(slotCount / BUCKET_LOAD) + 1U};
+  std::vector<std::uint64_t> hashValues(slotCount);
+  std::vector<std::vector<std::uint32_t>> buckets(bucketCount);
+  for (std::uint32_t i {0U}; i < slotCount; i++) {
+    hashValues[i] = hash(*entries[i].name, seed);
+    buckets[hashValues[i] % bucketCount].push_back(i);
+  }
+  std::vector<std::uint32_t> order(bucketCount);
+  for (std::uint32_t i {0U}; i < bucketCount; i++) {
+    order[i] = i;
+  }
+  std::stable_sort(order.begin(), order.end(),
+                   [&buckets](const std::uint32_t lhs, const std::uint32_t rhs) {
+                     return buckets[lhs].size() > buckets[rhs].size();
+                   });
+
+  std::vector<std::uint32_t> displacements(bucketCount, 0U);
+  std::vector<std::int64_t> slotToEntry(slotCount, -1);
+  std::vector<std::uint32_t> bucketSlots;
+  for (const std::uint32_t bucket : order) {
+    const std::vector<std::uint32_t>& members {buckets[bucket]};
+    if (members.empty()) {
+      break;
+    }
+    bool found {false};
+    for (std::uint32_t d {0U}; (d < MAX_DISPLACEMENT) && !found; d++) {
+      bucketSlots.clear();
+      found = true;
+      for (const std::uint32_t member : members) {
+        const std::uint32_t slot {getSlot(hashValues[member], d, slotCount)};
+        if ((slotToEntry[slot] >= 0)
+            || (std::find(bucketSlots.begin(), bucketSlots.end(), slot)
+                != bucketSlots.end())) {
+          found = false;
+          break;
+        }
+        bucketSlots.push_back(slot);
+      }
+      if (found) {
+        displacements[bucket] = d;
+        for (std::size_t i {0U}; i < members.size(); i++) {
+          slotToEntry[bucketSlots[i]] = members[i];
+        }
+      }
+    }
+    if (!found) {
+      return false;
+    }
+  }
+
+  slots_.resize(slotCount);
+  for (std::uint32_t slot {0U}; slot < slotCount; slot++) {
+    slots_[slot] = entries[static_cast<std::size_t>(slotToEntry[slot])];
+  }
+  displacements_.swap(displacements);
+  return true;
+}
+
+}
@@ -0,0 +1,129 @@
+/**
+ * Copyright (c) 2019 DENSO CORPORATION.
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Name index class header
+ *
+ * Minimal perfect hash over the element names of a loaded model.
+ * Each name owns one slot that holds the element already converted to
+ * every type that the model can be searched for.
+ */
+
+#ifndef RBANAMEINDEX_HPP
+#define RBANAMEINDEX_HPP
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "RBADllExport.hpp"
+
+namespace rba
+{
+
+class RBAModelElement;
+class RBAAllocatable;
+class RBAContent;
+class RBAContentState;
+class RBAAreaImpl;
+class RBAViewContentImpl;
+class RBAViewContentStateImpl;
+class RBASizeImpl;
+class RBAZoneImpl;
+class RBASoundContentImpl;
+class RBASoundContentStateImpl;
+class RBASceneImpl;
+class RBADisplayImpl;
+class RBAConstraintImpl;
+class RBAAreaSet;
+class RBAZoneSet;
+class RBAViewContentSet;
+class RBASoundContentSet;
+class RBAPositionContainerImpl;
+
+/**
+ * Slot of the name index
+ *
+ * A pointer is nullptr when the element is not of that type.
+ * The content state pointers of a content point to its first state.
+ */
+struct RBANameIndexEntry
+{
+  const std::string* name {nullptr};
+  const RBAModelElement* element {nullptr};
+  const RBAAllocatable* allocatable {nullptr};
+  const RBAContent* content {nullptr};
+  const RBAContentState* contentState {nullptr};
+  const RBAAreaImpl* area {nullptr};
+  const RBAViewContentImpl* viewContent {nullptr};
+  const RBAViewContentStateImpl* viewContentState {nullptr};
+  const RBASizeImpl* size {nullptr};
+  const RBAZoneImpl* zone {nullptr};
+  const RBASoundContentImpl* soundContent {nullptr};
+  const RBASoundContentStateImpl* soundContentState {nullptr};
+  const RBASceneImpl* scene {nullptr};
+  const RBADisplayImpl* display {nullptr};
+  RBAConstraintImpl* constraint {nullptr};
+  const RBAAreaSet* areaSet {nullptr};
+  const RBAZoneSet* zoneSet {nullptr};
+  const RBAViewContentSet* viewContentSet {nullptr};
+  const RBASoundContentSet* soundContentSet {nullptr};
+  const RBAPositionContainerImpl* positionContainer {nullptr};
+};
+
+class DLL_EXPORT RBANameIndex
+{
+public:
+  RBANameIndex()=default;
+  RBANameIndex(const RBANameIndex&)=delete;
+  RBANameIndex(const RBANameIndex&&)=delete;
+  RBANameIndex& operator=(const RBANameIndex&)=delete;
+  RBANameIndex& operator=(const RBANameIndex&&)=delete;
+  virtual ~RBANameIndex()=default;
+
+public:
+  bool build(std::vector<RBANameIndexEntry>& entries);
+  void clear();
+  bool isBuilt() const;
+  std::size_t getSize() const;
+  const RBANameIndexEntry* find(const std::string& name) const;
+
+private:
+  static std::uint64_t hash(const std::string& name, const std::uint64_t seed);
+  static std::uint32_t getSlot(const std::uint64_t hashValue,
+                               const std::uint32_t displacement,
+                               const std::uint32_t slotCount);
+  bool place(std::vector<RBANameIndexEntry>& entries,
+             const std::uint64_t seed);
+
+private:
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable:4251)
+#endif
+  // Displacement of each bucket
+  std::vector<std::uint32_t> displacements_;
+  std::vector<RBANameIndexEntry> slots_;
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+  std::uint64_t seed_ {0U};
+  bool built_ {false};
+
+};
+
+}
+
+#endif
@@ -20,6 +20,11 @@
 #include <string>
 #include <unordered_map>
 #include "RBARuleObject.hpp"
+#include "RBAAllocatable.hpp"
+#include "RBAAllocatableSet.hpp"
+#include "RBAContent.hpp"
+#include "RBAContentSet.hpp"
+#include "RBAElementCast.hpp"
 
 namespace rba
 {
@@ -102,4 +107,79 @@ const std::unordered_map<std::string, RBARuleObject*>& RBARuleObject::getMembers
   return members_;
 }
 
+/**
+ * @return this object as an allocatable, or nullptr if it is not
+ */
+const RBAAllocatable*
+RBARuleObject::toAllocatable() const
+{
+  return RBAElementCast::verify<const RBAAllocatable*>(allocatable_, this);
+}
+
+RBAAllocatable*
+RBARuleObject::toAllocatable()
+{
+  return RBAElementCast::verify<RBAAllocatable*>(allocatable_, this);
+}
+
+/**
+ * @return this object as a content, or nullptr if it is not
+ */
+const RBAContent*
+RBARuleObject::toContent() const
+{
+  return RBAElementCast::verify<const RBAContent*>(content_, this);
+}
+
+RBAContent*
+RBARuleObject::toContent()
+{
+  return RBAElementCast::verify<RBAContent*>(content_, this);
+}
+
+/**
+ * @return this object as a set of allocatables, or nullptr if it is not
+ */
+const RBAAllocatableSet*
+RBARuleObject::toAllocatableSet() const
+{
+  return RBAElementCast::verify<const RBAAllocatableSet*>(allocatableSet_, this);
+}
+
+/**
+ * @return this object as a set of contents, or nullptr if it is not
+ */
+const RBAContentSet*
+RBARuleObject::toContentSet() const
+{
+  return RBAElementCast::verify<const RBAContentSet*>(contentSet_, this);
+}
+
+/**
+ * Called from the constructor of the derived class
+ */
+void
+RBARuleObject::setDerivedObject(RBAAllocatable* const allocatable)
+{
+  allocatable_ = allocatable;
+}
+
+void
+RBARuleObject::setDerivedObject(RBAContent* const content)
+{
+  content_ = content;
+}
+
+void
+RBARuleObject::setDerivedObject(const RBAAllocatableSet* const allocatableSet)
+{
+  allocatableSet_ = allocatableSet;
+}
+
+void
+RBARuleObject::setDerivedObject(const RBAContentSet* const contentSet)
+{
+  contentSet_ = contentSet;
+}
+
 }
@@ -29,6 +29,11 @@
 namespace rba
 {
 
+class RBAAllocatable;
+class RBAAllocatableSet;
+class RBAContent;
+class RBAContentSet;
+
 class DLL_EXPORT RBARuleObject : public RBANamedElement
 {
 protected:
@@ -49,10 +54,20 @@ public:
   RBARuleObject* getOwner() const;
   virtual void setOwner(RBARuleObject* owner);
   std::string getUniqueName() const override;
+  const RBAAllocatable* toAllocatable() const;
+  RBAAllocatable* toAllocatable();
+  const RBAContent* toContent() const;
+  RBAContent* toContent();
+  const RBAAllocatableSet* toAllocatableSet() const;
+  const RBAContentSet* toContentSet() const;
 
 protected:
   void addMember(const std::string& memberName, RBARuleObject* const val);
   const std::unordered_map<std::string, RBARuleObject*>& getMembers() const;
+  void setDerivedObject(RBAAllocatable* const allocatable);
+  void setDerivedObject(RBAContent* const content);
+  void setDerivedObject(const RBAAllocatableSet* const allocatableSet);
+  void setDerivedObject(const RBAContentSet* const contentSet);
 
 private:
 #ifdef _MSC_VER
@@ -62,6 +77,12 @@ private:
   std::unordered_set<std::string> tags_;
   std::unordered_map<std::string, RBARuleObject*> members_;
   RBARuleObject* owner_ {nullptr};
+  // This object as the classes that derive from RBARuleObject virtually,
+  // to which static_cast cannot convert
+  RBAAllocatable* allocatable_ {nullptr};
+  RBAContent* content_ {nullptr};
+  const RBAAllocatableSet* allocatableSet_ {nullptr};
+  const RBAContentSet* contentSet_ {nullptr};
 #ifdef _MSC_VER
 #pragma warning(pop)
 #endif
@@ -75,7 +75,7 @@ RBAJsonElement::getExpressionType() const
 #endif
 
 void
-RBAJsonElement::setName(const std::string& name)
+RBAJsonElement::setName(const std::string* const name)
 {
   name_ = name;
 }
@@ -83,7 +83,7 @@ RBAJsonElement::setName(const std::string& name)
 const std::string&
 RBAJsonElement::getName() const
 {
-  return name_;
+  return *name_;
 }
 
 void
@@ -92,6 +92,12 @@ RBAJsonElement::addChild(std::unique_ptr<RBAJsonElement> child)
   children_.push_back(move(child));
 }
 
+void
+RBAJsonElement::clearChildren()
+{
+  children_.clear();
+}
+
 const std::vector<std::unique_ptr<RBAJsonElement>>&
 RBAJsonElement::getChildren() const
 {
@@ -131,7 +137,7 @@ RBAJsonElement::getClassName() const
 
 // RBAJsonElementElement class
 
-RBAJsonElementElement::RBAJsonElementElement(const std::string& name)
+RBAJsonElementElement::RBAJsonElementElement(const std::string* const name)
   : RBAJsonElement{}
 {
   setName(name);
@@ -139,7 +145,7 @@ RBAJsonElementElement::RBAJsonElementElement(const std::string& name)
 
 // RBAJsonElementString class
 
-RBAJsonElementString::RBAJsonElementString(const std::string& name)
+RBAJsonElementString::RBAJsonElementString(const std::string* const name)
   : RBAJsonElement{}
 {
   setName(name);
@@ -242,7 +248,7 @@ RBAJsonElementString::setString(const std::string& str)
 
 // RBAJsonElementInt class
 
-RBAJsonElementInt::RBAJsonElementInt(const std::string& name)
+RBAJsonElementInt::RBAJsonElementInt(const std::string* const name)
   : RBAJsonElement{}
 {
   setName(name);
@@ -262,7 +268,7 @@ RBAJsonElementInt::setInt(const std::int32_t val)
 
 // RBAJsonElementArray class
 
-RBAJsonElementArray::RBAJsonElementArray(const std::string& name)
+RBAJsonElementArray::RBAJsonElementArray(const std::string* const name)
   : RBAJsonElement{}
 {
   setName(name);
@@ -55,9 +55,12 @@ public:
   virtual RBAExpressionType getExpressionType() const;
 #endif
 
-  void setName(const std::string& name);
+  // The name is not copied. It must outlive this element
+  // (the parser interns names in RBAJsonStringArena).
+  void setName(const std::string* const name);
   const std::string& getName() const;
   void addChild(std::unique_ptr<RBAJsonElement> child);
+  void clearChildren();
   const std::vector<std::unique_ptr<RBAJsonElement>>& getChildren() const;
   RBAJsonElement* getChild() const;
   const RBAJsonElement* findChildren(const std::string& name) const;
@@ -68,7 +71,7 @@ private:
 #pragma warning(push)
 #pragma warning(disable:4251)
 #endif
-  std::string name_ {""};
+  const std::string* name_ {&emptyStr_};
   std::vector<std::unique_ptr<RBAJsonElement>> children_;
   static std::string emptyStr_;
 #ifdef _MSC_VER
@@ -80,7 +83,7 @@ private:
 class RBAJsonElementElement : public RBAJsonElement
 {
 public:
-  explicit RBAJsonElementElement(const std::string& name);
+  explicit RBAJsonElementElement(const std::string* const name);
   RBAJsonElementElement(const RBAJsonElementElement&)=delete;
   RBAJsonElementElement(const RBAJsonElementElement&&)=delete;
   RBAJsonElementElement& operator=(const RBAJsonElementElement&)=delete;
@@ -91,7 +94,7 @@ public:
 class RBAJsonElementString : public RBAJsonElement
 {
 public:
-  explicit RBAJsonElementString(const std::string& name);
+  explicit RBAJsonElementString(const std::string* const name);
   RBAJsonElementString(const RBAJsonElementString&)=delete;
   RBAJsonElementString(const RBAJsonElementString&&)=delete;
   RBAJsonElementString& operator=(const RBAJsonElementString&)=delete;
@@ -116,7 +119,7 @@ private:
 class RBAJsonElementInt : public RBAJsonElement
 {
 public:
-  explicit RBAJsonElementInt(const std::string& name);
+  explicit RBAJsonElementInt(const std::string* const name);
   RBAJsonElementInt(const RBAJsonElementInt&)=delete;
   RBAJsonElementInt(const RBAJsonElementInt&&)=delete;
   RBAJsonElementInt& operator=(const RBAJsonElementInt&)=delete;
@@ -135,7 +138,7 @@ private:
 class RBAJsonElementArray : public RBAJsonElement
 {
 public:
-  explicit RBAJsonElementArray(const std::string& name);
+  explicit RBAJsonElementArray(const std::string* const name);
   RBAJsonElementArray(const RBAJsonElementArray&)=delete;
   RBAJsonElementArray(const RBAJsonElementArray&&)=delete;
   RBAJsonElementArray& operator=(const RBAJsonElementArray&)=delete;
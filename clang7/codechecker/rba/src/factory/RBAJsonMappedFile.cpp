@@ -0,0 +1,111 @@
+/**
+ * Copyright (c) 2019 DENSO CORPORATION.
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/// @file  RBAJsonMappedFile.cpp
+/// @brief Read-only memory mapped file class definition file
+
+#include <fstream>
+#include <iterator>
+#include "RBAJsonMappedFile.hpp"
+
+#if defined(__unix__) || defined(__APPLE__)
+#define RBA_USE_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace rba
+{
+
+RBAJsonMappedFile::~RBAJsonMappedFile() noexcept
+{
+  close();
+}
+
+/// @brief Open the file and make its contents readable
+/// @param[in] filename file path
+/// @return false if the file could not be opened
+bool
+RBAJsonMappedFile::open(const std::string& filename)
+{
+  close();
+#ifdef RBA_USE_MMAP
+  const int fd {::open(filename.c_str(), O_RDONLY)};
+  if (fd < 0) {
+    return false;
+  }
+  struct stat st;
+  if (::fstat(fd, &st) != 0) {
+    static_cast<void>(::close(fd));
+    return false;
+  }
+  size_ = static_cast<std::size_t>(st.st_size);
+  if (size_ > 0U) {
+    void* const addr {::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0)};
+    if (addr != MAP_FAILED) {
+      // The tokenizer reads the file once from the beginning
+      static_cast<void>(::madvise(addr, size_, MADV_SEQUENTIAL));
+      data_ = static_cast<const char*>(addr);
+      mapped_ = true;
+    }
+  }
+  static_cast<void>(::close(fd));
+  if (mapped_ || (size_ == 0U)) {
+    return true;
+  }
+  size_ = 0U;
+#endif
+  // Fallback: read the whole file into the buffer
+  std::ifstream ifs {filename, std::ios::in | std::ios::binary};
+  if (ifs.fail()) {
+    return false;
+  }
+  buffer_.assign(std::istreambuf_iterator<char>(ifs),
+                 std::istreambuf_iterator<char>());
+  data_ = buffer_.data();
+  size_ = buffer_.size();
+  return true;
+}
+
+void
+RBAJsonMappedFile::close()
+{
+#ifdef RBA_USE_MMAP
+  if (mapped_) {
+    static_cast<void>(::munmap(const_cast<char*>(data_), size_));
+  }
+#endif
+  mapped_ = false;
+  data_ = nullptr;
+  size_ = 0U;
+  buffer_.clear();
+}
+
+const char*
+RBAJsonMappedFile::getData() const
+{
+  return data_;
+}
+
+std::size_t
+RBAJsonMappedFile::getSize() const
+{
+  return size_;
+}
+
+}
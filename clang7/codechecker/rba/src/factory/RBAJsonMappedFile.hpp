@@ -0,0 +1,67 @@
+/**
+ * Copyright (c) 2019 DENSO CORPORATION.
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/// @file  RBAJsonMappedFile.hpp
+/// @brief Read-only memory mapped file class header file
+
+#ifndef RBAJSONMAPPEDFILE_HPP
+#define RBAJSONMAPPEDFILE_HPP
+
+#include <cstddef>
+#include <string>
+#include <vector>
+#include "RBADllExport.hpp"
+
+namespace rba
+{
+
+/// @brief Read-only view of a whole file
+/// @details The file is mapped with mmap() where available.
+/// On other platforms the contents are read into an internal buffer.
+class DLL_EXPORT RBAJsonMappedFile
+{
+public:
+  RBAJsonMappedFile()=default;
+  RBAJsonMappedFile(const RBAJsonMappedFile&)=delete;
+  RBAJsonMappedFile(const RBAJsonMappedFile&&)=delete;
+  RBAJsonMappedFile& operator=(const RBAJsonMappedFile&)=delete;
+  RBAJsonMappedFile& operator=(const RBAJsonMappedFile&&)=delete;
+  virtual ~RBAJsonMappedFile() noexcept;
+
+public:
+  bool open(const std::string& filename);
+  void close();
+  const char* getData() const;
+  std::size_t getSize() const;
+
+private:
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable:4251)
+#endif
+  const char* data_ {nullptr};
+  std::size_t size_ {0U};
+  bool mapped_ {false};
+  std::vector<char> buffer_;
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+};
+
+}
+
+#endif
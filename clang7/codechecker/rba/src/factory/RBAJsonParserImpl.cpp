@@ -17,15 +17,21 @@
 /// @file  RBAJsonParserImpl.cpp
 /// @brief JSON Parser implment class defintion file
 
-#include <fstream>
-#include <sstream>
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <cstring>
 #include <iostream>
 #include "RBAJsonParserImpl.hpp"
 
+#include "RBAAffectAllocatableCollector.hpp"
 #include "RBACommonMakerTable.hpp"
 #include "RBAConstraintMap.hpp"
+#include "RBAExpressionOptimizer.hpp"
 #include "RBAJsonElement.hpp"
+#include "RBAJsonMappedFile.hpp"
 #include "RBAModelImpl.hpp"
+#include "RBASharedExpressionCollector.hpp"
 #include "RBASoundMakerTable.hpp"
 #include "RBAViewMakerTable.hpp"
 
@@ -43,13 +49,34 @@ RBAModel*
 RBAJsonParser::Impl::
 parse(const std::string& filename)
 {
-  const std::unique_ptr<RBAJsonElement> root {readJsonFile(filename)};
-  if(root == nullptr) {
+  const std::lock_guard<std::mutex> lock{mutex_};
+
+  names_.clear();
+  RBAJsonMappedFile file;
+  if(!file.open(filename)) {
+    std::cerr << filename << ": No such file or directory" << &std::endl;
     return nullptr;
   }
 
-  const std::lock_guard<std::mutex> lock{mutex_};
+  // JSON is passed to the makers while it is being read
+  prepareFactory();
+  const RBAModelArena::Scope arenaScope {getArena()};
+  beginStream(file.getData(), file.getSize());
+  const std::unique_ptr<RBAJsonElement> root
+    {readJsonString(file.getData(), file.getSize())};
+  streaming_ = false;
+  streamArrays_.clear();
+  if((root == nullptr) || streamError_) {
+    factory_->deleteModel();
+    return nullptr;
+  }
 
+  return finishModel(root.get(), filename);
+}
+
+void
+RBAJsonParser::Impl::prepareFactory()
+{
   if(orgFactory_ != nullptr) {
     factory_ = orgFactory_;
   }
@@ -58,8 +85,14 @@ parse(const std::string& filename)
     factory_ = uniqueFactory_.get();
   }
   resetFactory();
+}
 
+RBAModel*
+RBAJsonParser::Impl::
+finishModel(const RBAJsonElement* const root, const std::string& filename)
+{
   // get registered tag element
+  // (elements that were streamed are no longer in the tree)
   for(const auto& tag : factory_->getTags()) {
     const RBAJsonElement* const jsonElems {root->findChildren(tag)};
     if(jsonElems != nullptr) {
@@ -114,6 +147,23 @@ parse(const std::string& filename)
     return nullptr;
   }
 
+  RBAModelImpl* const model {dynamic_cast<RBAModelImpl*>(factory_->getModel())};
+
+  // Fold the parts of the constraints that are decided by the model
+  RBAExpressionOptimizer optimizer {model};
+  optimizer.optimize();
+
+  // Identical parts of the constraints are evaluated once per check
+  RBASharedExpressionCollector collector {model};
+  collector.collect();
+
+  // Allocatables that each constraint can affect on re-arbitration
+  RBAAffectAllocatableCollector affectCollector {model};
+  affectCollector.collect();
+
+  // Name lookups after loading use the perfect hash
+  model->createNameIndex();
+
   return factory_->getModel();
 }
 
@@ -153,51 +203,43 @@ RBAJsonParser::Impl::createAllocatablesMap(const RBAJsonElement* const allocMap)
   }
 }
 
+// The file is tokenized in place. Names and values are copied only once,
+// when the element holding them is created. White space is ignored even
+// inside strings, as the former stream based reader did.
 std::unique_ptr<RBAJsonElement>
-RBAJsonParser::Impl::readJsonFile(const std::string& filename)
-{
-  std::ifstream ifs{filename};
-  if(ifs.fail()) {
-    std::cerr << filename << ": No such file or directory" << &std::endl;
-    return nullptr;
-  }
-
-  std::ostringstream oss;
-  std::string line;
-  while(!ifs.eof()) {
-    ifs >> line;
-    oss << line;
-  }
-
-  return readJsonString(oss.str());
-}
-
-std::unique_ptr<RBAJsonElement>
-RBAJsonParser::Impl::readJsonString(const std::string& jsonstring)
+RBAJsonParser::Impl::readJsonString(const char* const json,
+                                    const std::size_t jsonSize)
 {
   std::vector<RBAJsonElement*> queue;
   RBAJsonElement* current{nullptr};
   std::unique_ptr<RBAJsonElement> topElement{nullptr};
   Status status{Status::START};
-  const std::size_t jsonSize{jsonstring.size()};
   std::size_t tokenPos{0U};
   std::size_t tokenSize{0U};
-  std::size_t strPos{0U};
+  const char* str{nullptr};
   std::size_t strSize{0U};
+  // Element of a tag array being read in streaming mode
+  std::unique_ptr<RBAJsonElement> streamed{nullptr};
 
   while (tokenPos < jsonSize) {
-    auto firstChar = jsonstring[tokenPos];
+    auto firstChar = json[tokenPos];
     if(firstChar == '\"') {
       // String
-      tokenSize = jsonstring.find('\"', tokenPos + 1U) - tokenPos + 1U;
+      const void* const quote
+        {std::memchr(&json[tokenPos + 1U], '\"', jsonSize - tokenPos - 1U)};
+      if(quote == nullptr) {
+        break;
+      }
+      tokenSize = static_cast<std::size_t>(
+          static_cast<const char*>(quote) - &json[tokenPos]) + 1U;
       switch(status) {
       case Status::START:
-        strPos = tokenPos + 1U;
+        str = &json[tokenPos + 1U];
         strSize = tokenSize - 2U;
         break;
       case Status::VALUE:
-        auto elem = std::make_unique<RBAJsonElementString>(jsonstring.substr(strPos, strSize));
-        elem->setString(jsonstring.substr(tokenPos + 1U, tokenSize - 2U));
+        auto elem = std::make_unique<RBAJsonElementString>(internName(str, strSize));
+        elem->setString(makeString(&json[tokenPos + 1U], tokenSize - 2U));
         current->addChild(std::move(elem));
         strSize = 0U;
         status = Status::START;
@@ -212,7 +254,7 @@ RBAJsonParser::Impl::readJsonString(const std::string& jsonstring)
     else if(firstChar == ',') {
       tokenSize = 1U;
       if(strSize > 0U) {
-	      current->addChild(std::make_unique<RBAJsonElementString>(jsonstring.substr(strPos, strSize)));
+        current->addChild(std::make_unique<RBAJsonElementString>(internName(str, strSize)));
         strSize = 0U;
         status = Status::START;
       }
@@ -222,16 +264,20 @@ RBAJsonParser::Impl::readJsonString(const std::string& jsonstring)
       tokenSize = 1U;
       if(status == Status::START) {
         if(current != nullptr) {
-          auto elem = std::make_unique<RBAJsonElementElement>(jsonstring.substr(strPos, strSize));
+          auto elem = std::make_unique<RBAJsonElementElement>(internName(str, strSize));
           auto elemPtr = elem.get();
-          current->addChild(std::move(elem));
+          if(isStreamTarget(queue)) {
+            streamed = std::move(elem);
+          } else {
+            current->addChild(std::move(elem));
+          }
           current = elemPtr;
           queue.push_back(current);
           strSize = 0U;
         }
       } else {
         // status is Status::VALUE
-        auto elem = std::make_unique<RBAJsonElementElement>(jsonstring.substr(strPos, strSize));
+        auto elem = std::make_unique<RBAJsonElementElement>(internName(str, strSize));
         auto elemPtr = elem.get();
         if(current != nullptr) {
           current->addChild(std::move(elem));
@@ -247,18 +293,26 @@ RBAJsonParser::Impl::readJsonString(const std::string& jsonstring)
     else if(firstChar == '}') {
       // End Element
       tokenSize = 1U;
+      const bool endOfStreamed {(streamed != nullptr) && !queue.empty()
+                                && (queue.back() == streamed.get())};
       if (!queue.empty()) {
         queue.pop_back();
       }
       current = queue.empty() ? nullptr : queue.back();
+      if(endOfStreamed) {
+        streamElement(current->getName(), std::move(streamed));
+      }
     }
     else if(firstChar == '[') {
       // Satrt array
       tokenSize = 1U;
-      auto elem = std::make_unique<RBAJsonElementArray>(jsonstring.substr(strPos, strSize));
+      auto elem = std::make_unique<RBAJsonElementArray>(internName(str, strSize));
       auto elemPtr = elem.get();
       current->addChild(std::move(elem));
       current = elemPtr;
+      if(streaming_ && (queue.size() == 1U)) {
+        streamArrays_[current->getName()] = current;
+      }
       queue.push_back(current);
       strSize = 0U;
       status = Status::START;
@@ -267,18 +321,25 @@ RBAJsonParser::Impl::readJsonString(const std::string& jsonstring)
       // End array
       tokenSize = 1U;
       if(strSize > 0U) {
-        current->addChild(std::make_unique<RBAJsonElementString>(jsonstring.substr(strPos, strSize)));
+        current->addChild(std::make_unique<RBAJsonElementString>(internName(str, strSize)));
         strSize = 0U;
         status = Status::START;
       }
+      if(streaming_ && (queue.size() == 2U)) {
+        endStreamArray(current->getName());
+      }
       queue.pop_back();
       current = queue.empty() ? nullptr : queue.back();
     }
     else if((firstChar == '-') || isdigit(firstChar)) {
       // Numerical value
-      tokenSize = jsonstring.find_first_of(",}]", tokenPos + 1U) - tokenPos;
-      auto elem = std::make_unique<RBAJsonElementInt>(jsonstring.substr(strPos, strSize));
-      elem->setInt(std::stoi(jsonstring.substr(tokenPos, tokenSize)));
+      tokenSize = 1U;
+      while(((tokenPos + tokenSize) < jsonSize)
+            && (std::strchr(",}]", json[tokenPos + tokenSize]) == nullptr)) {
+        tokenSize++;
+      }
+      auto elem = std::make_unique<RBAJsonElementInt>(internName(str, strSize));
+      elem->setInt(parseInt(&json[tokenPos], tokenSize));
       current->addChild(std::move(elem));
       strSize = 0U;
       status = Status::START;
@@ -289,7 +350,7 @@ RBAJsonParser::Impl::readJsonString(const std::string& jsonstring)
     }
     else {
       tokenSize = 1U;
-      std::cerr << "[ERROR] '" << jsonstring.substr(tokenPos, tokenSize)
+      std::cerr << "[ERROR] '" << firstChar
        << "' :Unknown token" << &std::endl;
     }
     tokenPos += tokenSize;
@@ -298,6 +359,200 @@ RBAJsonParser::Impl::readJsonString(const std::string& jsonstring)
   return topElement;
 }
 
+const std::string*
+RBAJsonParser::Impl::internName(const char* const str, const std::size_t size)
+{
+  if(size == 0U) {
+    return &names_.intern(str, size);
+  }
+  const char* const end {str + size};
+  if(std::find_if(str, end, [](const char c) { return isspace(c) != 0; })
+     == end) {
+    return &names_.intern(str, size);
+  }
+  return &names_.intern(makeString(str, size));
+}
+
+std::string
+RBAJsonParser::Impl::makeString(const char* const str, const std::size_t size)
+{
+  std::string res;
+  const char* const end {str + size};
+  const char* pos {std::find_if(str, end,
+                                [](const char c) { return isspace(c) != 0; })};
+  if(pos == end) {
+    res.assign(str, size);
+  }
+  else {
+    res.reserve(size);
+    res.assign(str, pos);
+    for(; pos != end; ++pos) {
+      if(isspace(*pos) == 0) {
+        res.push_back(*pos);
+      }
+    }
+  }
+  return res;
+}
+
+// Same result as std::stoi() for the characters of a numerical token
+// (white space in the token is ignored)
+std::int32_t
+RBAJsonParser::Impl::parseInt(const char* const str, const std::size_t size)
+{
+  std::size_t pos {0U};
+  bool negative {false};
+  if(str[pos] == '-') {
+    negative = true;
+    pos++;
+  }
+  std::int64_t val {0};
+  for(; pos < size; ++pos) {
+    const char c {str[pos]};
+    if(isdigit(c) != 0) {
+      val = (val * 10) + static_cast<std::int64_t>(c - '0');
+      if(val > static_cast<std::int64_t>(INT32_MAX) + 1) {
+        break;
+      }
+    }
+    else if(isspace(c) == 0) {
+      break;
+    }
+  }
+  return static_cast<std::int32_t>(negative ? -val : val);
+}
+
+// Collect the names directly under the top level object
+// ("areas", "zones", ... of {"root":{...}})
+std::set<std::string>
+RBAJsonParser::Impl::getTopLevelNames(const char* const json,
+                                      const std::size_t jsonSize)
+{
+  std::set<std::string> names;
+  std::size_t depth {0U};
+  std::size_t pos {0U};
+  while(pos < jsonSize) {
+    const char c {json[pos]};
+    if(c == '\"') {
+      const void* const quote
+        {std::memchr(&json[pos + 1U], '\"', jsonSize - pos - 1U)};
+      if(quote == nullptr) {
+        break;
+      }
+      const std::size_t end {static_cast<std::size_t>(
+          static_cast<const char*>(quote) - json)};
+      if(depth == 2U) {
+        std::size_t next {end + 1U};
+        while((next < jsonSize)
+              && (static_cast<std::int32_t>(json[next]) <= 0x20)) {
+          next++;
+        }
+        if((next < jsonSize) && (json[next] == ':')) {
+          static_cast<void>(names.insert(makeString(&json[pos + 1U],
+                                                    end - pos - 1U)));
+        }
+      }
+      pos = end;
+    }
+    else if((c == '{') || (c == '[')) {
+      depth++;
+    }
+    else if(((c == '}') || (c == ']')) && (depth > 0U)) {
+      depth--;
+    }
+    else {
+      // skip
+    }
+    pos++;
+  }
+  return names;
+}
+
+void
+RBAJsonParser::Impl::beginStream(const char* const json,
+                                 const std::size_t jsonSize)
+{
+  const std::set<std::string> names {getTopLevelNames(json, jsonSize)};
+  streamTags_.clear();
+  for(const auto& tag : factory_->getTags()) {
+    if(names.find(tag) != names.end()) {
+      streamTags_.push_back(tag);
+    }
+  }
+  streamPos_ = 0U;
+  closedTags_.clear();
+  streamArrays_.clear();
+  streamError_ = false;
+  streaming_ = true;
+}
+
+// Whether the element starting at the top of the queue is an element of
+// the tag array that is currently due ({"root":{"tag":[{...}]}})
+bool
+RBAJsonParser::Impl::isStreamTarget(const std::vector<RBAJsonElement*>& queue) const
+{
+  return streaming_ && (queue.size() == 2U) && (streamPos_ < streamTags_.size())
+    && (queue.back()->getName() == streamTags_[streamPos_]);
+}
+
+void
+RBAJsonParser::Impl::streamElement(const std::string& tag,
+                                   std::unique_ptr<RBAJsonElement> elem)
+{
+  if(!streamError_) {
+    if(factory_->createElement(tag, elem.get()) == nullptr) {
+      streamError_ = true;
+    }
+  }
+}
+
+// When a tag array has been read, the next tag in the maker order
+// becomes due. Elements of it that have already been read are created now.
+void
+RBAJsonParser::Impl::endStreamArray(const std::string& tag)
+{
+  if(std::find(streamTags_.begin(), streamTags_.end(), tag)
+     == streamTags_.end()) {
+    return;
+  }
+  static_cast<void>(closedTags_.insert(tag));
+  while((streamPos_ < streamTags_.size())
+        && (closedTags_.find(streamTags_[streamPos_]) != closedTags_.end())) {
+    streamPos_++;
+    if(streamPos_ < streamTags_.size()) {
+      createBufferedElements(streamTags_[streamPos_]);
+    }
+  }
+}
+
+void
+RBAJsonParser::Impl::createBufferedElements(const std::string& tag)
+{
+  const auto it = streamArrays_.find(tag);
+  if(it != streamArrays_.end()) {
+    for(const auto& elem : it->second->getChildren()) {
+      if(streamError_) {
+        break;
+      }
+      if(factory_->createElement(tag, elem.get()) == nullptr) {
+        streamError_ = true;
+      }
+    }
+    it->second->clearChildren();
+  }
+}
+
+// Arena of the model being created, where the makers place its elements
+RBAModelArena*
+RBAJsonParser::Impl::getArena()
+{
+  RBAModelImpl* const model {dynamic_cast<RBAModelImpl*>(factory_->getModel())};
+  if(model == nullptr) {
+    return nullptr;
+  }
+  return model->getArena();
+}
+
 void
 RBAJsonParser::Impl::resetFactory()
 {
@@ -21,13 +21,18 @@
 #define RBAJSONPARSERIMPL_HPP
 
 #include <mutex>
+#include <set>
+#include <unordered_map>
+#include <vector>
 #include "RBAJsonParser.hpp"
+#include "RBAJsonStringArena.hpp"
 #include "RBAModelFactory.hpp"
 
 namespace rba
 {
 
 class RBAJsonElement;
+class RBAModelArena;
 enum class RBAConstraintMap : std::uint8_t;
 
 /// @brief JSON  Parser implementation class
@@ -48,11 +53,29 @@ private:
   virtual void resetFactory();
 
 private:
+  void prepareFactory();
+  RBAModelArena* getArena();
+  RBAModel* finishModel(const RBAJsonElement* const root,
+                        const std::string& filename);
+  void beginStream(const char* const json, const std::size_t jsonSize);
+  bool isStreamTarget(const std::vector<RBAJsonElement*>& queue) const;
+  void streamElement(const std::string& tag,
+                     std::unique_ptr<RBAJsonElement> elem);
+  void endStreamArray(const std::string& tag);
+  void createBufferedElements(const std::string& tag);
   void createConstraintMap(const RBAJsonElement* const constraints,
                            const RBAConstraintMap& kind);
   void createAllocatablesMap(const RBAJsonElement* const allocMap);
-  std::unique_ptr<RBAJsonElement> readJsonFile(const std::string& filename);
-  std::unique_ptr<RBAJsonElement> readJsonString(const std::string& jsonstring);
+  std::unique_ptr<RBAJsonElement> readJsonString(const char* const json,
+                                                 const std::size_t jsonSize);
+  const std::string* internName(const char* const str,
+                                const std::size_t size);
+  static std::string makeString(const char* const str,
+                                const std::size_t size);
+  static std::int32_t parseInt(const char* const str,
+                               const std::size_t size);
+  static std::set<std::string> getTopLevelNames(const char* const json,
+                                                const std::size_t jsonSize);
 
 private:
   enum class Status : std::uint8_t {
@@ -62,6 +85,18 @@ private:
   RBAModelFactory* orgFactory_;
   RBAModelFactory* factory_;
   std::unique_ptr<RBAModelFactory> uniqueFactory_;
+  // Names of the JSON elements being parsed
+  RBAJsonStringArena names_;
+  // Streaming state.
+  // Elements of the tag array that is due in the maker order are passed to
+  // the makers as soon as they are read. The others are kept until all
+  // preceding tags are done.
+  bool streaming_ {false};
+  bool streamError_ {false};
+  std::vector<std::string> streamTags_;
+  std::size_t streamPos_ {0U};
+  std::set<std::string> closedTags_;
+  std::unordered_map<std::string, RBAJsonElement*> streamArrays_;
   std::mutex mutex_;
 };
 
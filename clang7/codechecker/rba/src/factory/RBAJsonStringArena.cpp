@@ -0,0 +1,111 @@
+/**
+ * Copyright (c) 2019 DENSO CORPORATION.
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/// @file  RBAJsonStringArena.cpp
+/// @brief Interned string arena class definition file
+
+#include <cstring>
+#include "RBAJsonStringArena.hpp"
+
+namespace rba
+{
+
+namespace
+{
+const std::size_t INITIAL_SLOTS {256U};
+}
+
+RBAJsonStringArena::RBAJsonStringArena()
+  : slots_(INITIAL_SLOTS, 0U)
+{
+}
+
+/// @brief Returns the interned copy of the string
+/// @param[in] str beginning of the string (need not be null terminated)
+/// @param[in] size length of the string
+/// @return reference to the stored string
+const std::string&
+RBAJsonStringArena::intern(const char* const str, const std::size_t size)
+{
+  const std::uint32_t h {hash(str, size)};
+  const std::size_t mask {slots_.size() - 1U};
+  std::size_t pos {static_cast<std::size_t>(h) & mask};
+  while (slots_[pos] != 0U) {
+    const std::size_t index {static_cast<std::size_t>(slots_[pos]) - 1U};
+    const std::string& stored {strings_[index]};
+    if ((hashes_[index] == h) && (stored.size() == size)
+        && (std::memcmp(stored.data(), str, size) == 0)) {
+      return stored;
+    }
+    pos = (pos + 1U) & mask;
+  }
+  strings_.emplace_back(str, size);
+  hashes_.push_back(h);
+  slots_[pos] = static_cast<std::uint32_t>(strings_.size());
+  // Keep the load factor at or below 1/2
+  if ((strings_.size() * 2U) > slots_.size()) {
+    rehash();
+  }
+  return strings_.back();
+}
+
+const std::string&
+RBAJsonStringArena::intern(const std::string& str)
+{
+  return intern(str.data(), str.size());
+}
+
+std::size_t
+RBAJsonStringArena::getSize() const
+{
+  return strings_.size();
+}
+
+void
+RBAJsonStringArena::clear()
+{
+  strings_.clear();
+  hashes_.clear();
+  slots_.assign(INITIAL_SLOTS, 0U);
+}
+
+/// @brief FNV-1a
+std::uint32_t
+RBAJsonStringArena::hash(const char* const str, const std::size_t size)
+{
+  std::uint32_t h {2166136261U};
+  for (std::size_t i {0U}; i < size; ++i) {
+    h ^= static_cast<std::uint8_t>(str[i]);
+    h *= 16777619U;
+  }
+  return h;
+}
+
+void
+RBAJsonStringArena::rehash()
+{
+  slots_.assign(slots_.size() * 2U, 0U);
+  const std::size_t mask {slots_.size() - 1U};
+  for (std::size_t index {0U}; index < hashes_.size(); ++index) {
+    std::size_t pos {static_cast<std::size_t>(hashes_[index]) & mask};
+    while (slots_[pos] != 0U) {
+      pos = (pos + 1U) & mask;
+    }
+    slots_[pos] = static_cast<std::uint32_t>(index + 1U);
+  }
+}
+
+}
@@ -0,0 +1,76 @@
+/**
+ * Copyright (c) 2019 DENSO CORPORATION.
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/// @file  RBAJsonStringArena.hpp
+/// @brief Interned string arena class header file
+
+#ifndef RBAJSONSTRINGARENA_HPP
+#define RBAJSONSTRINGARENA_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <vector>
+#include "RBADllExport.hpp"
+
+namespace rba
+{
+
+/// @brief Interned string arena
+/// @details Every distinct string is stored once. The returned references
+/// stay valid until clear() is called or the arena is destroyed.
+/// JSON element names come from a small vocabulary ("class", "name",
+/// "operand", ...) so most lookups hit an existing entry.
+class DLL_EXPORT RBAJsonStringArena
+{
+public:
+  RBAJsonStringArena();
+  RBAJsonStringArena(const RBAJsonStringArena&)=delete;
+  RBAJsonStringArena(const RBAJsonStringArena&&)=delete;
+  RBAJsonStringArena& operator=(const RBAJsonStringArena&)=delete;
+  RBAJsonStringArena& operator=(const RBAJsonStringArena&&)=delete;
+  virtual ~RBAJsonStringArena()=default;
+
+public:
+  const std::string& intern(const char* const str, const std::size_t size);
+  const std::string& intern(const std::string& str);
+  std::size_t getSize() const;
+  void clear();
+
+private:
+  static std::uint32_t hash(const char* const str, const std::size_t size);
+  void rehash();
+
+private:
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable:4251)
+#endif
+  // std::deque keeps references to stored elements valid on push_back()
+  std::deque<std::string> strings_;
+  // Open addressing table of (index in strings_ + 1), 0 is an empty slot
+  std::vector<std::uint32_t> slots_;
+  std::vector<std::uint32_t> hashes_;
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+};
+
+}
+
+#endif
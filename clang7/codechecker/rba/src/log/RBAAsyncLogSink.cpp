@@ -0,0 +1,215 @@
+/**
+ * Copyright (c) 2019 DENSO CORPORATION.
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Asynchronous log sink class definition file
+ */
+
+#include <cerrno>
+#include <semaphore.h>
+#include <utility>
+#include "RBAAsyncLogSink.hpp"
+
+namespace rba
+{
+
+#ifdef RBA_USE_LOG
+
+/**
+ * Counting semaphore that the drain thread sleeps on
+ * post() does not take a lock, so the producer never waits for the
+ * drain thread.
+ */
+class RBAAsyncLogSink::WakeSemaphore
+{
+public:
+  WakeSemaphore()
+  {
+    static_cast<void>(::sem_init(&semaphore_, 0, 0U));
+  }
+  WakeSemaphore(const WakeSemaphore&)=delete;
+  WakeSemaphore(const WakeSemaphore&&)=delete;
+  WakeSemaphore& operator=(const WakeSemaphore&)=delete;
+  WakeSemaphore& operator=(const WakeSemaphore&&)=delete;
+  ~WakeSemaphore() noexcept
+  {
+    static_cast<void>(::sem_destroy(&semaphore_));
+  }
+
+  void post()
+  {
+    static_cast<void>(::sem_post(&semaphore_));
+  }
+
+  void wait()
+  {
+    while ((::sem_wait(&semaphore_) != 0) && (errno == EINTR)) {
+      ;
+    }
+  }
+
+private:
+  sem_t semaphore_;
+};
+
+RBAAsyncLogSink::RBAAsyncLogSink(const Deliver& deliver,
+                                 const std::size_t capacity,
+                                 const RBALogOverflowPolicy policy)
+  : deliver_{deliver},
+    policy_{policy},
+    wake_{std::make_unique<WakeSemaphore>()}
+{
+  std::size_t size {2U};
+  while (size < capacity) {
+    size <<= 1U;
+  }
+  ring_.resize(size);
+  mask_ = size - 1U;
+  worker_ = std::thread(&RBAAsyncLogSink::run, this);
+}
+
+RBAAsyncLogSink::~RBAAsyncLogSink() noexcept
+{
+  stop_.store(true);
+  wake_->post();
+  if (worker_.joinable()) {
+    worker_.join();
+  }
+}
+
+/**
+ * Push a log record into the ring buffer
+ *
+ * Must be called from one producer thread only.
+ * @param log log record
+ * @return false if the record was dropped
+ */
+bool
+RBAAsyncLogSink::push(const std::string& log)
+{
+  const std::size_t head {head_.load(std::memory_order_relaxed)};
+  while ((head - tail_.load(std::memory_order_acquire)) > mask_) {
+    if (policy_.load(std::memory_order_relaxed)
+        == RBALogOverflowPolicy::DROP_NEWEST) {
+      static_cast<void>(dropped_.fetch_add(1U, std::memory_order_relaxed));
+      return false;
+    }
+    // BLOCK: the drain thread never sleeps while the ring is not empty
+    wakeUp();
+    std::this_thread::yield();
+  }
+  ring_[head & mask_] = log;
+  static_cast<void>(pushed_.fetch_add(1U, std::memory_order_relaxed));
+  // head_ is stored before sleeping_ is read, and the drain thread sets
+  // sleeping_ before it reads head_, so one of them sees the other
+  head_.store(head + 1U);
+  wakeUp();
+  return true;
+}
+
+/**
+ * Wait until every pushed record has been delivered to the collectors
+ */
+void
+RBAAsyncLogSink::flush()
+{
+  std::unique_lock<std::mutex> lock {mutex_};
+  drainedCond_.wait(lock, [this]() {
+      return delivered_.load() >= pushed_.load();
+    });
+}
+void
+RBAAsyncLogSink::setOverflowPolicy(const RBALogOverflowPolicy policy)
+{
+  policy_.store(policy);
+}
+
+RBALogOverflowPolicy
+RBAAsyncLogSink::getOverflowPolicy() const
+{
+  return policy_.load();
+}
+
+std::size_t
+RBAAsyncLogSink::getCapacity() const
+{
+  return ring_.size();
+}
+
+std::uint64_t
+RBAAsyncLogSink::getPushedCount() const
+{
+  return pushed_.load();
+}
+
+std::uint64_t
+RBAAsyncLogSink::getDeliveredCount() const
+{
+  return delivered_.load();
+}
+
+std::uint64_t
+RBAAsyncLogSink::getDroppedCount() const
+{
+  return dropped_.load();
+}
+
+/**
+ * Drain thread main loop
+ */
+void
+RBAAsyncLogSink::run()
+{
+  while (true) {
+    const std::size_t tail {tail_.load(std::memory_order_relaxed)};
+    if (tail != head_.load(std::memory_order_acquire)) {
+      const std::string log {std::move(ring_[tail & mask_])};
+      tail_.store(tail + 1U, std::memory_order_release);
+      deliver_(log);
+      static_cast<void>(delivered_.fetch_add(1U));
+      continue;
+    }
+    {
+      const std::lock_guard<std::mutex> lock {mutex_};
+      drainedCond_.notify_all();
+    }
+    if (stop_.load()) {
+      break;
+    }
+    sleeping_.store(true);
+    if ((tail == head_.load()) && !stop_.load()) {
+      // A post left over from a wake that was not needed only makes
+      // the loop run once more
+      wake_->wait();
+    }
+    sleeping_.store(false);
+  }
+}
+
+/**
+ * Wake the drain thread if it sleeps, without taking a lock
+ */
+void
+RBAAsyncLogSink::wakeUp()
+{
+  if (sleeping_.exchange(false)) {
+    wake_->post();
+  }
+}
+
+#endif
+
+}
@@ -0,0 +1,122 @@
+/**
+ * Copyright (c) 2019 DENSO CORPORATION.
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Asynchronous log sink class
+ *
+ * Log records are pushed by the arbitration thread into a bounded
+ * single-producer/single-consumer ring buffer and handed to the
+ * collectors by a background thread.
+ * The producer never takes a lock: it wakes the sleeping background
+ * thread through a semaphore.
+ */
+
+#ifndef RBAASYNCLOGSINK_HPP
+#define RBAASYNCLOGSINK_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "RBADllExport.hpp"
+
+namespace rba
+{
+
+#ifdef RBA_USE_LOG
+
+/**
+ * Behavior when the ring buffer is full
+ */
+enum class RBALogOverflowPolicy : std::uint8_t
+{
+  DROP_NEWEST,  // discard the record being pushed
+  BLOCK         // wait until the drain thread frees a slot
+};
+
+class DLL_EXPORT RBAAsyncLogSink
+{
+public:
+  using Deliver = std::function<void(const std::string&)>;
+
+  RBAAsyncLogSink(const Deliver& deliver,
+                  const std::size_t capacity,
+                  const RBALogOverflowPolicy policy);
+  RBAAsyncLogSink(const RBAAsyncLogSink&)=delete;
+  RBAAsyncLogSink(const RBAAsyncLogSink&&)=delete;
+  RBAAsyncLogSink& operator=(const RBAAsyncLogSink&)=delete;
+  RBAAsyncLogSink& operator=(const RBAAsyncLogSink&&)=delete;
+  virtual ~RBAAsyncLogSink() noexcept;
+
+public:
+  // Producer side (single thread only)
+  bool push(const std::string& log);
+  void flush();
+
+  void setOverflowPolicy(const RBALogOverflowPolicy policy);
+  RBALogOverflowPolicy getOverflowPolicy() const;
+  std::size_t getCapacity() const;
+  std::uint64_t getPushedCount() const;
+  std::uint64_t getDeliveredCount() const;
+  std::uint64_t getDroppedCount() const;
+
+private:
+  class WakeSemaphore;
+
+  void run();
+  void wakeUp();
+
+private:
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable:4251)
+#endif
+  Deliver deliver_;
+  std::vector<std::string> ring_;
+  // Capacity is a power of two so that the index can be masked
+  std::size_t mask_ {0U};
+  // Written only by the producer
+  std::atomic<std::size_t> head_ {0U};
+  // Written only by the drain thread
+  std::atomic<std::size_t> tail_ {0U};
+  std::atomic<RBALogOverflowPolicy> policy_;
+  std::atomic<std::uint64_t> pushed_ {0U};
+  std::atomic<std::uint64_t> delivered_ {0U};
+  std::atomic<std::uint64_t> dropped_ {0U};
+  std::atomic<bool> stop_ {false};
+  // Set by the drain thread before it sleeps, cleared by the one who wakes it
+  std::atomic<bool> sleeping_ {false};
+  std::unique_ptr<WakeSemaphore> wake_;
+  // Used only by flush() and the drain thread
+  std::mutex mutex_;
+  std::condition_variable drainedCond_;
+  std::thread worker_;
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+};
+
+#endif
+
+}
+
+#endif
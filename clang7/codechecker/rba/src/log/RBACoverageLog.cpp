@@ -23,7 +23,6 @@
 #include "RBACoverageLog.hpp"
 
 #include "RBAExpression.hpp"
-#include "RBALog.hpp"
 #include "RBAAbstractConstraint.hpp"
 #include "RBAConstraintImpl.hpp"
 #include "RBAILogCollector.hpp"
@@ -41,6 +40,7 @@ const std::string RBACoverageLog::END = "END";
 const std::string RBACoverageLog::EXPRESSION = "EXPRESSION";
 const std::string RBACoverageLog::CONSTRAINT = "Constraint";
 const std::string RBACoverageLog::RULE = "Rule";
+const std::size_t RBACoverageLog::DEFAULT_ASYNC_CAPACITY;
 
 /**
  * Add request log in one line
@@ -84,12 +84,14 @@ RBACoverageLog::addStartLogLine(const std::string& log)
 void
 RBACoverageLog::addCoverageLogCollector(RBAILogCollector* collector)
 {
+  const std::lock_guard<std::mutex> lock {collectorsMutex_};
   collectors_.insert(collector);
 }
 
 void
 RBACoverageLog::removeCoverageLogCollector(RBAILogCollector* collector)
 {
+  const std::lock_guard<std::mutex> lock {collectorsMutex_};
   auto it = std::find(collectors_.begin(), collectors_.end(), collector);
   if(it != collectors_.end()) {
     collectors_.erase(it);
@@ -345,13 +347,110 @@ RBACoverageLog::getExpressionType(const RBAExpression* expression) const
   }
 }
 
+// ---------------------------------------------------------
+// Asynchronous delivery
+// ---------------------------------------------------------
+
+/**
+ * Switch between synchronous and asynchronous delivery to the collectors
+ *
+ * When enabled, log records are queued in a bounded ring buffer and
+ * delivered by a background thread, so a slow collector no longer
+ * stalls arbitration. Records still queued are delivered before the
+ * sink is disabled.
+ *
+ * @param sw true: asynchronous, false: synchronous
+ * @param capacity number of records (rounded up to a power of two)
+ * @param policy behavior when the ring buffer is full
+ */
+void
+RBACoverageLog::setAsyncEnable(const bool sw, const std::size_t capacity,
+                               const RBALogOverflowPolicy policy)
+{
+  if (sink_ != nullptr) {
+    droppedLogCount_ += sink_->getDroppedCount();
+    pushedLogCount_ += sink_->getPushedCount();
+    sink_.reset();
+  }
+  if (sw) {
+    sink_ = std::make_unique<RBAAsyncLogSink>(
+        [this](const std::string& log) { deliverFromSink(log); },
+        capacity, policy);
+  }
+}
+
+bool
+RBACoverageLog::isAsyncEnabled() const
+{
+  return (sink_ != nullptr);
+}
+
+/**
+ * Wait until every queued log record has been delivered
+ */
+void
+RBACoverageLog::flush()
+{
+  if (sink_ != nullptr) {
+    sink_->flush();
+  }
+}
+
+/**
+ * Returns the number of log records discarded because the ring buffer
+ * was full
+ */
+std::uint64_t
+RBACoverageLog::getDroppedLogCount() const
+{
+  std::uint64_t count {droppedLogCount_};
+  if (sink_ != nullptr) {
+    count += sink_->getDroppedCount();
+  }
+  return count;
+}
+
+/**
+ * Returns the number of log records queued to the asynchronous sink
+ */
+std::uint64_t
+RBACoverageLog::getPushedLogCount() const
+{
+  std::uint64_t count {pushedLogCount_};
+  if (sink_ != nullptr) {
+    count += sink_->getPushedCount();
+  }
+  return count;
+}
+
 void
 RBACoverageLog::notify(const std::string& log)
+{
+  if (sink_ != nullptr) {
+    static_cast<void>(sink_->push(log));
+  } else {
+    deliver(log);
+  }
+}
+
+void
+RBACoverageLog::deliver(const std::string& log)
 {
   for(RBAILogCollector* collector : collectors_) {
     collector->log(log);
   }
 }
+
+/**
+ * Deliver a log record on the drain thread of the asynchronous sink
+ * Only this path competes with adding and removing collectors.
+ */
+void
+RBACoverageLog::deliverFromSink(const std::string& log)
+{
+  const std::lock_guard<std::mutex> lock {collectorsMutex_};
+  deliver(log);
+}
 #endif
 
 }
@@ -21,16 +21,18 @@
 #ifndef RBACOVERAGELOG_HPP
 #define RBACOVERAGELOG_HPP
 
+#include <memory>
+#include <mutex>
 #include <vector>
 #include <set>
 #include "RBAILogCollector.hpp"
+#include "RBAAsyncLogSink.hpp"
 #include "RBAExecuteResult.hpp"
 
 namespace rba
 {
 
 #ifdef RBA_USE_LOG
-class RBALog;
 class RBAExpression;
 class RBAAbstractConstraint;
 
@@ -68,8 +70,19 @@ public:
   bool addHierarchy(const std::string& data);
   void removeHierarchy();
   std::string getExpressionType(const RBAExpression* expression) const;
+  void setAsyncEnable(const bool sw,
+                      const std::size_t capacity=DEFAULT_ASYNC_CAPACITY,
+                      const RBALogOverflowPolicy policy
+                        =RBALogOverflowPolicy::DROP_NEWEST);
+  bool isAsyncEnabled() const;
+  void flush();
+  std::uint64_t getDroppedLogCount() const;
+  std::uint64_t getPushedLogCount() const;
 
 public:
+  // Default number of records held by the asynchronous sink
+  const static std::size_t DEFAULT_ASYNC_CAPACITY {4096U};
+
 #ifdef _MSC_VER
 #pragma warning(push)
 #pragma warning(disable:4251)
@@ -88,8 +101,9 @@ public:
 #endif
 
 private:
-  std::string createLog(std::vector<RBALog*> logs);
   void notify(const std::string& log);
+  void deliver(const std::string& log);
+  void deliverFromSink(const std::string& log);
 
 private:
 #ifdef _MSC_VER
@@ -98,15 +112,13 @@ private:
 #endif
   std::vector<std::string> hierarchys_; // Constraint hierarchy (x#y#z format)
   std::set<RBAILogCollector*> collectors_;
-  std::vector<RBALog*> requestLogs_;
-  std::vector<RBALog*> resultLogs_;
-  std::vector<RBALog*> constraintLogs;
-  std::vector<RBALog*> canceledRequestLogs_;
-
-    // Constraint structure log for finding the denominator of 
-  // constraint coverage. The constraint log is different 
-  // because it also has the execution result.
-  std::vector<RBALog*> hierarchyOfConstraintLogs_;
+  // Guards collectors_ against the drain thread of sink_
+  std::mutex collectorsMutex_;
+  // Counters of the sink that was last disabled
+  std::uint64_t droppedLogCount_ {0U};
+  std::uint64_t pushedLogCount_ {0U};
+  // Declared last so that the drain thread stops before collectors_ goes away
+  std::unique_ptr<RBAAsyncLogSink> sink_;
 #ifdef _MSC_VER
 #pragma warning(pop)
 #endif
@@ -303,6 +303,25 @@ RBALogManager::removeCoverageLogCollector(RBAILogCollector* collector)
   coverageLog_.removeCoverageLogCollector(collector);
 }
 
+void
+RBALogManager::setCoverageLogAsync(const bool sw, const std::size_t capacity,
+                                   const RBALogOverflowPolicy policy)
+{
+  coverageLog_.setAsyncEnable(sw, capacity, policy);
+}
+
+void
+RBALogManager::flushCoverageLog()
+{
+  coverageLog_.flush();
+}
+
+std::uint64_t
+RBALogManager::getCoverageLogDroppedCount() const
+{
+  return coverageLog_.getDroppedLogCount();
+}
+
 void
 RBALogManager::coverageHierarchyOfConstraintLogLine(const std::string& message)
 {
@@ -853,6 +872,10 @@ RBALogManager::boolToString(const bool value)
 void
 RBALogManager::setIndent(std::int32_t nest)
 {
+  // Arbitrators on other threads share indent_, which is only for the log
+  if(instance_ == nullptr) {
+    return;
+  }
   indent_ = "";
   for (std::int32_t i = 0; i < nest; ++i) {
     indent_ += "    ";
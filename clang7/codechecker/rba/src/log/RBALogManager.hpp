@@ -29,6 +29,8 @@
 namespace rba
 {
 
+class RBALog;
+
 class DLL_EXPORT RBALogManager
 {
 public:
@@ -43,6 +45,13 @@ public:
   static void init(int32_t level);
   void addCoverageLogCollector(RBAILogCollector* collector);
   void removeCoverageLogCollector(RBAILogCollector* collector);
+  void setCoverageLogAsync(const bool sw,
+                           const std::size_t capacity
+                             =RBACoverageLog::DEFAULT_ASYNC_CAPACITY,
+                           const RBALogOverflowPolicy policy
+                             =RBALogOverflowPolicy::DROP_NEWEST);
+  void flushCoverageLog();
+  std::uint64_t getCoverageLogDroppedCount() const;
   static void addStartLogLine(const std::string& log);
   static void coverageHierarchyOfConstraintLogLine(const std::string& message);
   static void setLogManager(RBALogManager* logManager);
@@ -173,30 +182,40 @@ private:
 // [Explanation that there is no problem even if it deviates from the rules]
 //   Do not modify because it will cause processing load 
 //   if it is not a function macro
+// The messages are not built while no log manager is set.
 #define LOG_initConstraintHierarchy() \
   rba::RBALogManager::initConstraintHierarchy()
 #define LOG_removeHierarchy() \
   rba::RBALogManager::removeHierarchy()
 #define LOG_coverageHierarchyOfConstraintStartLog(log) \
-  rba::RBALogManager::coverageHierarchyOfConstraintStartLog(log)
+  do { if (rba::RBALogManager::getLogManager() != nullptr) { \
+    static_cast<void>(rba::RBALogManager::coverageHierarchyOfConstraintStartLog(log)); } } while(false)
 #define LOG_coverageHierarchyOfConstraintEndLog(log) \
-  rba::RBALogManager::coverageHierarchyOfConstraintEndLog(log)
+  do { if (rba::RBALogManager::getLogManager() != nullptr) { \
+    static_cast<void>(rba::RBALogManager::coverageHierarchyOfConstraintEndLog(log)); } } while(false)
 #define LOG_addCoverageLogCollector(collector) \
   rba::RBALogManager::addCoverageLogCollector(collector)
 #define LOG_addHierarchy(log) \
-  rba::RBALogManager::addHierarchy(log)
+  do { if (rba::RBALogManager::getLogManager() != nullptr) { \
+    static_cast<void>(rba::RBALogManager::addHierarchy(log)); } } while(false)
 #define LOG_allConstraintLogLine(log) \
-  rba::RBALogManager::allConstraintLogLine(log)
+  do { if (rba::RBALogManager::getLogManager() != nullptr) { \
+    static_cast<void>(rba::RBALogManager::allConstraintLogLine(log)); } } while(false)
 #define LOG_arbitrateAreaLogLine(log) \
-  rba::RBALogManager::arbitrateAreaLogLine(log)
+  do { if (rba::RBALogManager::getLogManager() != nullptr) { \
+    static_cast<void>(rba::RBALogManager::arbitrateAreaLogLine(log)); } } while(false)
 #define LOG_arbitrateConstraintLogLine(log) \
-  rba::RBALogManager::arbitrateConstraintLogLine(log)
+  do { if (rba::RBALogManager::getLogManager() != nullptr) { \
+    static_cast<void>(rba::RBALogManager::arbitrateConstraintLogLine(log)); } } while(false)
 #define LOG_arbitrateConstraintLogicLogLine(log) \
-  rba::RBALogManager::arbitrateConstraintLogicLogLine(log)
+  do { if (rba::RBALogManager::getLogManager() != nullptr) { \
+    static_cast<void>(rba::RBALogManager::arbitrateConstraintLogicLogLine(log)); } } while(false)
 #define LOG_coverageConstraintExpressionLog(log, flag) \
-  rba::RBALogManager::coverageConstraintExpressionLog(log, flag)
+  do { if (rba::RBALogManager::getLogManager() != nullptr) { \
+    rba::RBALogManager::coverageConstraintExpressionLog(log, flag); } } while(false)
 #define LOG_coverageConstraintExpressionLog2(log) \
-  rba::RBALogManager::coverageConstraintExpressionLog(log)
+  do { if (rba::RBALogManager::getLogManager() != nullptr) { \
+    rba::RBALogManager::coverageConstraintExpressionLog(log); } } while(false)
 #define LOG_coverageConstraintStartLog(constraint) \
   rba::RBALogManager::coverageConstraintStartLog(constraint)
 #define LOG_coverageConstraintEndLog(constraint) \
@@ -0,0 +1,512 @@
+/**
+ * Copyright (c) 2019 DENSO CORPORATION.
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Affect allocatable collector class definition file
+ */
+
+#include <algorithm>
+#include <memory>
+
+#include "RBAAffectAllocatableCollector.hpp"
+
+#include "RBAActiveContents.hpp"
+#include "RBAActiveState.hpp"
+#include "RBAAllInstanceOfArea.hpp"
+#include "RBAAllInstanceOfSoundContent.hpp"
+#include "RBAAllInstanceOfViewContent.hpp"
+#include "RBAAllInstanceOfZone.hpp"
+#include "RBAAllocatableSet.hpp"
+#include "RBAAllocatedContent.hpp"
+#include "RBAAndOperator.hpp"
+#include "RBAAreaImpl.hpp"
+#include "RBAConstantExpression.hpp"
+#include "RBAConstraintImpl.hpp"
+#include "RBAContentSet.hpp"
+#include "RBAContentState.hpp"
+#include "RBAContentValue.hpp"
+#include "RBADisplayingContent.hpp"
+#include "RBAExistsOperator.hpp"
+#include "RBAForAllOperator.hpp"
+#include "RBAGetAllocatables.hpp"
+#include "RBAGetContentsList.hpp"
+#include "RBAGetProperty.hpp"
+#include "RBAHasBeenDisplayed.hpp"
+#include "RBAHasComeEarlierThan.hpp"
+#include "RBAHasComeLaterThan.hpp"
+#include "RBAIfStatement.hpp"
+#include "RBAImpliesOperator.hpp"
+#include "RBAIntegerValue.hpp"
+#include "RBAIsActive.hpp"
+#include "RBAIsAttenuated.hpp"
+#include "RBAIsDisplayed.hpp"
+#include "RBAIsEqualToOperator.hpp"
+#include "RBAIsGreaterThanEqualOperator.hpp"
+#include "RBAIsGreaterThanOperator.hpp"
+#include "RBAIsHidden.hpp"
+#include "RBAIsLowerThanEqualOperator.hpp"
+#include "RBAIsLowerThanOperator.hpp"
+#include "RBAIsMuted.hpp"
+#include "RBAIsOn.hpp"
+#include "RBAIsOutputted.hpp"
+#include "RBAIsSounding.hpp"
+#include "RBAIsTypeOfOperator.hpp"
+#include "RBAIsVisible.hpp"
+#include "RBALambdaExpression.hpp"
+#include "RBALetStatement.hpp"
+#include "RBAMaxOperator.hpp"
+#include "RBAMinOperator.hpp"
+#include "RBAModelElementType.hpp"
+#include "RBAModelImpl.hpp"
+#include "RBANotOperator.hpp"
+#include "RBAObjectCompare.hpp"
+#include "RBAObjectReference.hpp"
+#include "RBAOrOperator.hpp"
+#include "RBAOutputtingSound.hpp"
+#include "RBAPreviousModifier.hpp"
+#include "RBASelectOperator.hpp"
+#include "RBASetOfOperator.hpp"
+#include "RBASizeOperator.hpp"
+#include "RBASoundContentImpl.hpp"
+#include "RBAStateValue.hpp"
+#include "RBAViewContentImpl.hpp"
+#include "RBAZoneImpl.hpp"
+
+namespace rba
+{
+
+RBAAffectAllocatableCollector::RBAAffectAllocatableCollector(RBAModelImpl* const model)
+    : RBAExpressionVisitor(),
+      model_{model}
+{
+}
+
+/**
+ * Set the allocatables that each constraint of the model can affect
+ */
+void RBAAffectAllocatableCollector::collect()
+{
+  // The bits of the constraints are the indexes of the allocatables
+  model_->createSortedAllocatables();
+  for (const RBAAllocatable* const allocatable : model_->getAllocatables()) {
+    std::set<const RBAContent*>& contents {allocatableContents_[allocatable]};
+    contents.insert(allocatable->getInternalContents().begin(),
+                    allocatable->getInternalContents().end());
+  }
+  for (const RBAContent* const content : model_->getContents()) {
+    for (const RBAAllocatable* const allocatable : content->getAllocatables()) {
+      static_cast<void>(allocatableContents_[allocatable].insert(content));
+    }
+  }
+
+  const std::size_t allocatableCount {model_->getAllocatables().size()};
+  for (const RBAConstraintImpl* const constraint : model_->getConstraintImpls()) {
+    unknown_ = false;
+    followsContents_ = false;
+    allocatables_.clear();
+    contents_.clear();
+    collectExpression(constraint->getExpression());
+    const_cast<RBAConstraintImpl*>(constraint)->setAffectAllocatables(
+        getAffectAllocatables(), allocatableCount);
+  }
+}
+
+// area status
+void RBAAffectAllocatableCollector::visit(RBAIsDisplayed& exp)
+{
+  collectOperands(exp);
+}
+void RBAAffectAllocatableCollector::visit(RBADisplayingContent& exp)
+{
+  followsContents_ = true;
+  collectOperands(exp);
+}
+void RBAAffectAllocatableCollector::visit(RBAAllocatedContent& exp)
+{
+  followsContents_ = true;
+  collectOperands(exp);
+}
+void RBAAffectAllocatableCollector::visit(RBAIsHidden& exp)
+{
+  collectOperands(exp);
+}
+void RBAAffectAllocatableCollector::visit(RBAContentValue& exp)
+{
+  collectOperands(exp);
+}
+void RBAAffectAllocatableCollector::visit(RBAGetContentsList& exp)
+{
+  followsContents_ = true;
+  collectOperands(exp);
+}
+void RBAAffectAllocatableCollector::visit(RBAActiveContents& exp)
+{
+  followsContents_ = true;
+  collectOperands(exp);
+}
+
+// display content status
+void RBAAffectAllocatableCollector::visit(RBAIsActive& exp)
+{
+  collectOperands(exp);
+}
+void RBAAffectAllocatableCollector::visit(RBAIsVisible& exp)
+{
+  collectOperands(exp);
+}
+void RBAAffectAllocatableCollector::visit(RBAStateValue& exp)
+{
+  collectOperands(exp);
+}
+void RBAAffectAllocatableCollector::visit(RBAHasBeenDisplayed& exp)
+{
+  collectOperands(exp);
+}
+void RBAAffectAllocatableCollector::visit(RBAHasComeEarlierThan& exp)
+{
+  collectOperands(exp);
+}
+void RBAAffectAllocatableCollector::visit(RBAHasComeLaterThan& exp)
+{
+  collectOperands(exp);
+}
+void RBAAffectAllocatableCollector::visit(RBAGetAllocatables& exp)
+{
+  // The allocatables of a content are always added
+  collectOperands(exp);
+}
+void RBAAffectAllocatableCollector::visit(RBAActiveState& exp)
+{
+  collectOperands(exp);
+}
+
+// zone status
+void RBAAffectAllocatableCollector::visit(RBAIsOutputted& exp)
+{
+  collectOperands(exp);
+}
+void RBAAffectAllocatableCollector::visit(RBAOutputtingSound& exp)
+{
+  followsContents_ = true;
+  collectOperands(exp);
+}
+void RBAAffectAllocatableCollector::visit(RBAIsMuted& exp)
+{
+  collectOperands(exp);
+}
+void RBAAffectAllocatableCollector::visit(RBAIsAttenuated& exp)
+{
+  collectOperands(exp);
+}
+
+// sound content status
+void RBAAffectAllocatableCollector::visit(RBAIsSounding& exp)
+{
+  collectOperands(exp);
+}
+
+// scene
+void RBAAffectAllocatableCollector::visit(RBAIsOn& exp)
+{
+  collectOperands(exp);
+}
+void RBAAffectAllocatableCollector::visit(RBAGetProperty& exp)
+{
+  collectOperands(exp);
+}
+void RBAAffectAllocatableCollector::visit(RBAIsTypeOfOperator& exp)
+{
+  collectOperands(exp);
+}
+
+// operator
+void RBAAffectAllocatableCollector::visit(RBAAndOperator& exp)
+{
+  collectOperands(exp);
+}
+void RBAAffectAllocatableCollector::visit(RBAOrOperator& exp)
+{
+  collectOperands(exp);
+}
+void RBAAffectAllocatableCollector::visit(RBANotOperator& exp)
+{
+  collectOperands(exp);
+}
+void RBAAffectAllocatableCollector::visit(RBAImpliesOperator& exp)
+{
+  collectOperands(exp);
+}
+void RBAAffectAllocatableCollector::visit(RBAIsEqualToOperator& exp)
+{
+  collectOperands(exp);
+}
+void RBAAffectAllocatableCollector::visit(RBAObjectCompare& exp)
+{
+  collectOperands(exp);
+}
+void RBAAffectAllocatableCollector::visit(RBAIsGreaterThanOperator& exp)
+{
+  collectOperands(exp);
+}
+void RBAAffectAllocatableCollector::visit(RBAIsGreaterThanEqualOperator& exp)
+{
+  collectOperands(exp);
+}
+void RBAAffectAllocatableCollector::visit(RBAIsLowerThanOperator& exp)
+{
+  collectOperands(exp);
+}
+void RBAAffectAllocatableCollector::visit(RBAIsLowerThanEqualOperator& exp)
+{
+  collectOperands(exp);
+}
+
+// Quantification symbol
+void RBAAffectAllocatableCollector::visit(RBAForAllOperator& exp)
+{
+  collectLambda(exp);
+}
+void RBAAffectAllocatableCollector::visit(RBAExistsOperator& exp)
+{
+  collectLambda(exp);
+}
+
+// Built-in definition expression
+void RBAAffectAllocatableCollector::visit(RBAAllInstanceOfArea& exp)
+{
+  visited_ = true;
+  for (const RBAAreaImpl* const area : model_->getAreaImpls()) {
+    addObject(area);
+  }
+}
+void RBAAffectAllocatableCollector::visit(RBAAllInstanceOfViewContent& exp)
+{
+  visited_ = true;
+  for (const RBAViewContentImpl* const content : model_->getViewContentImpls()) {
+    addObject(content);
+  }
+}
+void RBAAffectAllocatableCollector::visit(RBAAllInstanceOfZone& exp)
+{
+  visited_ = true;
+  for (const RBAZoneImpl* const zone : model_->getZoneImpls()) {
+    addObject(zone);
+  }
+}
+void RBAAffectAllocatableCollector::visit(RBAAllInstanceOfSoundContent& exp)
+{
+  visited_ = true;
+  for (const RBASoundContentImpl* const content : model_->getSoundContentImpls()) {
+    addObject(content);
+  }
+}
+
+// statement
+void RBAAffectAllocatableCollector::visit(RBAIfStatement& exp)
+{
+  visited_ = true;
+  collectExpression(exp.getCondition());
+  collectExpression(exp.getThenExpression());
+  collectExpression(exp.getElseExpression());
+}
+void RBAAffectAllocatableCollector::visit(RBALetStatement& exp)
+{
+  collectOperands(exp);
+}
+
+// modifier
+void RBAAffectAllocatableCollector::visit(RBAPreviousModifier& exp)
+{
+  visited_ = true;
+  collectExpression(exp.getObjReference());
+}
+
+// operator
+void RBAAffectAllocatableCollector::visit(RBAMaxOperator& exp)
+{
+  collectLambda(exp);
+}
+void RBAAffectAllocatableCollector::visit(RBAMinOperator& exp)
+{
+  collectLambda(exp);
+}
+void RBAAffectAllocatableCollector::visit(RBASelectOperator& exp)
+{
+  collectLambda(exp);
+}
+void RBAAffectAllocatableCollector::visit(RBASizeOperator& exp)
+{
+  collectOperands(exp);
+}
+
+// object reference
+void RBAAffectAllocatableCollector::visit(RBAObjectReference& exp)
+{
+  visited_ = true;
+  addObject(exp.getRefObject());
+}
+void RBAAffectAllocatableCollector::visit(RBASetOfOperator& exp)
+{
+  collectOperands(exp);
+}
+
+/**
+ * Collect the objects that an expression and its children refer to
+ */
+void
+RBAAffectAllocatableCollector::collectExpression(RBAExpression* const exp)
+{
+  if (exp == nullptr) {
+    return;
+  }
+  for (RBALetStatement* const letStatement : exp->getLetStatements()) {
+    collectExpression(letStatement);
+  }
+
+  // Expressions that have no accept()
+  const RBAConstantExpression* const constant
+    {dynamic_cast<const RBAConstantExpression*>(exp)};
+  if (constant != nullptr) {
+    addObject(constant->getObject());
+    return;
+  }
+  if (dynamic_cast<const RBAIntegerValue*>(exp) != nullptr) {
+    return;
+  }
+
+  const bool outerVisited {visited_};
+  visited_ = false;
+  exp->accept(*this);
+  if (!visited_) {
+    // The operands of an operator that is not visited are collected,
+    // and an other expression may refer to any allocatable
+    const RBAOperator* const ope {dynamic_cast<const RBAOperator*>(exp)};
+    if (ope != nullptr) {
+      collectOperands(*ope);
+    } else {
+      unknown_ = true;
+    }
+  }
+  visited_ = outerVisited;
+}
+
+void RBAAffectAllocatableCollector::collectOperands(const RBAOperator& exp)
+{
+  visited_ = true;
+  for (RBAExpression* const ope : exp.getOperand()) {
+    collectExpression(ope);
+  }
+}
+
+void RBAAffectAllocatableCollector::collectLambda(const RBALambdaContext& exp)
+{
+  collectOperands(exp);
+  const RBALambdaExpression* const lambda {exp.getLambda()};
+  if (lambda != nullptr) {
+    collectExpression(lambda->getBodyText());
+  }
+}
+
+/**
+ * Add an object that the constraint refers to
+ * The elements of a set and the owner of a content state are added
+ * instead. Variables are not added because they refer to the elements
+ * of a set or to the results of the other expressions.
+ */
+void RBAAffectAllocatableCollector::addObject(const RBARuleObject* const object)
+{
+  if (object == nullptr) {
+    return;
+  }
+  const RBARuleObject* const raw {object->getRawObject()};
+  const RBAAllocatableSet* const allocatableSet
+    {dynamic_cast<const RBAAllocatableSet*>(raw)};
+  const RBAContentSet* const contentSet
+    {dynamic_cast<const RBAContentSet*>(raw)};
+  const RBAContentState* const state
+    {dynamic_cast<const RBAContentState*>(raw)};
+  const RBAAllocatable* const allocatable
+    {dynamic_cast<const RBAAllocatable*>(raw)};
+  const RBAContent* const content {dynamic_cast<const RBAContent*>(raw)};
+  if (allocatableSet != nullptr) {
+    allocatables_.insert(allocatableSet->getLeafAllocatable().begin(),
+                         allocatableSet->getLeafAllocatable().end());
+  } else if (contentSet != nullptr) {
+    contents_.insert(contentSet->getLeafContent().begin(),
+                     contentSet->getLeafContent().end());
+  } else if (state != nullptr) {
+    addObject(state->getOwner());
+  } else if (allocatable != nullptr) {
+    static_cast<void>(allocatables_.insert(allocatable));
+  } else if (content != nullptr) {
+    static_cast<void>(contents_.insert(content));
+  } else {
+    // Scenes, properties and the others have no allocatable
+  }
+}
+
+/**
+ * Follow the contents and the allocatables from the objects of
+ * the constraint being visited
+ * @return allocatables sorted by the index
+ */
+std::vector<const RBAAllocatable*>
+RBAAffectAllocatableCollector::getAffectAllocatables() const
+{
+  std::vector<const RBAAllocatable*> result;
+  if (unknown_) {
+    for (const RBAAllocatable* const allocatable : model_->getSortedAllocatables()) {
+      result.push_back(allocatable);
+    }
+    return result;
+  }
+
+  std::set<const RBAAllocatable*> allocatables {allocatables_};
+  std::set<const RBAContent*> contents {contents_};
+  std::vector<const RBAAllocatable*> newAllocatables {allocatables.begin(),
+                                                       allocatables.end()};
+  std::vector<const RBAContent*> newContents {contents.begin(), contents.end()};
+  while (!newAllocatables.empty() || !newContents.empty()) {
+    std::vector<const RBAContent*> nextContents;
+    if (followsContents_) {
+      for (const RBAAllocatable* const allocatable : newAllocatables) {
+        const auto it = allocatableContents_.find(allocatable);
+        if (it != allocatableContents_.end()) {
+          for (const RBAContent* const content : it->second) {
+            if (contents.insert(content).second) {
+              nextContents.push_back(content);
+            }
+          }
+        }
+      }
+    }
+    newAllocatables.clear();
+    for (const RBAContent* const content : newContents) {
+      for (const RBAAllocatable* const allocatable : content->getAllocatables()) {
+        if (allocatables.insert(allocatable).second) {
+          newAllocatables.push_back(allocatable);
+        }
+      }
+    }
+    newContents.swap(nextContents);
+  }
+
+  result.assign(allocatables.begin(), allocatables.end());
+  std::sort(result.begin(), result.end(), &RBAAllocatable::compareIndex);
+  return result;
+}
+
+} /* namespace rba */
@@ -0,0 +1,160 @@
+/**
+ * Copyright (c) 2019 DENSO CORPORATION.
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Affect allocatable collector class header file
+ *
+ * Finds, for each constraint of a model, the allocatables that can be put
+ * in its ConstraintInfo, which are the allocatables that the constraint
+ * can affect when it is not satisfied.
+ * The allocatables are found from the objects that the expression refers
+ * to. A content stands for its allocatables, and the allocatables are
+ * followed to their contents if the expression takes the contents of an
+ * allocatable. The result may contain allocatables that the evaluation
+ * never puts, so the arbitrator uses it only to skip the collection of
+ * the allocatables from the ConstraintInfo.
+ */
+
+#ifndef RBAAFFECTALLOCATABLECOLLECTOR_HPP
+#define RBAAFFECTALLOCATABLECOLLECTOR_HPP
+
+#include <map>
+#include <set>
+#include <vector>
+
+#include "RBAExpressionVisitor.hpp"
+
+namespace rba
+{
+
+class RBAModelImpl;
+class RBAAllocatable;
+class RBAContent;
+class RBAExpression;
+class RBAOperator;
+class RBALambdaContext;
+class RBARuleObject;
+
+class RBAAffectAllocatableCollector : public RBAExpressionVisitor
+{
+ public:
+  explicit RBAAffectAllocatableCollector(RBAModelImpl* const model);
+  RBAAffectAllocatableCollector(const RBAAffectAllocatableCollector&)=delete;
+  RBAAffectAllocatableCollector(const RBAAffectAllocatableCollector&&)=delete;
+  RBAAffectAllocatableCollector& operator=(const RBAAffectAllocatableCollector&)=delete;
+  RBAAffectAllocatableCollector& operator=(const RBAAffectAllocatableCollector&&)=delete;
+  virtual ~RBAAffectAllocatableCollector()=default;
+
+  void collect();
+
+  // area status
+  void visit(RBAIsDisplayed& exp) override;
+  void visit(RBADisplayingContent& exp) override;
+  void visit(RBAAllocatedContent& exp) override;
+  void visit(RBAIsHidden& exp) override;
+  void visit(RBAContentValue& exp) override;
+  void visit(RBAGetContentsList& exp) override;
+  void visit(RBAActiveContents& exp) override;
+
+  // display content status
+  void visit(RBAIsActive& exp) override;
+  void visit(RBAIsVisible& exp) override;
+  void visit(RBAStateValue& exp) override;
+  void visit(RBAHasBeenDisplayed& exp) override;
+  void visit(RBAHasComeEarlierThan& exp) override;
+  void visit(RBAHasComeLaterThan& exp) override;
+  void visit(RBAGetAllocatables& exp) override;
+  void visit(RBAActiveState& exp) override;
+
+  // zone status
+  void visit(RBAIsOutputted& exp) override;
+  void visit(RBAOutputtingSound& exp) override;
+  void visit(RBAIsMuted& exp) override;
+  void visit(RBAIsAttenuated& exp) override;
+
+  // sound content status
+  void visit(RBAIsSounding& exp) override;
+
+  // scene
+  void visit(RBAIsOn& exp) override;
+  void visit(RBAGetProperty& exp) override;
+
+  void visit(RBAIsTypeOfOperator& exp) override;
+
+  // operator
+  void visit(RBAAndOperator& exp) override;
+  void visit(RBAOrOperator& exp) override;
+  void visit(RBANotOperator& exp) override;
+  void visit(RBAImpliesOperator& exp) override;
+  void visit(RBAIsEqualToOperator& exp) override;
+  void visit(RBAObjectCompare& exp) override;
+  void visit(RBAIsGreaterThanOperator& exp) override;
+  void visit(RBAIsGreaterThanEqualOperator& exp) override;
+  void visit(RBAIsLowerThanOperator& exp) override;
+  void visit(RBAIsLowerThanEqualOperator& exp) override;
+
+  // Quantification symbol
+  void visit(RBAForAllOperator& exp) override;
+  void visit(RBAExistsOperator& exp) override;
+
+  // Built-in definition expression
+  void visit(RBAAllInstanceOfArea& exp) override;
+  void visit(RBAAllInstanceOfViewContent& exp) override;
+  void visit(RBAAllInstanceOfZone& exp) override;
+  void visit(RBAAllInstanceOfSoundContent& exp) override;
+
+  // statement
+  void visit(RBAIfStatement& exp) override;
+  void visit(RBALetStatement& exp) override;
+
+  // modifier
+  void visit(RBAPreviousModifier& exp) override;
+
+  // operator
+  void visit(RBAMaxOperator& exp) override;
+  void visit(RBAMinOperator& exp) override;
+  void visit(RBASelectOperator& exp) override;
+  void visit(RBASizeOperator& exp) override;
+
+  // object reference
+  void visit(RBAObjectReference& exp) override;
+  void visit(RBASetOfOperator& exp) override;
+
+ private:
+  void collectExpression(RBAExpression* const exp);
+  void collectOperands(const RBAOperator& exp);
+  void collectLambda(const RBALambdaContext& exp);
+  void addObject(const RBARuleObject* const object);
+  std::vector<const RBAAllocatable*> getAffectAllocatables() const;
+
+ private:
+  RBAModelImpl* model_;
+  // Contents that can be allocated to each allocatable
+  std::map<const RBAAllocatable*, std::set<const RBAContent*>> allocatableContents_;
+  // true if the expression being visited has been visited by accept()
+  bool visited_ {false};
+  // true if the constraint being visited refers to an unknown object
+  bool unknown_ {false};
+  // true if the constraint being visited takes the contents of an allocatable
+  bool followsContents_ {false};
+  // Objects that the constraint being visited refers to
+  std::set<const RBAAllocatable*> allocatables_;
+  std::set<const RBAContent*> contents_;
+};
+
+} /* namespace rba */
+
+#endif /* RBAAFFECTALLOCATABLECOLLECTOR_HPP */
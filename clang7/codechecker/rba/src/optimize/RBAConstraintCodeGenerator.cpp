@@ -0,0 +1,737 @@
+/**
+ * Copyright (c) 2019 DENSO CORPORATION.
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Constraint code generator class definition file
+ */
+
+#include <iomanip>
+
+#include "RBAConstraintCodeGenerator.hpp"
+
+#include "RBAAllocatable.hpp"
+#include "RBAAndOperator.hpp"
+#include "RBAConstraintImpl.hpp"
+#include "RBAConstraintPlugin.hpp"
+#include "RBAContent.hpp"
+#include "RBAImpliesOperator.hpp"
+#include "RBAIsActive.hpp"
+#include "RBAIsDisplayed.hpp"
+#include "RBAIsHidden.hpp"
+#include "RBAIsOn.hpp"
+#include "RBAIsSounding.hpp"
+#include "RBAIsVisible.hpp"
+#include "RBAModelElementType.hpp"
+#include "RBAModelImpl.hpp"
+#include "RBANotOperator.hpp"
+#include "RBAObjectReference.hpp"
+#include "RBAOrOperator.hpp"
+#include "RBASceneImpl.hpp"
+
+namespace rba
+{
+
+const std::uint32_t RBAConstraintCodeGenerator::CODE_VERSION {1U};
+
+RBAConstraintCodeGenerator::RBAConstraintCodeGenerator(RBAModelImpl* const model)
+    : RBAExpressionVisitor(),
+      model_{model}
+{
+}
+
+/**
+ * Generate the code of all constraints of the model
+ */
+void RBAConstraintCodeGenerator::generate()
+{
+  nodes_.clear();
+  std::ostringstream functions;
+  std::uint32_t index {0U};
+  for (const RBAConstraintImpl* const constraint : model_->getConstraintImpls()) {
+    nodes_.emplace_back();
+    body_.str("");
+    nameCount_ = 0U;
+    indent_ = 1U;
+    std::string name {constraint->getName()};
+    for (char& c : name) {
+      if ((c == '\n') || (c == '\r')) {
+        c = ' ';
+      }
+    }
+    functions << "// " << name << "\n"
+              << "bool constraint_" << index
+              << "(rba::RBAConstraintInfo* const info,"
+              << " rba::RBAArbitratorImpl* const arb,"
+              << " const void* const* const n)\n"
+              << "{\n";
+    line() << "bool r0 {false};\n";
+    if (constraint->getExpression() != nullptr) {
+      generateExpression(constraint->getExpression(), "info", "r0");
+    }
+    line() << "return r0;\n";
+    functions << body_.str() << "}\n\n";
+    index++;
+  }
+
+  // The fingerprint covers everything that the bound nodes depend on
+  const std::string code {functions.str()};
+  fingerprint_ = 14695981039346656037ULL ^ CODE_VERSION;
+  for (const char c : code) {
+    fingerprint_ ^= static_cast<std::uint8_t>(c);
+    fingerprint_ *= 1099511628211ULL;
+  }
+
+  std::ostringstream source;
+  source << "// Generated by rbaconstraintgen. Do not edit.\n"
+         << "\n"
+         << "#include <cstdint>\n"
+         << "#include \"RBAAllocatable.hpp\"\n"
+         << "#include \"RBAArbitratorImpl.hpp\"\n"
+         << "#include \"RBAConstraintImpl.hpp\"\n"
+         << "#include \"RBAConstraintInfo.hpp\"\n"
+         << "#include \"RBAContent.hpp\"\n"
+         << "#include \"RBAExecuteResult.hpp\"\n"
+         << "#include \"RBAExpression.hpp\"\n"
+         << "#include \"RBAResultImpl.hpp\"\n"
+         << "#include \"RBASceneImpl.hpp\"\n"
+         << "\n"
+         << "namespace\n"
+         << "{\n"
+         << "\n"
+         << code
+         << "}\n"
+         << "\n"
+         << "extern \"C\"\n"
+         << "{\n"
+         << "\n"
+         << "std::uint64_t " << RBAConstraintPlugin::FINGERPRINT_SYMBOL << "()\n"
+         << "{\n"
+         << "  return 0x" << std::hex << std::setw(16) << std::setfill('0')
+         << fingerprint_ << std::dec << "ULL;\n"
+         << "}\n"
+         << "\n"
+         << "std::uint32_t " << RBAConstraintPlugin::COUNT_SYMBOL << "()\n"
+         << "{\n"
+         << "  return " << index << "U;\n"
+         << "}\n"
+         << "\n"
+         << "const rba::RBACompiledConstraint* "
+         << RBAConstraintPlugin::FUNCTIONS_SYMBOL << "()\n"
+         << "{\n"
+         << "  static const rba::RBACompiledConstraint functions[] {\n";
+  for (std::uint32_t i {0U}; i < index; i++) {
+    source << "    &constraint_" << i << ",\n";
+  }
+  source << "    nullptr\n"
+         << "  };\n"
+         << "  return functions;\n"
+         << "}\n"
+         << "\n"
+         << "}\n";
+  source_ = source.str();
+}
+
+const std::string&
+RBAConstraintCodeGenerator::getSource() const
+{
+  return source_;
+}
+
+std::uint64_t
+RBAConstraintCodeGenerator::getFingerprint() const
+{
+  return fingerprint_;
+}
+
+const std::vector<std::vector<const void*>>&
+RBAConstraintCodeGenerator::getNodes() const
+{
+  return nodes_;
+}
+
+// area status
+void RBAConstraintCodeGenerator::visit(RBAIsDisplayed& exp)
+{
+  generateAllocatableCheck(exp, false);
+}
+void RBAConstraintCodeGenerator::visit(RBADisplayingContent& exp)
+{
+}
+void RBAConstraintCodeGenerator::visit(RBAAllocatedContent& exp)
+{
+}
+void RBAConstraintCodeGenerator::visit(RBAIsHidden& exp)
+{
+  generateAllocatableCheck(exp, true);
+}
+void RBAConstraintCodeGenerator::visit(RBAContentValue& exp)
+{
+}
+void RBAConstraintCodeGenerator::visit(RBAGetContentsList& exp)
+{
+}
+void RBAConstraintCodeGenerator::visit(RBAActiveContents& exp)
+{
+}
+
+// display content status
+void RBAConstraintCodeGenerator::visit(RBAIsActive& exp)
+{
+  generateActiveCheck(exp);
+}
+void RBAConstraintCodeGenerator::visit(RBAIsVisible& exp)
+{
+  generateOutputCheck(exp);
+}
+void RBAConstraintCodeGenerator::visit(RBAStateValue& exp)
+{
+}
+void RBAConstraintCodeGenerator::visit(RBAHasBeenDisplayed& exp)
+{
+}
+void RBAConstraintCodeGenerator::visit(RBAHasComeEarlierThan& exp)
+{
+}
+void RBAConstraintCodeGenerator::visit(RBAHasComeLaterThan& exp)
+{
+}
+void RBAConstraintCodeGenerator::visit(RBAGetAllocatables& exp)
+{
+}
+void RBAConstraintCodeGenerator::visit(RBAActiveState& exp)
+{
+}
+
+// zone status
+void RBAConstraintCodeGenerator::visit(RBAIsOutputted& exp)
+{
+}
+void RBAConstraintCodeGenerator::visit(RBAOutputtingSound& exp)
+{
+}
+void RBAConstraintCodeGenerator::visit(RBAIsMuted& exp)
+{
+}
+void RBAConstraintCodeGenerator::visit(RBAIsAttenuated& exp)
+{
+}
+
+// sound content status
+void RBAConstraintCodeGenerator::visit(RBAIsSounding& exp)
+{
+  generateOutputCheck(exp);
+}
+
+// scene
+void RBAConstraintCodeGenerator::visit(RBAIsOn& exp)
+{
+  generateSceneCheck(exp);
+}
+void RBAConstraintCodeGenerator::visit(RBAGetProperty& exp)
+{
+}
+
+void RBAConstraintCodeGenerator::visit(RBAIsTypeOfOperator& exp)
+{
+}
+
+// operator
+void RBAConstraintCodeGenerator::visit(RBAAndOperator& exp)
+{
+  generateLogical(exp, true);
+}
+void RBAConstraintCodeGenerator::visit(RBAOrOperator& exp)
+{
+  generateLogical(exp, false);
+}
+void RBAConstraintCodeGenerator::visit(RBANotOperator& exp)
+{
+  if (!exp.getLetStatements().empty()) {
+    generateExecute(exp);
+    return;
+  }
+  const std::string info {info_};
+  const std::string result {result_};
+  generateBegin(exp);
+  const std::string childInfo {createName("i")};
+  const std::string childResult {createName("r")};
+  line() << "{\n";
+  indent_++;
+  line() << "rba::RBAConstraintInfo* const " << childInfo << " {"
+         << info << "->getChild(0U)};\n";
+  line() << "bool " << childResult << " {false};\n";
+  generateExpression(exp.getLhsOperand(), childInfo, childResult);
+  line() << "if (" << childInfo << "->isExceptionBeforeArbitrate()) {\n";
+  line() << "  " << info << "->setExceptionBeforeArbitrate(true);\n";
+  line() << "} else {\n";
+  line() << "  " << result << " = !" << childResult << ";\n";
+  line() << "}\n";
+  indent_--;
+  line() << "}\n";
+  generateEnd();
+}
+void RBAConstraintCodeGenerator::visit(RBAImpliesOperator& exp)
+{
+  if (!exp.getLetStatements().empty()) {
+    generateExecute(exp);
+    return;
+  }
+  const std::string info {info_};
+  const std::string result {result_};
+  generateBegin(exp);
+  const std::string lhsException {createName("e")};
+  line() << "bool " << lhsException << " {false};\n";
+  line() << "{\n";
+  indent_++;
+  const std::string lhsInfo {createName("i")};
+  const std::string lhsResult {createName("r")};
+  line() << "rba::RBAConstraintInfo* const " << lhsInfo << " {"
+         << info << "->getChild(0U)};\n";
+  line() << "bool " << lhsResult << " {false};\n";
+  generateExpression(exp.getLhsOperand(), lhsInfo, lhsResult);
+  line() << lhsException << " = " << lhsInfo
+         << "->isExceptionBeforeArbitrate();\n";
+  // The right-hand side is evaluated when the left-hand side is true,
+  // or is an exception, to get the allocatables of the right-hand side
+  line() << "if (!" << lhsException << " && !" << lhsResult << ") {\n";
+  line() << "  " << result << " = true;\n";
+  line() << "} else {\n";
+  indent_++;
+  line() << "if (" << lhsException << ") {\n";
+  line() << "  " << info << "->setExceptionBeforeArbitrate(true);\n";
+  line() << "}\n";
+  const std::string rhsInfo {createName("i")};
+  const std::string rhsResult {createName("r")};
+  line() << "rba::RBAConstraintInfo* const " << rhsInfo << " {"
+         << info << "->getChild(1U)};\n";
+  line() << "bool " << rhsResult << " {false};\n";
+  generateExpression(exp.getRhsOperand(), rhsInfo, rhsResult);
+  line() << "if (!" << lhsException << ") {\n";
+  line() << "  if (" << rhsInfo << "->isExceptionBeforeArbitrate()) {\n";
+  line() << "    " << info << "->setExceptionBeforeArbitrate(true);\n";
+  line() << "  } else if (" << rhsResult << ") {\n";
+  line() << "    " << result << " = true;\n";
+  line() << "  }\n";
+  line() << "}\n";
+  indent_--;
+  line() << "}\n";
+  indent_--;
+  line() << "}\n";
+  generateEnd();
+}
+void RBAConstraintCodeGenerator::visit(RBAIsEqualToOperator& exp)
+{
+}
+void RBAConstraintCodeGenerator::visit(RBAObjectCompare& exp)
+{
+}
+void RBAConstraintCodeGenerator::visit(RBAIsGreaterThanOperator& exp)
+{
+}
+void RBAConstraintCodeGenerator::visit(RBAIsGreaterThanEqualOperator& exp)
+{
+}
+void RBAConstraintCodeGenerator::visit(RBAIsLowerThanOperator& exp)
+{
+}
+void RBAConstraintCodeGenerator::visit(RBAIsLowerThanEqualOperator& exp)
+{
+}
+
+// Quantification symbol
+void RBAConstraintCodeGenerator::visit(RBAForAllOperator& exp)
+{
+}
+void RBAConstraintCodeGenerator::visit(RBAExistsOperator& exp)
+{
+}
+
+// Built-in definition expression
+void RBAConstraintCodeGenerator::visit(RBAAllInstanceOfArea& exp)
+{
+}
+void RBAConstraintCodeGenerator::visit(RBAAllInstanceOfViewContent& exp)
+{
+}
+void RBAConstraintCodeGenerator::visit(RBAAllInstanceOfZone& exp)
+{
+}
+void RBAConstraintCodeGenerator::visit(RBAAllInstanceOfSoundContent& exp)
+{
+}
+
+// statement
+void RBAConstraintCodeGenerator::visit(RBAIfStatement& exp)
+{
+}
+void RBAConstraintCodeGenerator::visit(RBALetStatement& exp)
+{
+}
+
+// modifier
+void RBAConstraintCodeGenerator::visit(RBAPreviousModifier& exp)
+{
+}
+
+// operator
+void RBAConstraintCodeGenerator::visit(RBAMaxOperator& exp)
+{
+}
+void RBAConstraintCodeGenerator::visit(RBAMinOperator& exp)
+{
+}
+void RBAConstraintCodeGenerator::visit(RBASelectOperator& exp)
+{
+}
+void RBAConstraintCodeGenerator::visit(RBASizeOperator& exp)
+{
+}
+
+// object reference
+void RBAConstraintCodeGenerator::visit(RBAObjectReference& exp)
+{
+}
+void RBAConstraintCodeGenerator::visit(RBASetOfOperator& exp)
+{
+}
+
+/**
+ * Generate the code that evaluates an expression
+ * @param exp expression
+ * @param info variable name of the constraint information of exp
+ * @param result variable name of the bool that receives the result
+ */
+void RBAConstraintCodeGenerator::generateExpression(RBAExpression* const exp,
+                                                    const std::string& info,
+                                                    const std::string& result)
+{
+  const std::string backupInfo {info_};
+  const std::string backupResult {result_};
+  info_ = info;
+  result_ = result;
+  generated_ = false;
+  exp->accept(*this);
+  if (!generated_) {
+    // The expressions that have no code of their own are evaluated
+    // by the node
+    generateExecute(*exp);
+  }
+  info_ = backupInfo;
+  result_ = backupResult;
+  generated_ = true;
+}
+
+void RBAConstraintCodeGenerator::generateExecute(RBAExpression& exp)
+{
+  generated_ = true;
+  line() << result_ << " = static_cast<const rba::RBAExpression*>("
+         << addNode(&exp) << ")->execute(" << info_ << ", arb);\n";
+}
+
+void RBAConstraintCodeGenerator::generateLogical(RBAOperator& exp,
+                                                 const bool isAnd)
+{
+  if (!exp.getLetStatements().empty()) {
+    generateExecute(exp);
+    return;
+  }
+  const std::string info {info_};
+  const std::string result {result_};
+  generateBegin(exp);
+  const std::string falseCount {createName("f")};
+  const std::string exceptionCount {createName("e")};
+  if (isAnd) {
+    line() << "std::uint32_t " << falseCount << " {0U};\n";
+    line() << "std::uint32_t " << exceptionCount << " {0U};\n";
+  }
+  std::uint32_t index {0U};
+  for (RBAExpression* const ope : exp.getOperand()) {
+    const std::string childInfo {createName("i")};
+    const std::string childResult {createName("r")};
+    line() << "{\n";
+    indent_++;
+    line() << "rba::RBAConstraintInfo* const " << childInfo << " {"
+           << info << "->getChild(" << index << "U)};\n";
+    line() << "bool " << childResult << " {false};\n";
+    generateExpression(ope, childInfo, childResult);
+    line() << "if (" << childInfo << "->isExceptionBeforeArbitrate()) {\n";
+    if (isAnd) {
+      line() << "  " << exceptionCount << "++;\n";
+      line() << "} else if (!" << childResult << ") {\n";
+      line() << "  " << falseCount << "++;\n";
+    } else {
+      line() << "  " << info << "->setExceptionBeforeArbitrate(true);\n";
+      line() << "} else if (" << childResult << ") {\n";
+      line() << "  " << result << " = true;\n";
+    }
+    line() << "}\n";
+    indent_--;
+    line() << "}\n";
+    index++;
+  }
+  if (isAnd) {
+    line() << "if ((" << falseCount << " == 0U) && (" << exceptionCount
+           << " > 0U)) {\n";
+    line() << "  " << info << "->setExceptionBeforeArbitrate(true);\n";
+    line() << "}\n";
+    line() << result << " = ((" << falseCount << " == 0U) && ("
+           << exceptionCount << " == 0U));\n";
+  } else {
+    line() << "if (" << result << ") {\n";
+    line() << "  " << info << "->setExceptionBeforeArbitrate(false);\n";
+    line() << "}\n";
+  }
+  generateEnd();
+}
+
+/**
+ * isDisplayed() and isHidden() of a fixed Area or Zone
+ */
+void RBAConstraintCodeGenerator::generateAllocatableCheck(RBAOperator& exp,
+                                                          const bool isHidden)
+{
+  const RBAAllocatable* const alloc
+    {dynamic_cast<const RBAAllocatable*>(getFixedObject(exp))};
+  if (alloc == nullptr) {
+    generateExecute(exp);
+    return;
+  }
+  const std::string info {info_};
+  const std::string result {result_};
+  generateBegin(exp);
+  generateOperandReference(exp);
+  const std::string var {createName("a")};
+  line() << "} else {\n";
+  indent_++;
+  line() << "const rba::RBAAllocatable* const " << var
+         << " {static_cast<const rba::RBAAllocatable*>(" << addNode(alloc)
+         << ")};\n";
+  line() << info << "->addOperandAllocatable(" << var << ");\n";
+  if (isHidden) {
+    line() << "if (!" << var << "->isHiddenChecked()) {\n";
+    line() << "  " << info << "->setExceptionBeforeArbitrate(true);\n";
+    line() << "} else if (" << var << "->isHidden()) {\n";
+    line() << "  " << result << " = true;\n";
+    line() << "  " << info << "->addTrueAllocatable(" << var << ");\n";
+    line() << "} else {\n";
+    line() << "  " << info << "->addFalseAllocatable(" << var << ");\n";
+    line() << "}\n";
+  } else {
+    line() << "if (" << var << "->isHiddenChecked() && " << var
+           << "->isHidden()) {\n";
+    line() << "  " << info << "->addFalseAllocatable(" << var << ");\n";
+    line() << "} else if (" << var << "->isChecked()) {\n";
+    line() << "  if (" << var << "->getState() != nullptr) {\n";
+    line() << "    " << info << "->addTrueAllocatable(" << var << ");\n";
+    line() << "    " << result << " = true;\n";
+    line() << "  } else {\n";
+    line() << "    " << info << "->addFalseAllocatable(" << var << ");\n";
+    line() << "  }\n";
+    line() << "} else {\n";
+    line() << "  " << info << "->setExceptionBeforeArbitrate(true);\n";
+    line() << "}\n";
+  }
+  indent_--;
+  line() << "}\n";
+  generateEnd();
+}
+
+/**
+ * isActive() of a fixed Content
+ */
+void RBAConstraintCodeGenerator::generateActiveCheck(RBAOperator& exp)
+{
+  const RBAContent* const content
+    {dynamic_cast<const RBAContent*>(getFixedObject(exp))};
+  if (content == nullptr) {
+    generateExecute(exp);
+    return;
+  }
+  const std::string info {info_};
+  const std::string result {result_};
+  generateBegin(exp);
+  generateOperandReference(exp);
+  line() << "} else {\n";
+  line() << "  " << result << " = arb->getResult()->isActive("
+         << "static_cast<const rba::RBAContent*>(" << addNode(content)
+         << "));\n";
+  line() << "}\n";
+  generateEnd();
+}
+
+/**
+ * isVisible() and isSounding() of a fixed Content
+ */
+void RBAConstraintCodeGenerator::generateOutputCheck(RBAOperator& exp)
+{
+  const RBAContent* const content
+    {dynamic_cast<const RBAContent*>(getFixedObject(exp))};
+  if (content == nullptr) {
+    generateExecute(exp);
+    return;
+  }
+  const std::string info {info_};
+  const std::string result {result_};
+  generateBegin(exp);
+  generateOperandReference(exp);
+  const std::string var {createName("c")};
+  const std::string state {createName("s")};
+  line() << "} else {\n";
+  indent_++;
+  line() << "const rba::RBAContent* const " << var
+         << " {static_cast<const rba::RBAContent*>(" << addNode(content)
+         << ")};\n";
+  line() << "const rba::RBAContentState* const " << state
+         << " {arb->getResult()->getActiveState(" << var << ")};\n";
+  line() << "if (" << state << " != nullptr) {\n";
+  line() << "  for (const rba::RBAAllocatable* const a : " << var
+         << "->getAllocatables()) {\n";
+  line() << "    " << info << "->addOperandAllocatable(a);\n";
+  line() << "    if (a->isChecked()) {\n";
+  line() << "      if (" << state << " == a->getState()) {\n";
+  line() << "        if (a->isHiddenChecked() && a->isHidden()) {\n";
+  line() << "          " << info << "->addFalseAllocatable(a);\n";
+  line() << "        } else {\n";
+  line() << "          " << info << "->setExceptionBeforeArbitrate(false);\n";
+  line() << "          " << info << "->clearFalseAllocatable();\n";
+  line() << "          " << info << "->addTrueAllocatable(a);\n";
+  line() << "          " << result << " = true;\n";
+  line() << "          break;\n";
+  line() << "        }\n";
+  line() << "      } else {\n";
+  line() << "        " << info << "->addFalseAllocatable(a);\n";
+  line() << "      }\n";
+  line() << "    } else {\n";
+  line() << "      " << info << "->setExceptionBeforeArbitrate(true);\n";
+  line() << "    }\n";
+  line() << "  }\n";
+  line() << "} else {\n";
+  line() << "  for (const rba::RBAAllocatable* const a : " << var
+         << "->getAllocatables()) {\n";
+  line() << "    " << info << "->addFalseAllocatable(a);\n";
+  line() << "  }\n";
+  line() << "}\n";
+  indent_--;
+  line() << "}\n";
+  generateEnd();
+}
+
+/**
+ * isOn() of a fixed Scene
+ */
+void RBAConstraintCodeGenerator::generateSceneCheck(RBAOperator& exp)
+{
+  const RBASceneImpl* const scene
+    {dynamic_cast<const RBASceneImpl*>(getFixedObject(exp))};
+  if (scene == nullptr) {
+    generateExecute(exp);
+    return;
+  }
+  const std::string info {info_};
+  const std::string result {result_};
+  generateBegin(exp);
+  generateOperandReference(exp);
+  line() << "} else {\n";
+  line() << "  " << result << " = arb->getResult()->isActive("
+         << "static_cast<const rba::RBASceneImpl*>(" << addNode(scene)
+         << "));\n";
+  line() << "}\n";
+  generateEnd();
+}
+
+/**
+ * Get the object of an operand that always refers to the same object
+ * @return nullptr if the operand is not such a reference,
+ *         or the expression has let statements
+ */
+const RBARuleObject*
+RBAConstraintCodeGenerator::getFixedObject(const RBAOperator& exp) const
+{
+  if (!exp.getLetStatements().empty()) {
+    return nullptr;
+  }
+  const RBAObjectReference* const ref
+    {dynamic_cast<const RBAObjectReference*>(exp.getLhsOperand())};
+  if ((ref == nullptr) || !ref->getLetStatements().empty()) {
+    return nullptr;
+  }
+  const RBARuleObject* const obj {ref->getRefObject()};
+  if ((obj == nullptr)
+      || obj->isModelElementType(RBAModelElementType::Variable)
+      || obj->isPrevious()) {
+    return nullptr;
+  }
+  return obj->getRawObject();
+}
+
+/**
+ * Generate the evaluation of the fixed reference of the left-hand side.
+ * Leaves an open "if" for the exception of the operand.
+ */
+void
+RBAConstraintCodeGenerator::generateOperandReference(const RBAOperator& exp)
+{
+  const std::string lhsInfo {createName("i")};
+  line() << "rba::RBAConstraintInfo* const " << lhsInfo << " {" << info_
+         << "->getChild(0U)};\n";
+  const RBAExpression* const lhs {exp.getLhsOperand()};
+  line() << lhsInfo << "->setExpression(static_cast<const rba::RBAExpression*>("
+         << addNode(lhs) << "));\n";
+  line() << "if (" << lhsInfo << "->isExceptionBeforeArbitrate()) {\n";
+  line() << "  " << info_ << "->setExceptionBeforeArbitrate(true);\n";
+}
+
+/**
+ * Same as the beginning of RBAExpression::execute()
+ */
+void RBAConstraintCodeGenerator::generateBegin(const RBAExpression& exp)
+{
+  generated_ = true;
+  line() << info_ << "->setExpression(static_cast<const rba::RBAExpression*>("
+         << addNode(&exp) << "));\n";
+}
+
+/**
+ * Same as the end of RBAExpression::execute()
+ */
+void RBAConstraintCodeGenerator::generateEnd()
+{
+  line() << info_ << "->setResult(" << result_
+         << " ? rba::RBAExecuteResult::TRUE : rba::RBAExecuteResult::FALSE);\n";
+}
+
+std::string RBAConstraintCodeGenerator::addNode(const void* const node)
+{
+  std::vector<const void*>& nodes {nodes_.back()};
+  nodes.push_back(node);
+  return "n[" + std::to_string(nodes.size() - 1U) + "]";
+}
+
+std::string RBAConstraintCodeGenerator::createName(const std::string& prefix)
+{
+  nameCount_++;
+  return prefix + std::to_string(nameCount_);
+}
+
+std::ostream& RBAConstraintCodeGenerator::line()
+{
+  for (std::uint32_t i {0U}; i < indent_; i++) {
+    body_ << "  ";
+  }
+  return body_;
+}
+
+} /* namespace rba */
@@ -0,0 +1,176 @@
+/**
+ * Copyright (c) 2019 DENSO CORPORATION.
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Constraint code generator class header file
+ *
+ * Translates the constraint expressions of a model into C++ functions
+ * of type RBACompiledConstraint.
+ * Logical operators and the status checks of a fixed Area, Zone,
+ * Content or Scene are translated into straight-line code.
+ * The other expressions are evaluated by calling
+ * RBAExpression::execute() of the node.
+ * The model objects that the code refers to are passed to the function
+ * as an array, which is created by running the generator again on the
+ * loaded model.
+ */
+
+#ifndef RBACONSTRAINTCODEGENERATOR_HPP
+#define RBACONSTRAINTCODEGENERATOR_HPP
+
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "RBAExpressionVisitor.hpp"
+
+namespace rba
+{
+
+class RBAModelImpl;
+class RBAExpression;
+class RBAOperator;
+class RBARuleObject;
+
+class RBAConstraintCodeGenerator : public RBAExpressionVisitor
+{
+ public:
+  explicit RBAConstraintCodeGenerator(RBAModelImpl* const model);
+  RBAConstraintCodeGenerator(const RBAConstraintCodeGenerator&)=delete;
+  RBAConstraintCodeGenerator(const RBAConstraintCodeGenerator&&)=delete;
+  RBAConstraintCodeGenerator& operator=(const RBAConstraintCodeGenerator&)=delete;
+  RBAConstraintCodeGenerator& operator=(const RBAConstraintCodeGenerator&&)=delete;
+  virtual ~RBAConstraintCodeGenerator()=default;
+
+  void generate();
+  const std::string& getSource() const;
+  std::uint64_t getFingerprint() const;
+  const std::vector<std::vector<const void*>>& getNodes() const;
+
+  // area status
+  void visit(RBAIsDisplayed& exp) override;
+  void visit(RBADisplayingContent& exp) override;
+  void visit(RBAAllocatedContent& exp) override;
+  void visit(RBAIsHidden& exp) override;
+  void visit(RBAContentValue& exp) override;
+  void visit(RBAGetContentsList& exp) override;
+  void visit(RBAActiveContents& exp) override;
+
+  // display content status
+  void visit(RBAIsActive& exp) override;
+  void visit(RBAIsVisible& exp) override;
+  void visit(RBAStateValue& exp) override;
+  void visit(RBAHasBeenDisplayed& exp) override;
+  void visit(RBAHasComeEarlierThan& exp) override;
+  void visit(RBAHasComeLaterThan& exp) override;
+  void visit(RBAGetAllocatables& exp) override;
+  void visit(RBAActiveState& exp) override;
+
+  // zone status
+  void visit(RBAIsOutputted& exp) override;
+  void visit(RBAOutputtingSound& exp) override;
+  void visit(RBAIsMuted& exp) override;
+  void visit(RBAIsAttenuated& exp) override;
+
+  // sound content status
+  void visit(RBAIsSounding& exp) override;
+
+  // scene
+  void visit(RBAIsOn& exp) override;
+  void visit(RBAGetProperty& exp) override;
+
+  void visit(RBAIsTypeOfOperator& exp) override;
+
+  // operator
+  void visit(RBAAndOperator& exp) override;
+  void visit(RBAOrOperator& exp) override;
+  void visit(RBANotOperator& exp) override;
+  void visit(RBAImpliesOperator& exp) override;
+  void visit(RBAIsEqualToOperator& exp) override;
+  void visit(RBAObjectCompare& exp) override;
+  void visit(RBAIsGreaterThanOperator& exp) override;
+  void visit(RBAIsGreaterThanEqualOperator& exp) override;
+  void visit(RBAIsLowerThanOperator& exp) override;
+  void visit(RBAIsLowerThanEqualOperator& exp) override;
+
+  // Quantification symbol
+  void visit(RBAForAllOperator& exp) override;
+  void visit(RBAExistsOperator& exp) override;
+
+  // Built-in definition expression
+  void visit(RBAAllInstanceOfArea& exp) override;
+  void visit(RBAAllInstanceOfViewContent& exp) override;
+  void visit(RBAAllInstanceOfZone& exp) override;
+  void visit(RBAAllInstanceOfSoundContent& exp) override;
+
+  // statement
+  void visit(RBAIfStatement& exp) override;
+  void visit(RBALetStatement& exp) override;
+
+  // modifier
+  void visit(RBAPreviousModifier& exp) override;
+
+  // operator
+  void visit(RBAMaxOperator& exp) override;
+  void visit(RBAMinOperator& exp) override;
+  void visit(RBASelectOperator& exp) override;
+  void visit(RBASizeOperator& exp) override;
+
+  // object reference
+  void visit(RBAObjectReference& exp) override;
+  void visit(RBASetOfOperator& exp) override;
+
+ public:
+  // Version of the generated code. Part of the fingerprint.
+  static const std::uint32_t CODE_VERSION;
+
+ private:
+  void generateExpression(RBAExpression* const exp,
+                          const std::string& info,
+                          const std::string& result);
+  void generateExecute(RBAExpression& exp);
+  void generateLogical(RBAOperator& exp, const bool isAnd);
+  void generateAllocatableCheck(RBAOperator& exp, const bool isHidden);
+  void generateActiveCheck(RBAOperator& exp);
+  void generateOutputCheck(RBAOperator& exp);
+  void generateSceneCheck(RBAOperator& exp);
+  const RBARuleObject* getFixedObject(const RBAOperator& exp) const;
+  void generateOperandReference(const RBAOperator& exp);
+  void generateBegin(const RBAExpression& exp);
+  void generateEnd();
+  std::string addNode(const void* const node);
+  std::string createName(const std::string& prefix);
+  std::ostream& line();
+
+ private:
+  RBAModelImpl* model_;
+  std::string source_;
+  std::uint64_t fingerprint_ {0U};
+  // nodes_[constraint index][node index]
+  std::vector<std::vector<const void*>> nodes_;
+  std::ostringstream body_;
+  // Variables of the expression that is being generated
+  std::string info_;
+  std::string result_;
+  bool generated_ {false};
+  std::uint32_t nameCount_ {0U};
+  std::uint32_t indent_ {0U};
+};
+
+} /* namespace rba */
+
+#endif /* RBACONSTRAINTCODEGENERATOR_HPP */
@@ -0,0 +1,141 @@
+/**
+ * Copyright (c) 2019 DENSO CORPORATION.
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Constraint plugin class definition file
+ */
+
+#include <cstdint>
+#include <iostream>
+#include "RBAConstraintPlugin.hpp"
+#include "RBAConstraintCodeGenerator.hpp"
+#include "RBAConstraintImpl.hpp"
+#include "RBAModelImpl.hpp"
+
+#if defined(__unix__) || defined(__APPLE__)
+#define RBA_USE_DLOPEN
+#include <dlfcn.h>
+#endif
+
+namespace rba
+{
+
+const char* const RBAConstraintPlugin::FINGERPRINT_SYMBOL
+  {"rba_constraint_fingerprint"};
+const char* const RBAConstraintPlugin::COUNT_SYMBOL
+  {"rba_constraint_count"};
+const char* const RBAConstraintPlugin::FUNCTIONS_SYMBOL
+  {"rba_constraint_functions"};
+
+RBAConstraintPlugin::~RBAConstraintPlugin() noexcept
+{
+  close();
+}
+
+/**
+ * Load the plugin and bind it to the model objects.
+ * The plugin is rejected when it was not generated from the same model.
+ * @param filename file path of the shared object
+ * @param model model that the plugin was generated from
+ * @return false if the plugin could not be loaded
+ */
+bool
+RBAConstraintPlugin::load(const std::string& filename,
+                          RBAModelImpl* const model)
+{
+  close();
+#ifdef RBA_USE_DLOPEN
+  using FingerprintFunc = std::uint64_t (*)();
+  using CountFunc = std::uint32_t (*)();
+  using FunctionsFunc = const RBACompiledConstraint* (*)();
+
+  handle_ = ::dlopen(filename.c_str(), RTLD_NOW | RTLD_LOCAL);
+  if (handle_ == nullptr) {
+    std::cerr << "ERROR: Could not load " << filename << ": "
+              << ::dlerror() << &std::endl;
+    return false;
+  }
+  const FingerprintFunc fingerprintFunc
+    {reinterpret_cast<FingerprintFunc>(::dlsym(handle_, FINGERPRINT_SYMBOL))};
+  const CountFunc countFunc
+    {reinterpret_cast<CountFunc>(::dlsym(handle_, COUNT_SYMBOL))};
+  const FunctionsFunc functionsFunc
+    {reinterpret_cast<FunctionsFunc>(::dlsym(handle_, FUNCTIONS_SYMBOL))};
+  if ((fingerprintFunc == nullptr) || (countFunc == nullptr)
+      || (functionsFunc == nullptr)) {
+    std::cerr << "ERROR: " << filename << " is not a constraint plugin"
+              << &std::endl;
+    close();
+    return false;
+  }
+
+  // Bind the model objects by generating the code again
+  RBAConstraintCodeGenerator generator {model};
+  generator.generate();
+  const std::list<const RBAConstraintImpl*>& constraints
+    {model->getConstraintImpls()};
+  if ((fingerprintFunc() != generator.getFingerprint())
+      || (countFunc() != static_cast<std::uint32_t>(constraints.size()))) {
+    std::cerr << "ERROR: " << filename
+              << " was not generated from the loaded model" << &std::endl;
+    close();
+    return false;
+  }
+  functions_ = functionsFunc();
+  nodes_ = generator.getNodes();
+  return true;
+#else
+  std::cerr << "ERROR: Constraint plugin is not supported on this platform"
+            << &std::endl;
+  return false;
+#endif
+}
+
+/**
+ * Install the compiled code into the constraints of the loaded model
+ */
+void
+RBAConstraintPlugin::install(RBAModelImpl* const model) const
+{
+  if (functions_ == nullptr) {
+    return;
+  }
+  std::size_t index {0U};
+  for (const RBAConstraintImpl* const constraint : model->getConstraintImpls()) {
+    const_cast<RBAConstraintImpl*>(constraint)
+      ->setCompiled(functions_[index], nodes_[index]);
+    index++;
+  }
+}
+
+/**
+ * Unload the plugin.
+ * The compiled constraints of the model must be cleared before.
+ */
+void
+RBAConstraintPlugin::close()
+{
+  functions_ = nullptr;
+  nodes_.clear();
+#ifdef RBA_USE_DLOPEN
+  if (handle_ != nullptr) {
+    static_cast<void>(::dlclose(handle_));
+  }
+#endif
+  handle_ = nullptr;
+}
+
+}
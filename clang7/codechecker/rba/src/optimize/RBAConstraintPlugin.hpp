@@ -0,0 +1,75 @@
+/**
+ * Copyright (c) 2019 DENSO CORPORATION.
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Constraint plugin class header file
+ *
+ * Loads a shared object built from the source that rbaconstraintgen
+ * generated, and installs its functions into the constraints of a model.
+ */
+
+#ifndef RBACONSTRAINTPLUGIN_HPP
+#define RBACONSTRAINTPLUGIN_HPP
+
+#include <string>
+#include <vector>
+#include "RBAConstraintImpl.hpp"
+#include "RBADllExport.hpp"
+
+namespace rba
+{
+
+class RBAModelImpl;
+
+class DLL_EXPORT RBAConstraintPlugin
+{
+ public:
+  RBAConstraintPlugin()=default;
+  RBAConstraintPlugin(const RBAConstraintPlugin&)=delete;
+  RBAConstraintPlugin(const RBAConstraintPlugin&&)=delete;
+  RBAConstraintPlugin& operator=(const RBAConstraintPlugin&)=delete;
+  RBAConstraintPlugin& operator=(const RBAConstraintPlugin&&)=delete;
+  virtual ~RBAConstraintPlugin() noexcept;
+
+ public:
+  bool load(const std::string& filename, RBAModelImpl* const model);
+  void install(RBAModelImpl* const model) const;
+  void close();
+
+ public:
+  // Symbols exported by the generated source
+  static const char* const FINGERPRINT_SYMBOL;
+  static const char* const COUNT_SYMBOL;
+  static const char* const FUNCTIONS_SYMBOL;
+
+ private:
+  void* handle_ {nullptr};
+  const RBACompiledConstraint* functions_ {nullptr};
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable:4251)
+#endif
+  // nodes_[constraint index][node index]
+  std::vector<std::vector<const void*>> nodes_;
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+};
+
+}
+
+#endif
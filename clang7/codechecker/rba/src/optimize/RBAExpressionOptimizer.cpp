@@ -0,0 +1,579 @@
+/**
+ * Copyright (c) 2019 DENSO CORPORATION.
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Expression optimizer class definition file
+ */
+
+#include <memory>
+#include <vector>
+
+#include "RBAExpressionOptimizer.hpp"
+
+#include "RBAActiveContents.hpp"
+#include "RBAActiveState.hpp"
+#include "RBAAllocatedContent.hpp"
+#include "RBAAndOperator.hpp"
+#include "RBAConstantExpression.hpp"
+#include "RBAConstraintImpl.hpp"
+#include "RBAConstraintInfo.hpp"
+#include "RBAContentValue.hpp"
+#include "RBADisplayingContent.hpp"
+#include "RBAExistsOperator.hpp"
+#include "RBAForAllOperator.hpp"
+#include "RBAGetAllocatables.hpp"
+#include "RBAGetContentsList.hpp"
+#include "RBAGetProperty.hpp"
+#include "RBAHasBeenDisplayed.hpp"
+#include "RBAHasComeEarlierThan.hpp"
+#include "RBAHasComeLaterThan.hpp"
+#include "RBAIfStatement.hpp"
+#include "RBAImpliesOperator.hpp"
+#include "RBAIntegerValue.hpp"
+#include "RBAIsActive.hpp"
+#include "RBAIsAttenuated.hpp"
+#include "RBAIsDisplayed.hpp"
+#include "RBAIsEqualToOperator.hpp"
+#include "RBAIsGreaterThanEqualOperator.hpp"
+#include "RBAIsGreaterThanOperator.hpp"
+#include "RBAIsHidden.hpp"
+#include "RBAIsLowerThanEqualOperator.hpp"
+#include "RBAIsLowerThanOperator.hpp"
+#include "RBAIsMuted.hpp"
+#include "RBAIsOn.hpp"
+#include "RBAIsOutputted.hpp"
+#include "RBAIsSounding.hpp"
+#include "RBAIsTypeOfOperator.hpp"
+#include "RBAIsVisible.hpp"
+#include "RBALambdaExpression.hpp"
+#include "RBALetStatement.hpp"
+#include "RBAMaxOperator.hpp"
+#include "RBAMinOperator.hpp"
+#include "RBAModelElementType.hpp"
+#include "RBAModelImpl.hpp"
+#include "RBANotOperator.hpp"
+#include "RBAObjectCompare.hpp"
+#include "RBAObjectReference.hpp"
+#include "RBAOrOperator.hpp"
+#include "RBAOutputtingSound.hpp"
+#include "RBASelectOperator.hpp"
+#include "RBASetOfOperator.hpp"
+#include "RBASizeOperator.hpp"
+#include "RBAStateValue.hpp"
+
+namespace rba
+{
+
+RBAExpressionOptimizer::RBAExpressionOptimizer(RBAModelImpl* const model)
+    : RBAExpressionVisitor(),
+      model_{model}
+{
+}
+
+/**
+ * Optimize the expressions of all constraints of the model
+ */
+void RBAExpressionOptimizer::optimize()
+{
+  for (const RBAConstraintImpl* const constraint : model_->getConstraintImpls()) {
+    RBAConstraintImpl* const target {const_cast<RBAConstraintImpl*>(constraint)};
+    RBAExpression* const exp {target->getExpression()};
+    if (exp != nullptr) {
+      RBAExpression* const newExp {optimizeExpression(exp)};
+      if (newExp != exp) {
+        target->setExpression(newExp);
+      }
+    }
+  }
+}
+
+/**
+ * @return number of sub-expressions replaced by a constant
+ */
+std::uint32_t RBAExpressionOptimizer::getFoldedCount() const
+{
+  return foldedCount_;
+}
+
+/**
+ * @return number of operands removed from AND and OR
+ */
+std::uint32_t RBAExpressionOptimizer::getRemovedCount() const
+{
+  return removedCount_;
+}
+
+// area status
+void RBAExpressionOptimizer::visit(RBAIsDisplayed& exp)
+{
+  optimizeOperands(exp);
+}
+void RBAExpressionOptimizer::visit(RBADisplayingContent& exp)
+{
+  optimizeOperands(exp);
+}
+void RBAExpressionOptimizer::visit(RBAAllocatedContent& exp)
+{
+  optimizeOperands(exp);
+}
+void RBAExpressionOptimizer::visit(RBAIsHidden& exp)
+{
+  optimizeOperands(exp);
+}
+void RBAExpressionOptimizer::visit(RBAContentValue& exp)
+{
+  optimizeOperands(exp);
+}
+void RBAExpressionOptimizer::visit(RBAGetContentsList& exp)
+{
+  optimizeOperands(exp);
+}
+void RBAExpressionOptimizer::visit(RBAActiveContents& exp)
+{
+  optimizeOperands(exp);
+}
+
+// display content status
+void RBAExpressionOptimizer::visit(RBAIsActive& exp)
+{
+  optimizeOperands(exp);
+}
+void RBAExpressionOptimizer::visit(RBAIsVisible& exp)
+{
+  optimizeOperands(exp);
+}
+void RBAExpressionOptimizer::visit(RBAStateValue& exp)
+{
+  optimizeOperands(exp);
+}
+void RBAExpressionOptimizer::visit(RBAHasBeenDisplayed& exp)
+{
+  optimizeOperands(exp);
+}
+void RBAExpressionOptimizer::visit(RBAHasComeEarlierThan& exp)
+{
+  optimizeOperands(exp);
+}
+void RBAExpressionOptimizer::visit(RBAHasComeLaterThan& exp)
+{
+  optimizeOperands(exp);
+}
+void RBAExpressionOptimizer::visit(RBAGetAllocatables& exp)
+{
+  optimizeOperands(exp);
+}
+void RBAExpressionOptimizer::visit(RBAActiveState& exp)
+{
+  optimizeOperands(exp);
+}
+
+// zone status
+void RBAExpressionOptimizer::visit(RBAIsOutputted& exp)
+{
+  optimizeOperands(exp);
+}
+void RBAExpressionOptimizer::visit(RBAOutputtingSound& exp)
+{
+  optimizeOperands(exp);
+}
+void RBAExpressionOptimizer::visit(RBAIsMuted& exp)
+{
+  optimizeOperands(exp);
+}
+void RBAExpressionOptimizer::visit(RBAIsAttenuated& exp)
+{
+  optimizeOperands(exp);
+}
+
+// sound content status
+void RBAExpressionOptimizer::visit(RBAIsSounding& exp)
+{
+  optimizeOperands(exp);
+}
+
+// scene
+void RBAExpressionOptimizer::visit(RBAIsOn& exp)
+{
+  optimizeOperands(exp);
+}
+void RBAExpressionOptimizer::visit(RBAGetProperty& exp)
+{
+  optimizeOperands(exp);
+}
+
+void RBAExpressionOptimizer::visit(RBAIsTypeOfOperator& exp)
+{
+  optimizeOperands(exp);
+  // The tags of a model element do not change
+  const RBARuleObject* obj {nullptr};
+  if (getObject(exp.getLhsOperand(), obj)) {
+    fold(exp, obj->containsTag(exp.getTag()));
+  }
+}
+
+// operator
+void RBAExpressionOptimizer::visit(RBAAndOperator& exp)
+{
+  optimizeLogical(exp, true);
+}
+void RBAExpressionOptimizer::visit(RBAOrOperator& exp)
+{
+  optimizeLogical(exp, false);
+}
+void RBAExpressionOptimizer::visit(RBANotOperator& exp)
+{
+  optimizeOperands(exp);
+  bool lhs {false};
+  if (getBoolean(exp.getLhsOperand(), lhs)) {
+    fold(exp, !lhs);
+  }
+}
+void RBAExpressionOptimizer::visit(RBAImpliesOperator& exp)
+{
+  optimizeOperands(exp);
+  bool lhs {false};
+  bool rhs {false};
+  if (getBoolean(exp.getLhsOperand(), lhs)) {
+    if (!lhs) {
+      // The right-hand side is not evaluated
+      fold(exp, true);
+    } else if (getBoolean(exp.getRhsOperand(), rhs)) {
+      fold(exp, rhs);
+    } else {
+      ;
+    }
+  }
+}
+void RBAExpressionOptimizer::visit(RBAIsEqualToOperator& exp)
+{
+  optimizeComparison(exp);
+}
+void RBAExpressionOptimizer::visit(RBAObjectCompare& exp)
+{
+  optimizeOperands(exp);
+  const RBARuleObject* lhs {nullptr};
+  const RBARuleObject* rhs {nullptr};
+  if (getObject(exp.getLhsOperand(), lhs)
+      && getObject(exp.getRhsOperand(), rhs)) {
+    fold(exp, lhs->getRawObject() == rhs->getRawObject());
+  }
+}
+void RBAExpressionOptimizer::visit(RBAIsGreaterThanOperator& exp)
+{
+  optimizeComparison(exp);
+}
+void RBAExpressionOptimizer::visit(RBAIsGreaterThanEqualOperator& exp)
+{
+  optimizeComparison(exp);
+}
+void RBAExpressionOptimizer::visit(RBAIsLowerThanOperator& exp)
+{
+  optimizeComparison(exp);
+}
+void RBAExpressionOptimizer::visit(RBAIsLowerThanEqualOperator& exp)
+{
+  optimizeComparison(exp);
+}
+
+// Quantification symbol
+void RBAExpressionOptimizer::visit(RBAForAllOperator& exp)
+{
+  optimizeLambda(exp);
+}
+void RBAExpressionOptimizer::visit(RBAExistsOperator& exp)
+{
+  optimizeLambda(exp);
+}
+
+// Built-in definition expression
+void RBAExpressionOptimizer::visit(RBAAllInstanceOfArea& exp)
+{
+}
+void RBAExpressionOptimizer::visit(RBAAllInstanceOfViewContent& exp)
+{
+}
+void RBAExpressionOptimizer::visit(RBAAllInstanceOfZone& exp)
+{
+}
+void RBAExpressionOptimizer::visit(RBAAllInstanceOfSoundContent& exp)
+{
+}
+
+// statement
+void RBAExpressionOptimizer::visit(RBAIfStatement& exp)
+{
+  RBAExpression* const condition {optimizeExpression(exp.getCondition())};
+  exp.setCondition(condition);
+  exp.setThenExpression(optimizeExpression(exp.getThenExpression()));
+  exp.setElseExpression(optimizeExpression(exp.getElseExpression()));
+  // The IF statement itself is kept even if the condition is constant,
+  // because the re-arbitration handles the branch of IF specially.
+  bool cond {false};
+  bool result {false};
+  if (getBoolean(condition, cond)) {
+    const RBAExpression* const branch
+      {cond ? exp.getThenExpression() : exp.getElseExpression()};
+    if (getBoolean(branch, result)) {
+      fold(exp, result);
+    }
+  }
+}
+void RBAExpressionOptimizer::visit(RBALetStatement& exp)
+{
+  optimizeOperands(exp);
+}
+
+// modifier
+void RBAExpressionOptimizer::visit(RBAPreviousModifier& exp)
+{
+}
+
+// operator
+void RBAExpressionOptimizer::visit(RBAMaxOperator& exp)
+{
+  optimizeLambda(exp);
+}
+void RBAExpressionOptimizer::visit(RBAMinOperator& exp)
+{
+  optimizeLambda(exp);
+}
+void RBAExpressionOptimizer::visit(RBASelectOperator& exp)
+{
+  optimizeLambda(exp);
+}
+void RBAExpressionOptimizer::visit(RBASizeOperator& exp)
+{
+  optimizeOperands(exp);
+}
+
+// object reference
+void RBAExpressionOptimizer::visit(RBAObjectReference& exp)
+{
+}
+void RBAExpressionOptimizer::visit(RBASetOfOperator& exp)
+{
+  optimizeOperands(exp);
+  const RBARuleObject* obj {nullptr};
+  for (const RBAExpression* const ope : exp.getOperand()) {
+    if (!getObject(ope, obj)) {
+      return;
+    }
+  }
+  if (!exp.getLetStatements().empty()) {
+    return;
+  }
+  // Create the set once. The operands need no arbitrator.
+  // The set is owned by exp, which is no longer evaluated.
+  RBAConstraintInfo info;
+  const RBARuleObject* const set {exp.getReferenceObject(&info, nullptr)};
+  if (set != nullptr) {
+    fold(exp, false, set);
+  }
+}
+
+/**
+ * Optimize an expression and its children
+ * @return expression that replaces exp. exp itself if not replaced.
+ */
+RBAExpression*
+RBAExpressionOptimizer::optimizeExpression(RBAExpression* const exp)
+{
+  if (exp == nullptr) {
+    return nullptr;
+  }
+  for (RBALetStatement* const letStatement : exp->getLetStatements()) {
+    optimizeOperands(*letStatement);
+  }
+  RBAExpression* const backup {replacement_};
+  replacement_ = exp;
+  // Expressions that have no accept() are left as they are
+  exp->accept(*this);
+  RBAExpression* const result {replacement_};
+  replacement_ = backup;
+  return result;
+}
+
+void RBAExpressionOptimizer::optimizeOperands(RBAOperator& exp)
+{
+  std::vector<RBAExpression*> operand {exp.getOperand()};
+  bool changed {false};
+  for (RBAExpression*& ope : operand) {
+    RBAExpression* const newOpe {optimizeExpression(ope)};
+    if (newOpe != ope) {
+      ope = newOpe;
+      changed = true;
+    }
+  }
+  if (changed) {
+    exp.setOperand(operand);
+  }
+}
+
+void RBAExpressionOptimizer::optimizeLambda(RBALambdaContext& exp)
+{
+  optimizeOperands(exp);
+  RBALambdaExpression* const lambda {exp.getLambda()};
+  if (lambda != nullptr) {
+    RBAExpression* const body {lambda->getBodyText()};
+    RBAExpression* const newBody {optimizeExpression(body)};
+    if (newBody != body) {
+      lambda->setBodyText(newBody);
+    }
+  }
+}
+
+/**
+ * AND and OR
+ * A constant operand that equals the identity element (true for AND,
+ * false for OR) does not change the result nor the exception, and is removed.
+ * The other operands are kept even if the result is already decided,
+ * because all operands are evaluated to collect the allocatables.
+ */
+void RBAExpressionOptimizer::optimizeLogical(RBAOperator& exp, const bool isAnd)
+{
+  optimizeOperands(exp);
+  std::vector<RBAExpression*> operand;
+  bool allConstant {true};
+  bool result {isAnd};
+  for (RBAExpression* const ope : exp.getOperand()) {
+    bool value {false};
+    if (getBoolean(ope, value)) {
+      if (isAnd) {
+        result = (result && value);
+      } else {
+        result = (result || value);
+      }
+      if (value != isAnd) {
+        operand.push_back(ope);
+      }
+    } else {
+      allConstant = false;
+      operand.push_back(ope);
+    }
+  }
+  if (allConstant) {
+    fold(exp, result);
+  } else if (operand.size() < exp.getOperand().size()) {
+    removedCount_ += static_cast<std::uint32_t>(exp.getOperand().size()
+                                                - operand.size());
+    exp.setOperand(operand);
+  } else {
+    ;
+  }
+}
+
+/**
+ * Comparison of integer values
+ */
+void RBAExpressionOptimizer::optimizeComparison(RBAOperator& exp)
+{
+  optimizeOperands(exp);
+  std::int32_t lhs {0};
+  std::int32_t rhs {0};
+  if (!getValue(exp.getLhsOperand(), lhs)
+      || !getValue(exp.getRhsOperand(), rhs)) {
+    return;
+  }
+  switch (exp.getModelElementType()) {
+    case RBAModelElementType::IsEqualToOperator:
+      fold(exp, lhs == rhs);
+      break;
+    case RBAModelElementType::IsGreaterThanOperator:
+      fold(exp, lhs > rhs);
+      break;
+    case RBAModelElementType::IsGreaterThanEqualOperator:
+      fold(exp, lhs >= rhs);
+      break;
+    case RBAModelElementType::IsLowerThanOperator:
+      fold(exp, lhs < rhs);
+      break;
+    case RBAModelElementType::IsLowerThanEqualOperator:
+      fold(exp, lhs <= rhs);
+      break;
+    default:
+      break;
+  }
+}
+
+/**
+ * Replace the expression being visited by a constant
+ * @param exp expression being visited
+ * @param result result of execute()
+ * @param object result of getReferenceObject()
+ */
+void RBAExpressionOptimizer::fold(RBAExpression& exp, const bool result,
+                                  const RBARuleObject* const object)
+{
+  // Let statements may be evaluated for their variables
+  if (!exp.getLetStatements().empty()) {
+    return;
+  }
+  std::unique_ptr<RBAConstantExpression> constant
+    {std::make_unique<RBAConstantExpression>()};
+  constant->setOriginal(&exp);
+  constant->setResult(result);
+  constant->setObject(object);
+  replacement_ = dynamic_cast<RBAExpression*>(
+      model_->addModelElement(std::move(constant)));
+  foldedCount_++;
+}
+
+bool RBAExpressionOptimizer::getBoolean(const RBAExpression* const exp,
+                                        bool& result)
+{
+  const RBAConstantExpression* const constant
+    {dynamic_cast<const RBAConstantExpression*>(exp)};
+  if ((constant == nullptr) || (constant->getObject() != nullptr)) {
+    return false;
+  }
+  result = constant->getResult();
+  return true;
+}
+
+bool RBAExpressionOptimizer::getValue(const RBAExpression* const exp,
+                                      std::int32_t& value)
+{
+  const RBAIntegerValue* const integer
+    {dynamic_cast<const RBAIntegerValue*>(exp)};
+  if ((integer == nullptr) || !integer->getLetStatements().empty()) {
+    return false;
+  }
+  value = integer->getValue();
+  // -99 is the value of an expression that could not be evaluated
+  return (value != -99);
+}
+
+bool RBAExpressionOptimizer::getObject(const RBAExpression* const exp,
+                                       const RBARuleObject*& object)
+{
+  const RBAConstantExpression* const constant
+    {dynamic_cast<const RBAConstantExpression*>(exp)};
+  if (constant != nullptr) {
+    object = constant->getObject();
+    return (object != nullptr);
+  }
+  const RBAObjectReference* const ref
+    {dynamic_cast<const RBAObjectReference*>(exp)};
+  if ((ref == nullptr) || !ref->getLetStatements().empty()) {
+    return false;
+  }
+  object = ref->getRefObject();
+  // The object of a variable is decided by the arbitration
+  return ((object != nullptr)
+          && !object->isModelElementType(RBAModelElementType::Variable));
+}
+
+} /* namespace rba */
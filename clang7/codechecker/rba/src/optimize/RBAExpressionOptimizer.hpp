@@ -0,0 +1,156 @@
+/**
+ * Copyright (c) 2019 DENSO CORPORATION.
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Expression optimizer class header file
+ *
+ * Rewrites the constraint expressions of a loaded model.
+ * The sub-expressions whose value does not depend on the arbitration
+ * are replaced by RBAConstantExpression, static sets are created once,
+ * and the operands that cannot change the result of AND, OR and implies
+ * are removed.
+ * Only the sub-expressions that never add an allocatable to
+ * RBAConstraintInfo are rewritten, so that the re-arbitration is
+ * not affected.
+ */
+
+#ifndef RBAEXPRESSIONOPTIMIZER_HPP
+#define RBAEXPRESSIONOPTIMIZER_HPP
+
+#include <cstdint>
+
+#include "RBAExpressionVisitor.hpp"
+
+namespace rba
+{
+
+class RBAModelImpl;
+class RBAExpression;
+class RBAOperator;
+class RBALambdaContext;
+class RBARuleObject;
+
+class RBAExpressionOptimizer : public RBAExpressionVisitor
+{
+ public:
+  explicit RBAExpressionOptimizer(RBAModelImpl* const model);
+  RBAExpressionOptimizer(const RBAExpressionOptimizer&)=delete;
+  RBAExpressionOptimizer(const RBAExpressionOptimizer&&)=delete;
+  RBAExpressionOptimizer& operator=(const RBAExpressionOptimizer&)=delete;
+  RBAExpressionOptimizer& operator=(const RBAExpressionOptimizer&&)=delete;
+  virtual ~RBAExpressionOptimizer()=default;
+
+  void optimize();
+  std::uint32_t getFoldedCount() const;
+  std::uint32_t getRemovedCount() const;
+
+  // area status
+  void visit(RBAIsDisplayed& exp) override;
+  void visit(RBADisplayingContent& exp) override;
+  void visit(RBAAllocatedContent& exp) override;
+  void visit(RBAIsHidden& exp) override;
+  void visit(RBAContentValue& exp) override;
+  void visit(RBAGetContentsList& exp) override;
+  void visit(RBAActiveContents& exp) override;
+
+  // display content status
+  void visit(RBAIsActive& exp) override;
+  void visit(RBAIsVisible& exp) override;
+  void visit(RBAStateValue& exp) override;
+  void visit(RBAHasBeenDisplayed& exp) override;
+  void visit(RBAHasComeEarlierThan& exp) override;
+  void visit(RBAHasComeLaterThan& exp) override;
+  void visit(RBAGetAllocatables& exp) override;
+  void visit(RBAActiveState& exp) override;
+
+  // zone status
+  void visit(RBAIsOutputted& exp) override;
+  void visit(RBAOutputtingSound& exp) override;
+  void visit(RBAIsMuted& exp) override;
+  void visit(RBAIsAttenuated& exp) override;
+
+  // sound content status
+  void visit(RBAIsSounding& exp) override;
+
+  // scene
+  void visit(RBAIsOn& exp) override;
+  void visit(RBAGetProperty& exp) override;
+
+  void visit(RBAIsTypeOfOperator& exp) override;
+
+  // operator
+  void visit(RBAAndOperator& exp) override;
+  void visit(RBAOrOperator& exp) override;
+  void visit(RBANotOperator& exp) override;
+  void visit(RBAImpliesOperator& exp) override;
+  void visit(RBAIsEqualToOperator& exp) override;
+  void visit(RBAObjectCompare& exp) override;
+  void visit(RBAIsGreaterThanOperator& exp) override;
+  void visit(RBAIsGreaterThanEqualOperator& exp) override;
+  void visit(RBAIsLowerThanOperator& exp) override;
+  void visit(RBAIsLowerThanEqualOperator& exp) override;
+
+  // Quantification symbol
+  void visit(RBAForAllOperator& exp) override;
+  void visit(RBAExistsOperator& exp) override;
+
+  // Built-in definition expression
+  void visit(RBAAllInstanceOfArea& exp) override;
+  void visit(RBAAllInstanceOfViewContent& exp) override;
+  void visit(RBAAllInstanceOfZone& exp) override;
+  void visit(RBAAllInstanceOfSoundContent& exp) override;
+
+  // statement
+  void visit(RBAIfStatement& exp) override;
+  void visit(RBALetStatement& exp) override;
+
+  // modifier
+  void visit(RBAPreviousModifier& exp) override;
+
+  // operator
+  void visit(RBAMaxOperator& exp) override;
+  void visit(RBAMinOperator& exp) override;
+  void visit(RBASelectOperator& exp) override;
+  void visit(RBASizeOperator& exp) override;
+
+  // object reference
+  void visit(RBAObjectReference& exp) override;
+  void visit(RBASetOfOperator& exp) override;
+
+ private:
+  RBAExpression* optimizeExpression(RBAExpression* const exp);
+  void optimizeOperands(RBAOperator& exp);
+  void optimizeLambda(RBALambdaContext& exp);
+  void optimizeLogical(RBAOperator& exp, const bool isAnd);
+  void optimizeComparison(RBAOperator& exp);
+  void fold(RBAExpression& exp, const bool result,
+            const RBARuleObject* const object = nullptr);
+  static bool getBoolean(const RBAExpression* const exp, bool& result);
+  static bool getValue(const RBAExpression* const exp, std::int32_t& value);
+  static bool getObject(const RBAExpression* const exp,
+                        const RBARuleObject*& object);
+
+ private:
+  RBAModelImpl* model_;
+  // Expression that replaces the expression being visited
+  RBAExpression* replacement_ {nullptr};
+  std::uint32_t foldedCount_ {0U};
+  std::uint32_t removedCount_ {0U};
+};
+
+} /* namespace rba */
+
+#endif /* RBAEXPRESSIONOPTIMIZER_HPP */
@@ -0,0 +1,176 @@
+/**
+ * Copyright (c) 2019 DENSO CORPORATION.
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Operand orders class definition file
+ */
+
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <sstream>
+
+#include "RBAOperandOrders.hpp"
+
+#include "RBAConstraintImpl.hpp"
+#include "RBAIfStatement.hpp"
+#include "RBALambdaContext.hpp"
+#include "RBALambdaExpression.hpp"
+#include "RBALetStatement.hpp"
+#include "RBALogicalOperator.hpp"
+#include "RBAModelElementType.hpp"
+#include "RBAModelImpl.hpp"
+#include "RBAOperandOrder.hpp"
+#include "RBAPreviousModifier.hpp"
+
+namespace rba
+{
+
+/**
+ * Give an operand order to each AND and OR of the model
+ * that does not have one yet
+ */
+void RBAOperandOrders::create(RBAModelImpl* const model)
+{
+  for (const RBAConstraintImpl* const constraint : model->getConstraintImpls()) {
+    std::vector<RBALogicalOperator*> operators;
+    collect(constraint->getExpression(), operators);
+    for (RBALogicalOperator* const ope : operators) {
+      if (ope->getOperandOrder() == nullptr) {
+        ope->setOperandOrder(
+            std::make_unique<RBAOperandOrder>(ope->getOperand().size()));
+      }
+    }
+  }
+}
+
+/**
+ * Save the operand orders of the model
+ * @return false if the file could not be written
+ */
+bool RBAOperandOrders::write(RBAModelImpl* const model,
+                             const std::string& filename)
+{
+  std::ofstream ofs {filename};
+  if (!ofs) {
+    std::cerr << filename << ": Could not open file" << &std::endl;
+    return false;
+  }
+  for (const RBAConstraintImpl* const constraint : model->getConstraintImpls()) {
+    std::vector<RBALogicalOperator*> operators;
+    collect(constraint->getExpression(), operators);
+    for (std::size_t i {0U}; i < operators.size(); i++) {
+      const RBAOperandOrder* const order {operators[i]->getOperandOrder()};
+      if (order == nullptr) {
+        continue;
+      }
+      ofs << constraint->getElementName() << " " << i;
+      for (const std::uint32_t index : order->getOrder()) {
+        ofs << " " << index;
+      }
+      ofs << "\n";
+    }
+  }
+  ofs.flush();
+  if (!ofs) {
+    std::cerr << filename << ": Could not write file" << &std::endl;
+    return false;
+  }
+  return true;
+}
+
+/**
+ * Load the operand orders saved by write()
+ * The lines that do not match the model are ignored,
+ * so that a file of an older model can be used.
+ * @return false if the file could not be read
+ */
+bool RBAOperandOrders::read(RBAModelImpl* const model,
+                            const std::string& filename)
+{
+  std::ifstream ifs {filename};
+  if (!ifs) {
+    std::cerr << filename << ": Could not open file" << &std::endl;
+    return false;
+  }
+  create(model);
+  std::string line;
+  while (std::getline(ifs, line)) {
+    std::istringstream iss {line};
+    std::string name;
+    std::size_t number {0U};
+    if (!(iss >> name >> number)) {
+      continue;
+    }
+    std::vector<std::uint32_t> order;
+    std::uint32_t index {0U};
+    while (iss >> index) {
+      order.push_back(index);
+    }
+    const RBAConstraintImpl* const constraint
+      {model->findConstraintImpl(name)};
+    if (constraint == nullptr) {
+      continue;
+    }
+    std::vector<RBALogicalOperator*> operators;
+    collect(constraint->getExpression(), operators);
+    if (number < operators.size()) {
+      static_cast<void>(operators[number]->getOperandOrder()->setOrder(order));
+    }
+  }
+  return true;
+}
+
+/**
+ * Collect AND and OR in pre-order
+ */
+void RBAOperandOrders::collect(RBAExpression* const exp,
+                               std::vector<RBALogicalOperator*>& operators)
+{
+  if (exp == nullptr) {
+    return;
+  }
+  if (exp->isModelElementType(RBAModelElementType::AndOperator)
+      || exp->isModelElementType(RBAModelElementType::OrOperator)) {
+    operators.push_back(dynamic_cast<RBALogicalOperator*>(exp));
+  }
+  for (RBALetStatement* const letStatement : exp->getLetStatements()) {
+    collect(letStatement, operators);
+  }
+  const RBAOperator* const ope {dynamic_cast<const RBAOperator*>(exp)};
+  if (ope != nullptr) {
+    for (RBAExpression* const operand : ope->getOperand()) {
+      collect(operand, operators);
+    }
+  }
+  const RBALambdaContext* const context {dynamic_cast<const RBALambdaContext*>(exp)};
+  if ((context != nullptr) && (context->getLambda() != nullptr)) {
+    collect(context->getLambda()->getBodyText(), operators);
+  }
+  const RBAIfStatement* const ifStatement {dynamic_cast<const RBAIfStatement*>(exp)};
+  if (ifStatement != nullptr) {
+    collect(ifStatement->getCondition(), operators);
+    collect(ifStatement->getThenExpression(), operators);
+    collect(ifStatement->getElseExpression(), operators);
+  }
+  const RBAPreviousModifier* const previous
+    {dynamic_cast<const RBAPreviousModifier*>(exp)};
+  if (previous != nullptr) {
+    collect(previous->getObjReference(), operators);
+  }
+}
+
+} /* namespace rba */
@@ -0,0 +1,64 @@
+/**
+ * Copyright (c) 2019 DENSO CORPORATION.
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Operand orders class header file
+ *
+ * Creates, saves and loads the learned operand orders (RBAOperandOrder)
+ * of the AND and OR expressions of a model.
+ * The file is a text file. Each line is
+ *   <constraint name> <operator number> <operand index>...
+ * where the operator number is the position of the AND or OR in the
+ * pre-order traversal of the constraint expression.
+ */
+
+#ifndef RBAOPERANDORDERS_HPP
+#define RBAOPERANDORDERS_HPP
+
+#include <string>
+#include <vector>
+
+namespace rba
+{
+
+class RBAModelImpl;
+class RBAExpression;
+class RBALogicalOperator;
+
+class RBAOperandOrders
+{
+ public:
+  RBAOperandOrders()=delete;
+  RBAOperandOrders(const RBAOperandOrders&)=delete;
+  RBAOperandOrders(const RBAOperandOrders&&)=delete;
+  RBAOperandOrders& operator=(const RBAOperandOrders&)=delete;
+  RBAOperandOrders& operator=(const RBAOperandOrders&&)=delete;
+  ~RBAOperandOrders()=delete;
+
+ public:
+  static void create(RBAModelImpl* const model);
+  static bool write(RBAModelImpl* const model, const std::string& filename);
+  static bool read(RBAModelImpl* const model, const std::string& filename);
+
+ private:
+  static void collect(RBAExpression* const exp,
+                      std::vector<RBALogicalOperator*>& operators);
+
+};
+
+} /* namespace rba */
+
+#endif /* RBAOPERANDORDERS_HPP */
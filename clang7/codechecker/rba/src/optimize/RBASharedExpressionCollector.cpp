@@ -0,0 +1,512 @@
+/**
+ * Copyright (c) 2019 DENSO CORPORATION.
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Shared expression collector class definition file
+ */
+
+#include <algorithm>
+#include <memory>
+
+#include "RBASharedExpressionCollector.hpp"
+
+#include "RBAActiveContents.hpp"
+#include "RBAActiveState.hpp"
+#include "RBAAllInstanceOfArea.hpp"
+#include "RBAAllInstanceOfSoundContent.hpp"
+#include "RBAAllInstanceOfViewContent.hpp"
+#include "RBAAllInstanceOfZone.hpp"
+#include "RBAAllocatedContent.hpp"
+#include "RBAAndOperator.hpp"
+#include "RBAConstantExpression.hpp"
+#include "RBAConstraintImpl.hpp"
+#include "RBAContentValue.hpp"
+#include "RBADisplayingContent.hpp"
+#include "RBAExistsOperator.hpp"
+#include "RBAForAllOperator.hpp"
+#include "RBAGetAllocatables.hpp"
+#include "RBAGetContentsList.hpp"
+#include "RBAGetProperty.hpp"
+#include "RBAHasBeenDisplayed.hpp"
+#include "RBAHasComeEarlierThan.hpp"
+#include "RBAHasComeLaterThan.hpp"
+#include "RBAIfStatement.hpp"
+#include "RBAImpliesOperator.hpp"
+#include "RBAIntegerValue.hpp"
+#include "RBAIsActive.hpp"
+#include "RBAIsAttenuated.hpp"
+#include "RBAIsDisplayed.hpp"
+#include "RBAIsEqualToOperator.hpp"
+#include "RBAIsGreaterThanEqualOperator.hpp"
+#include "RBAIsGreaterThanOperator.hpp"
+#include "RBAIsHidden.hpp"
+#include "RBAIsLowerThanEqualOperator.hpp"
+#include "RBAIsLowerThanOperator.hpp"
+#include "RBAIsMuted.hpp"
+#include "RBAIsOn.hpp"
+#include "RBAIsOutputted.hpp"
+#include "RBAIsSounding.hpp"
+#include "RBAIsTypeOfOperator.hpp"
+#include "RBAIsVisible.hpp"
+#include "RBALambdaExpression.hpp"
+#include "RBALetStatement.hpp"
+#include "RBAMaxOperator.hpp"
+#include "RBAMinOperator.hpp"
+#include "RBAModelElementType.hpp"
+#include "RBAModelImpl.hpp"
+#include "RBANotOperator.hpp"
+#include "RBAObjectCompare.hpp"
+#include "RBAObjectReference.hpp"
+#include "RBAOrOperator.hpp"
+#include "RBAOutputtingSound.hpp"
+#include "RBAPreviousModifier.hpp"
+#include "RBASelectOperator.hpp"
+#include "RBASetOfOperator.hpp"
+#include "RBASizeOperator.hpp"
+#include "RBAStateValue.hpp"
+#include "RBAVariable.hpp"
+
+namespace rba
+{
+
+namespace
+{
+
+// Smallest number of nodes of a shared expression.
+// Copying the result of a smaller expression costs as much as evaluating it.
+const std::uint32_t MIN_SHARED_SIZE {3U};
+
+}
+
+RBASharedExpressionCollector::RBASharedExpressionCollector(RBAModelImpl* const model)
+    : RBAExpressionVisitor(),
+      model_{model}
+{
+}
+
+/**
+ * Give the shared IDs to the expressions of all constraints of the model
+ */
+void RBASharedExpressionCollector::collect()
+{
+  for (const RBAConstraintImpl* const constraint : model_->getConstraintImpls()) {
+    static_cast<void>(collectExpression(constraint->getExpression()));
+  }
+  for (const std::vector<RBAExpression*>& group : groups_) {
+    if (group.size() > 1U) {
+      for (RBAExpression* const exp : group) {
+        exp->setSharedId(sharedCount_);
+      }
+      sharedCount_++;
+      expressionCount_ += static_cast<std::uint32_t>(group.size());
+    }
+  }
+  model_->setSharedExpressionCount(sharedCount_);
+  // A shared body is not evaluated directly, so this follows the shared IDs
+  for (const RBALambdaExpression* const lambda : lambdas_) {
+    const_cast<RBALambdaExpression*>(lambda)->createStatusCheck();
+  }
+}
+
+/**
+ * @return number of the shared IDs
+ */
+std::uint32_t RBASharedExpressionCollector::getSharedCount() const
+{
+  return sharedCount_;
+}
+
+/**
+ * @return number of the expressions that have a shared ID
+ */
+std::uint32_t RBASharedExpressionCollector::getExpressionCount() const
+{
+  return expressionCount_;
+}
+
+// area status
+void RBASharedExpressionCollector::visit(RBAIsDisplayed& exp)
+{
+  collectOperands(exp);
+}
+void RBASharedExpressionCollector::visit(RBADisplayingContent& exp)
+{
+  collectOperands(exp);
+}
+void RBASharedExpressionCollector::visit(RBAAllocatedContent& exp)
+{
+  collectOperands(exp);
+}
+void RBASharedExpressionCollector::visit(RBAIsHidden& exp)
+{
+  collectOperands(exp);
+}
+void RBASharedExpressionCollector::visit(RBAContentValue& exp)
+{
+  collectOperands(exp);
+}
+void RBASharedExpressionCollector::visit(RBAGetContentsList& exp)
+{
+  collectOperands(exp);
+}
+void RBASharedExpressionCollector::visit(RBAActiveContents& exp)
+{
+  collectOperands(exp);
+}
+
+// display content status
+void RBASharedExpressionCollector::visit(RBAIsActive& exp)
+{
+  collectOperands(exp);
+}
+void RBASharedExpressionCollector::visit(RBAIsVisible& exp)
+{
+  collectOperands(exp);
+}
+void RBASharedExpressionCollector::visit(RBAStateValue& exp)
+{
+  collectOperands(exp);
+}
+void RBASharedExpressionCollector::visit(RBAHasBeenDisplayed& exp)
+{
+  collectOperands(exp);
+}
+void RBASharedExpressionCollector::visit(RBAHasComeEarlierThan& exp)
+{
+  collectOperands(exp);
+}
+void RBASharedExpressionCollector::visit(RBAHasComeLaterThan& exp)
+{
+  collectOperands(exp);
+}
+void RBASharedExpressionCollector::visit(RBAGetAllocatables& exp)
+{
+  collectOperands(exp);
+}
+void RBASharedExpressionCollector::visit(RBAActiveState& exp)
+{
+  collectOperands(exp);
+}
+
+// zone status
+void RBASharedExpressionCollector::visit(RBAIsOutputted& exp)
+{
+  collectOperands(exp);
+}
+void RBASharedExpressionCollector::visit(RBAOutputtingSound& exp)
+{
+  collectOperands(exp);
+}
+void RBASharedExpressionCollector::visit(RBAIsMuted& exp)
+{
+  collectOperands(exp);
+}
+void RBASharedExpressionCollector::visit(RBAIsAttenuated& exp)
+{
+  collectOperands(exp);
+}
+
+// sound content status
+void RBASharedExpressionCollector::visit(RBAIsSounding& exp)
+{
+  collectOperands(exp);
+}
+
+// scene
+void RBASharedExpressionCollector::visit(RBAIsOn& exp)
+{
+  collectOperands(exp);
+}
+void RBASharedExpressionCollector::visit(RBAGetProperty& exp)
+{
+  collectOperands(exp);
+}
+void RBASharedExpressionCollector::visit(RBAIsTypeOfOperator& exp)
+{
+  collectOperands(exp);
+  key_ += "#" + exp.getTag();
+}
+
+// operator
+void RBASharedExpressionCollector::visit(RBAAndOperator& exp)
+{
+  collectOperands(exp);
+}
+void RBASharedExpressionCollector::visit(RBAOrOperator& exp)
+{
+  collectOperands(exp);
+}
+void RBASharedExpressionCollector::visit(RBANotOperator& exp)
+{
+  collectOperands(exp);
+}
+void RBASharedExpressionCollector::visit(RBAImpliesOperator& exp)
+{
+  collectOperands(exp);
+}
+void RBASharedExpressionCollector::visit(RBAIsEqualToOperator& exp)
+{
+  collectOperands(exp);
+}
+void RBASharedExpressionCollector::visit(RBAObjectCompare& exp)
+{
+  collectOperands(exp);
+}
+void RBASharedExpressionCollector::visit(RBAIsGreaterThanOperator& exp)
+{
+  collectOperands(exp);
+}
+void RBASharedExpressionCollector::visit(RBAIsGreaterThanEqualOperator& exp)
+{
+  collectOperands(exp);
+}
+void RBASharedExpressionCollector::visit(RBAIsLowerThanOperator& exp)
+{
+  collectOperands(exp);
+}
+void RBASharedExpressionCollector::visit(RBAIsLowerThanEqualOperator& exp)
+{
+  collectOperands(exp);
+}
+
+// Quantification symbol
+void RBASharedExpressionCollector::visit(RBAForAllOperator& exp)
+{
+  collectLambda(exp);
+}
+void RBASharedExpressionCollector::visit(RBAExistsOperator& exp)
+{
+  collectLambda(exp);
+}
+
+// Built-in definition expression
+void RBASharedExpressionCollector::visit(RBAAllInstanceOfArea& exp)
+{
+  key_ = std::to_string(static_cast<std::uint32_t>(exp.getModelElementType()));
+}
+void RBASharedExpressionCollector::visit(RBAAllInstanceOfViewContent& exp)
+{
+  key_ = std::to_string(static_cast<std::uint32_t>(exp.getModelElementType()));
+}
+void RBASharedExpressionCollector::visit(RBAAllInstanceOfZone& exp)
+{
+  key_ = std::to_string(static_cast<std::uint32_t>(exp.getModelElementType()));
+}
+void RBASharedExpressionCollector::visit(RBAAllInstanceOfSoundContent& exp)
+{
+  key_ = std::to_string(static_cast<std::uint32_t>(exp.getModelElementType()));
+}
+
+// statement
+void RBASharedExpressionCollector::visit(RBAIfStatement& exp)
+{
+  key_ = std::to_string(static_cast<std::uint32_t>(exp.getModelElementType()));
+  const std::string condition {collectExpression(exp.getCondition())};
+  const std::string thenExpression {collectExpression(exp.getThenExpression())};
+  const std::string elseExpression {collectExpression(exp.getElseExpression())};
+  key_ += "(" + condition + "," + thenExpression + "," + elseExpression + ")";
+}
+void RBASharedExpressionCollector::visit(RBALetStatement& exp)
+{
+  // A let statement is not an operand
+  known_ = false;
+}
+
+// modifier
+void RBASharedExpressionCollector::visit(RBAPreviousModifier& exp)
+{
+  key_ = std::to_string(static_cast<std::uint32_t>(exp.getModelElementType()));
+  const std::string object {collectExpression(exp.getObjReference())};
+  key_ += "(" + object + ")";
+}
+
+// operator
+void RBASharedExpressionCollector::visit(RBAMaxOperator& exp)
+{
+  collectLambda(exp);
+}
+void RBASharedExpressionCollector::visit(RBAMinOperator& exp)
+{
+  collectLambda(exp);
+}
+void RBASharedExpressionCollector::visit(RBASelectOperator& exp)
+{
+  collectLambda(exp);
+}
+void RBASharedExpressionCollector::visit(RBASizeOperator& exp)
+{
+  collectOperands(exp);
+}
+
+// object reference
+void RBASharedExpressionCollector::visit(RBAObjectReference& exp)
+{
+  key_ = std::to_string(static_cast<std::uint32_t>(exp.getModelElementType()));
+  addObject(exp.getRefObject());
+}
+void RBASharedExpressionCollector::visit(RBASetOfOperator& exp)
+{
+  collectOperands(exp);
+}
+
+/**
+ * Collect an expression and its children
+ * @return structure of exp
+ */
+std::string
+RBASharedExpressionCollector::collectExpression(RBAExpression* const exp)
+{
+  if (exp == nullptr) {
+    return "-";
+  }
+  std::string outerKey;
+  outerKey.swap(key_);
+  const bool outerKnown {known_};
+  const std::uint32_t outerSize {size_};
+  std::set<const RBARuleObject*> outerFreeVariables;
+  outerFreeVariables.swap(freeVariables_);
+  // Let statements may bind variables for the operands
+  known_ = exp->getLetStatements().empty();
+  size_ = 1U;
+
+  // Expressions that have no accept()
+  const RBAConstantExpression* const constant
+    {dynamic_cast<const RBAConstantExpression*>(exp)};
+  const RBAIntegerValue* const integer
+    {dynamic_cast<const RBAIntegerValue*>(exp)};
+  if (constant != nullptr) {
+    key_ = "c" + std::to_string(static_cast<std::uint32_t>(constant->getResult()));
+    addObject(constant->getObject());
+  } else if (integer != nullptr) {
+    key_ = "i" + std::to_string(integer->getValue());
+  } else {
+    exp->accept(*this);
+  }
+  if (key_.empty()) {
+    known_ = false;
+  }
+
+  if (known_ && freeVariables_.empty() && (size_ >= MIN_SHARED_SIZE)
+      && isCandidate(*exp)) {
+    const auto it = keyToGroup_.find(key_);
+    if (it == keyToGroup_.end()) {
+      keyToGroup_[key_] = groups_.size();
+      groups_.push_back({exp});
+    } else {
+      groups_[it->second].push_back(exp);
+    }
+  }
+
+  std::string key;
+  key.swap(key_);
+  key_.swap(outerKey);
+  known_ = (outerKnown && known_);
+  size_ += outerSize;
+  freeVariables_.insert(outerFreeVariables.begin(), outerFreeVariables.end());
+  return key;
+}
+
+void RBASharedExpressionCollector::collectOperands(const RBAOperator& exp)
+{
+  key_ = std::to_string(static_cast<std::uint32_t>(exp.getModelElementType()));
+  key_ += "(";
+  for (RBAExpression* const ope : exp.getOperand()) {
+    const std::string operand {collectExpression(ope)};
+    key_ += operand + ",";
+  }
+  key_ += ")";
+}
+
+void RBASharedExpressionCollector::collectLambda(const RBALambdaContext& exp)
+{
+  collectOperands(exp);
+  const RBALambdaExpression* const lambda {exp.getLambda()};
+  if (lambda == nullptr) {
+    known_ = false;
+    return;
+  }
+  lambdas_.push_back(lambda);
+  const RBARuleObject* const x {lambda->getX()};
+  boundVariables_.push_back(x);
+  const std::string body {collectExpression(lambda->getBodyText())};
+  boundVariables_.pop_back();
+  static_cast<void>(freeVariables_.erase(x));
+  key_ += "{" + body + "}";
+}
+
+/**
+ * Add a referred object to the structure
+ * A variable is identified by the number of lambdas between the reference
+ * and the lambda that binds it, so that the same expression written with
+ * other variable names has the same structure.
+ */
+void RBASharedExpressionCollector::addObject(const RBARuleObject* const object)
+{
+  if ((object == nullptr)
+      || !object->isModelElementType(RBAModelElementType::Variable)) {
+    key_ += "@" + std::to_string(reinterpret_cast<std::uintptr_t>(object));
+    return;
+  }
+  static_cast<void>(freeVariables_.insert(object));
+  const auto it = std::find(boundVariables_.rbegin(), boundVariables_.rend(),
+                            object);
+  if (it == boundVariables_.rend()) {
+    // Bound by a let statement
+    key_ += "$" + std::to_string(reinterpret_cast<std::uintptr_t>(object));
+  } else {
+    key_ += "$" + std::to_string(it - boundVariables_.rbegin());
+  }
+}
+
+/**
+ * Whether exp is evaluated by execute()
+ */
+bool RBASharedExpressionCollector::isCandidate(const RBAExpression& exp)
+{
+  switch (exp.getModelElementType()) {
+    case RBAModelElementType::IsDisplayed:
+    case RBAModelElementType::IsHidden:
+    case RBAModelElementType::IsActive:
+    case RBAModelElementType::IsVisible:
+    case RBAModelElementType::HasBeenDisplayed:
+    case RBAModelElementType::HasComeEarlier:
+    case RBAModelElementType::HasComeLater:
+    case RBAModelElementType::IsOutputted:
+    case RBAModelElementType::IsMuted:
+    case RBAModelElementType::IsAttenuated:
+    case RBAModelElementType::IsSounding:
+    case RBAModelElementType::IsOn:
+    case RBAModelElementType::IsTypeOfOperator:
+    case RBAModelElementType::AndOperator:
+    case RBAModelElementType::OrOperator:
+    case RBAModelElementType::NotOperator:
+    case RBAModelElementType::ImpliesOperator:
+    case RBAModelElementType::IsEqualToOperator:
+    case RBAModelElementType::ObjectCompare:
+    case RBAModelElementType::IsGreaterThanOperator:
+    case RBAModelElementType::IsGreaterThanEqualOperator:
+    case RBAModelElementType::IsLowerThanOperator:
+    case RBAModelElementType::IsLowerThanEqualOperator:
+    case RBAModelElementType::ForAllOperator:
+    case RBAModelElementType::ExistsOperator:
+    case RBAModelElementType::IfStatement:
+      return true;
+    default:
+      return false;
+  }
+}
+
+} /* namespace rba */
@@ -0,0 +1,169 @@
+/**
+ * Copyright (c) 2019 DENSO CORPORATION.
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Shared expression collector class header file
+ *
+ * Searches the structurally identical sub-expressions of the constraints
+ * of a model, and gives the same shared ID to each group of them.
+ * Two expressions are identical if they have the same type, the same
+ * referred objects and identical operands. Variables are compared by
+ * the lambda that binds them.
+ * Only the boolean expressions that refer to no variable from outside
+ * and have no let statement get an ID, because only their result is
+ * decided by the state of the arbitration alone.
+ */
+
+#ifndef RBASHAREDEXPRESSIONCOLLECTOR_HPP
+#define RBASHAREDEXPRESSIONCOLLECTOR_HPP
+
+#include <cstdint>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "RBAExpressionVisitor.hpp"
+
+namespace rba
+{
+
+class RBAModelImpl;
+class RBAExpression;
+class RBAOperator;
+class RBALambdaContext;
+class RBALambdaExpression;
+class RBARuleObject;
+
+class RBASharedExpressionCollector : public RBAExpressionVisitor
+{
+ public:
+  explicit RBASharedExpressionCollector(RBAModelImpl* const model);
+  RBASharedExpressionCollector(const RBASharedExpressionCollector&)=delete;
+  RBASharedExpressionCollector(const RBASharedExpressionCollector&&)=delete;
+  RBASharedExpressionCollector& operator=(const RBASharedExpressionCollector&)=delete;
+  RBASharedExpressionCollector& operator=(const RBASharedExpressionCollector&&)=delete;
+  virtual ~RBASharedExpressionCollector()=default;
+
+  void collect();
+  std::uint32_t getSharedCount() const;
+  std::uint32_t getExpressionCount() const;
+
+  // area status
+  void visit(RBAIsDisplayed& exp) override;
+  void visit(RBADisplayingContent& exp) override;
+  void visit(RBAAllocatedContent& exp) override;
+  void visit(RBAIsHidden& exp) override;
+  void visit(RBAContentValue& exp) override;
+  void visit(RBAGetContentsList& exp) override;
+  void visit(RBAActiveContents& exp) override;
+
+  // display content status
+  void visit(RBAIsActive& exp) override;
+  void visit(RBAIsVisible& exp) override;
+  void visit(RBAStateValue& exp) override;
+  void visit(RBAHasBeenDisplayed& exp) override;
+  void visit(RBAHasComeEarlierThan& exp) override;
+  void visit(RBAHasComeLaterThan& exp) override;
+  void visit(RBAGetAllocatables& exp) override;
+  void visit(RBAActiveState& exp) override;
+
+  // zone status
+  void visit(RBAIsOutputted& exp) override;
+  void visit(RBAOutputtingSound& exp) override;
+  void visit(RBAIsMuted& exp) override;
+  void visit(RBAIsAttenuated& exp) override;
+
+  // sound content status
+  void visit(RBAIsSounding& exp) override;
+
+  // scene
+  void visit(RBAIsOn& exp) override;
+  void visit(RBAGetProperty& exp) override;
+
+  void visit(RBAIsTypeOfOperator& exp) override;
+
+  // operator
+  void visit(RBAAndOperator& exp) override;
+  void visit(RBAOrOperator& exp) override;
+  void visit(RBANotOperator& exp) override;
+  void visit(RBAImpliesOperator& exp) override;
+  void visit(RBAIsEqualToOperator& exp) override;
+  void visit(RBAObjectCompare& exp) override;
+  void visit(RBAIsGreaterThanOperator& exp) override;
+  void visit(RBAIsGreaterThanEqualOperator& exp) override;
+  void visit(RBAIsLowerThanOperator& exp) override;
+  void visit(RBAIsLowerThanEqualOperator& exp) override;
+
+  // Quantification symbol
+  void visit(RBAForAllOperator& exp) override;
+  void visit(RBAExistsOperator& exp) override;
+
+  // Built-in definition expression
+  void visit(RBAAllInstanceOfArea& exp) override;
+  void visit(RBAAllInstanceOfViewContent& exp) override;
+  void visit(RBAAllInstanceOfZone& exp) override;
+  void visit(RBAAllInstanceOfSoundContent& exp) override;
+
+  // statement
+  void visit(RBAIfStatement& exp) override;
+  void visit(RBALetStatement& exp) override;
+
+  // modifier
+  void visit(RBAPreviousModifier& exp) override;
+
+  // operator
+  void visit(RBAMaxOperator& exp) override;
+  void visit(RBAMinOperator& exp) override;
+  void visit(RBASelectOperator& exp) override;
+  void visit(RBASizeOperator& exp) override;
+
+  // object reference
+  void visit(RBAObjectReference& exp) override;
+  void visit(RBASetOfOperator& exp) override;
+
+ private:
+  std::string collectExpression(RBAExpression* const exp);
+  void collectOperands(const RBAOperator& exp);
+  void collectLambda(const RBALambdaContext& exp);
+  void addObject(const RBARuleObject* const object);
+  static bool isCandidate(const RBAExpression& exp);
+
+ private:
+  RBAModelImpl* model_;
+  // Structure of the expression being visited
+  std::string key_;
+  // false if the expression being visited contains an expression
+  // whose structure is unknown or a let statement
+  bool known_ {true};
+  // Number of the nodes of the expression being visited
+  std::uint32_t size_ {0U};
+  // Variables that the expression being visited refers to and does not bind
+  std::set<const RBARuleObject*> freeVariables_;
+  // Variables bound by the lambdas enclosing the expression being visited
+  std::vector<const RBARuleObject*> boundVariables_;
+  // Candidates of the shared expressions grouped by structure
+  std::unordered_map<std::string, std::size_t> keyToGroup_;
+  std::vector<std::vector<RBAExpression*>> groups_;
+  // Lambdas whose status-check body is decided after the shared IDs
+  std::vector<const RBALambdaExpression*> lambdas_;
+  std::uint32_t sharedCount_ {0U};
+  std::uint32_t expressionCount_ {0U};
+};
+
+} /* namespace rba */
+
+#endif /* RBASHAREDEXPRESSIONCOLLECTOR_HPP */
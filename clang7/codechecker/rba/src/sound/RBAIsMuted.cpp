@@ -53,25 +53,11 @@ RBAIsMuted::executeCore(RBAConstraintInfo* info,
   if ((leftInfo->isExceptionBeforeArbitrate()) || (ruleObj == nullptr)) {
     info->setExceptionBeforeArbitrate(true);
   } else {
-    const RBAAllocatable* const zone {dynamic_cast<const RBAAllocatable*>(ruleObj->getRawObject())};
-    info->addOperandAllocatable(zone);
-    if (ruleObj->isPrevious() == false) {
-      if (zone->isHiddenChecked() == false) {
-        info->setExceptionBeforeArbitrate(true);
-      } else if (zone->isHidden() == true) {
-        isPassed = true;
-        info->addTrueAllocatable(zone);
-      } else {
-        info->addFalseAllocatable(zone);
-      }
-    } else {
-      isPassed = arb->getResult()->isPreHidden(zone);
-    }
+    isPassed = executeFor(info, arb, ruleObj);
   }
 #ifdef RBA_USE_LOG
   if (ruleObj != nullptr) {
-    const RBAAllocatable* zone = dynamic_cast<const RBAAllocatable*>(ruleObj
-        ->getRawObject());
+    const RBAAllocatable* zone = ruleObj->getRawObject()->toAllocatable();
     if (info->isExceptionBeforeArbitrate() == true) {
       LOG_arbitrateConstraintLogicLogLine(
           "      [" + zone->getElementName() + getSymbol()
@@ -107,6 +93,32 @@ RBAIsMuted::executeCore(RBAConstraintInfo* info,
   return isPassed;
 }
 
+/**
+ * Evaluate the expression with ruleObj as the object of the operand
+ */
+bool
+RBAIsMuted::executeFor(RBAConstraintInfo* const info,
+                       RBAArbitratorImpl* const arb,
+                       const RBARuleObject* const ruleObj) const
+{
+  bool isPassed {false};
+  const RBAAllocatable* const zone {ruleObj->getRawObject()->toAllocatable()};
+  info->addOperandAllocatable(zone);
+  if (ruleObj->isPrevious() == false) {
+    if (zone->isHiddenChecked() == false) {
+      info->setExceptionBeforeArbitrate(true);
+    } else if (zone->isHidden() == true) {
+      isPassed = true;
+      info->addTrueAllocatable(zone);
+    } else {
+      info->addFalseAllocatable(zone);
+    }
+  } else {
+    isPassed = arb->getResult()->isPreHidden(zone);
+  }
+  return isPassed;
+}
+
 #ifdef RBA_USE_LOG
 const std::string
 RBAIsMuted::getSymbol() const
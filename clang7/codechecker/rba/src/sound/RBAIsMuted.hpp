@@ -42,6 +42,8 @@ public:
   void accept(RBAExpressionVisitor& visitor) override;
   RBAModelElementType getModelElementType() const override;
   bool executeCore(RBAConstraintInfo* info, RBAArbitratorImpl * arb) const override;
+  bool executeFor(RBAConstraintInfo* const info, RBAArbitratorImpl* const arb,
+                  const RBARuleObject* const ruleObj) const;
 
   // Log
 #ifdef RBA_USE_LOG
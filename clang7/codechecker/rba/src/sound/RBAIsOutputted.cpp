@@ -55,7 +55,7 @@ RBAIsOutputted::executeCore(RBAConstraintInfo* info,
   if ((leftInfo->isExceptionBeforeArbitrate()) || (ruleObj == nullptr)) {
     info->setExceptionBeforeArbitrate(true);
   } else {
-    const RBAAllocatable* const zone {dynamic_cast<const RBAAllocatable*>(ruleObj->getRawObject())};
+    const RBAAllocatable* const zone {ruleObj->getRawObject()->toAllocatable()};
     info->addOperandAllocatable(zone);
     if (ruleObj->isPrevious() == true) {
       if ((arb->getResult()->isPreHidden(zone) == false)
@@ -82,8 +82,7 @@ RBAIsOutputted::executeCore(RBAConstraintInfo* info,
   }
 #ifdef RBA_USE_LOG
   if (ruleObj != nullptr) {
-    const RBAAllocatable* zone = dynamic_cast<const RBAAllocatable*>(ruleObj
-        ->getRawObject());
+    const RBAAllocatable* zone = ruleObj->getRawObject()->toAllocatable();
     if (info->isExceptionBeforeArbitrate() == true) {
       LOG_arbitrateConstraintLogicLogLine(
           "      Zone[" + zone->getElementName()
@@ -57,10 +57,64 @@ RBAIsSounding::executeCore(RBAConstraintInfo* info,
     {getLhsOperand()->getReferenceObject(leftInfo, arb)};
   const RBAContent* content {nullptr};
   if (ruleObj != nullptr) {
-    content = dynamic_cast<const RBAContent*>(ruleObj->getRawObject());
+    content = ruleObj->getRawObject()->toContent();
   }
   if (leftInfo->isExceptionBeforeArbitrate() || (content == nullptr)) {
     info->setExceptionBeforeArbitrate(true);
+  } else {
+    isPassed = executeFor(info, arb, ruleObj);
+  }
+#ifdef RBA_USE_LOG
+  if (info->isExceptionBeforeArbitrate() == true) {
+    if (content != nullptr) {
+    LOG_arbitrateConstraintLogicLogLine(
+        "      Content[" + content->getElementName()
+        + "] before arbitrate skip");
+    } else {
+      LOG_arbitrateConstraintLogicLogLine(
+          "      Content[NULL] before arbitrate skip");
+    }
+    LOG_coverageConstraintExpressionLog(LOG_getCoverageExpressionText(),
+        RBAExecuteResult::SKIP);
+  } else if (isPassed == true) {
+    const RBAContentState* contentState;
+    if (ruleObj->isPrevious() == false) {
+      contentState = arb->getResult()->getActiveState(content);
+    } else {
+      contentState = arb->getResult()->getPreActiveState(content);
+    }
+    LOG_arbitrateConstraintLogicLogLine(
+        "      " + getPreMsg(ruleObj->isPrevious()) + "Content["
+        + content->getElementName() + "::" + contentState->getElementName()
+        + "] is Sounding");
+    LOG_coverageConstraintExpressionLog(LOG_getCoverageExpressionText(),
+                                        RBAExecuteResult::TRUE);
+  } else {
+    LOG_arbitrateConstraintLogicLogLine(
+        "      " + getPreMsg(ruleObj->isPrevious()) + "Content["
+        + content->getElementName() + "] is not Sounding");
+    LOG_coverageConstraintExpressionLog(LOG_getCoverageExpressionText(),
+                                        RBAExecuteResult::FALSE);
+  }
+#endif
+  // Remove itself from the constraint hierarchy for coverage
+  LOG_removeHierarchy();
+  return isPassed;
+}
+
+/**
+ * Evaluate the expression with ruleObj as the object of the operand
+ */
+bool
+RBAIsSounding::executeFor(RBAConstraintInfo* const info,
+                          RBAArbitratorImpl* const arb,
+                          const RBARuleObject* const ruleObj) const
+{
+  bool isPassed {false};
+  const RBAContent* const content
+    {ruleObj->getRawObject()->toContent()};
+  if (content == nullptr) {
+    info->setExceptionBeforeArbitrate(true);
   } else if (ruleObj->isPrevious() == false) {
     const RBAContentState* const contentState
       {arb->getResult()->getActiveState(content)};
@@ -107,41 +161,6 @@ RBAIsSounding::executeCore(RBAConstraintInfo* info,
       }
     }
   }
-#ifdef RBA_USE_LOG
-  if (info->isExceptionBeforeArbitrate() == true) {
-    if (content != nullptr) {
-    LOG_arbitrateConstraintLogicLogLine(
-        "      Content[" + content->getElementName()
-        + "] before arbitrate skip");
-    } else {
-      LOG_arbitrateConstraintLogicLogLine(
-          "      Content[NULL] before arbitrate skip");
-    }
-    LOG_coverageConstraintExpressionLog(LOG_getCoverageExpressionText(),
-        RBAExecuteResult::SKIP);
-  } else if (isPassed == true) {
-    const RBAContentState* contentState;
-    if (ruleObj->isPrevious() == false) {
-      contentState = arb->getResult()->getActiveState(content);
-    } else {
-      contentState = arb->getResult()->getPreActiveState(content);
-    }
-    LOG_arbitrateConstraintLogicLogLine(
-        "      " + getPreMsg(ruleObj->isPrevious()) + "Content["
-        + content->getElementName() + "::" + contentState->getElementName()
-        + "] is Sounding");
-    LOG_coverageConstraintExpressionLog(LOG_getCoverageExpressionText(),
-                                        RBAExecuteResult::TRUE);
-  } else {
-    LOG_arbitrateConstraintLogicLogLine(
-        "      " + getPreMsg(ruleObj->isPrevious()) + "Content["
-        + content->getElementName() + "] is not Sounding");
-    LOG_coverageConstraintExpressionLog(LOG_getCoverageExpressionText(),
-                                        RBAExecuteResult::FALSE);
-  }
-#endif
-  // Remove itself from the constraint hierarchy for coverage
-  LOG_removeHierarchy();
   return isPassed;
 }
 
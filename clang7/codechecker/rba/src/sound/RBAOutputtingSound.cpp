@@ -57,7 +57,7 @@ RBAOutputtingSound::getReferenceObjectCore(RBAConstraintInfo* info,
   const auto ruleObj = getLhsOperand()->getReferenceObject(leftInfo, arb);
   if (!leftInfo->isExceptionBeforeArbitrate()) {
     if (ruleObj != nullptr) {
-      const RBAAllocatable* const alloc {dynamic_cast<const RBAAllocatable*>(ruleObj->getRawObject())};
+      const RBAAllocatable* const alloc {ruleObj->getRawObject()->toAllocatable()};
       if (ruleObj->isPrevious()) {
         if (!arb->getResult()->isPreHidden(alloc)) {
           const auto contentState = arb->getResult()->getDirectPreContentState(alloc);
@@ -102,7 +102,7 @@ RBAOutputtingSound::getReferenceObjectCore(RBAConstraintInfo* info,
   if (leftInfo->isExceptionBeforeArbitrate()) {
     resultText = "is before arbitrate skip";
   } else if (object == nullptr) {
-    if((ruleObj != nullptr) && dynamic_cast<const RBAAllocatable*>(ruleObj->getRawObject())->isChecked()) {
+    if((ruleObj != nullptr) && ruleObj->getRawObject()->toAllocatable()->isChecked()) {
       resultText = "has no Outputted Content";
     } else {
       resultText = "is before arbitrate skip";
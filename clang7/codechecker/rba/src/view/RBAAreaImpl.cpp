@@ -199,6 +199,18 @@ RBAAreaImpl::resetCoordinate()
   y_ = defaultY_;
 }
 
+void
+RBAAreaImpl::setPositionContainer(const RBAPositionContainerImpl* const posCont)
+{
+  positionContainer_ = posCont;
+}
+
+const RBAPositionContainerImpl*
+RBAAreaImpl::getPositionContainer() const
+{
+  return positionContainer_;
+}
+
 RBAModelElementType
 RBAAreaImpl::getModelElementType() const
 {
@@ -32,6 +32,7 @@ class RBASize;
 class RBASizeImpl;
 class RBAViewContent;
 class RBAViewContentImpl;
+class RBAPositionContainerImpl;
 
 class DLL_EXPORT RBAAreaImpl : public RBAArea, public RBAAllocatable
 {
@@ -62,6 +63,8 @@ public:
   void addSize(const RBASizeImpl* size);
   void addContent(const RBAViewContentImpl* const content);
   void resetCoordinate();
+  void setPositionContainer(const RBAPositionContainerImpl* const posCont);
+  const RBAPositionContainerImpl* getPositionContainer() const;
   RBAModelElementType getModelElementType() const override;
   const std::list<const RBAViewContent*>& getAllViewContents() const;
   const std::list<const RBAViewContent*> getAllViewContentsRecursive(const RBAAllocatable* const alloc) const;
@@ -78,6 +81,7 @@ private:
   std::int32_t defaultX_ {0};
   std::int32_t defaultY_ {0};
   std::int32_t zorder_ {0};
+  const RBAPositionContainerImpl* positionContainer_ {nullptr};
 #ifdef _MSC_VER
 #pragma warning(push)
 #pragma warning(disable:4251)
@@ -57,31 +57,7 @@ RBAIsDisplayed::executeCore(RBAConstraintInfo* info,
   if ((leftInfo->isExceptionBeforeArbitrate()) || (ruleObj == nullptr)) {
     info->setExceptionBeforeArbitrate(true);
   } else {
-    const RBAAllocatable* const allocatable {dynamic_cast<const RBAAllocatable*>(ruleObj->getRawObject())};
-    info->addOperandAllocatable(allocatable);
-    if (ruleObj->isPrevious() == true) {
-      if ((arb->getResult()->isPreHidden(allocatable) == false)
-          && (arb->getResult()->getPreAllocatedContentState(allocatable)
-              != nullptr)) {
-        isPassed = true;
-      }
-    } else {
-      if ((allocatable->isHiddenChecked() == true)
-          && (allocatable->isHidden() == true)) {
-        info->addFalseAllocatable(allocatable);
-      } else {
-        if (allocatable->isChecked() == true) {
-          if (allocatable->getState() != nullptr) {
-            info->addTrueAllocatable(allocatable);
-            isPassed = true;
-          } else {
-            info->addFalseAllocatable(allocatable);
-          }
-        } else {
-          info->setExceptionBeforeArbitrate(true);
-        }
-      }
-    }
+    isPassed = executeFor(info, arb, ruleObj);
   }
 #ifdef RBA_USE_LOG
   std::string lhsName;
@@ -93,7 +69,7 @@ RBAIsDisplayed::executeCore(RBAConstraintInfo* info,
     // so this is implemented.
     lhsName = "NULL";
   } else {
-    allocatable = dynamic_cast<const RBAAllocatable*>(ruleObj->getRawObject());
+    allocatable = ruleObj->getRawObject()->toAllocatable();
     lhsName = allocatable->getElementName();
   }
   if (info->isExceptionBeforeArbitrate() == true) {
@@ -129,6 +105,43 @@ RBAIsDisplayed::executeCore(RBAConstraintInfo* info,
   return isPassed;
 }
 
+/**
+ * Evaluate the expression with ruleObj as the object of the operand
+ */
+bool
+RBAIsDisplayed::executeFor(RBAConstraintInfo* const info,
+                           RBAArbitratorImpl* const arb,
+                           const RBARuleObject* const ruleObj) const
+{
+  bool isPassed {false};
+  const RBAAllocatable* const allocatable {ruleObj->getRawObject()->toAllocatable()};
+  info->addOperandAllocatable(allocatable);
+  if (ruleObj->isPrevious() == true) {
+    if ((arb->getResult()->isPreHidden(allocatable) == false)
+        && (arb->getResult()->getPreAllocatedContentState(allocatable)
+            != nullptr)) {
+      isPassed = true;
+    }
+  } else {
+    if ((allocatable->isHiddenChecked() == true)
+        && (allocatable->isHidden() == true)) {
+      info->addFalseAllocatable(allocatable);
+    } else {
+      if (allocatable->isChecked() == true) {
+        if (allocatable->getState() != nullptr) {
+          info->addTrueAllocatable(allocatable);
+          isPassed = true;
+        } else {
+          info->addFalseAllocatable(allocatable);
+        }
+      } else {
+        info->setExceptionBeforeArbitrate(true);
+      }
+    }
+  }
+  return isPassed;
+}
+
 #ifdef RBA_USE_LOG
 const std::string
 RBAIsDisplayed::getSymbol() const
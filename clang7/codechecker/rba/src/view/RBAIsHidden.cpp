@@ -53,25 +53,11 @@ RBAIsHidden::executeCore(RBAConstraintInfo* info,
   if ((leftInfo->isExceptionBeforeArbitrate()) || (ruleObj == nullptr)) {
     info->setExceptionBeforeArbitrate(true);
   } else {
-    const RBAAllocatable* const area {dynamic_cast<const RBAAllocatable*>(ruleObj->getRawObject())};
-    info->addOperandAllocatable(area);
-    if (ruleObj->isPrevious() == false) {
-      if (area->isHiddenChecked() == false) {
-        info->setExceptionBeforeArbitrate(true);
-      } else if (area->isHidden() == true) {
-        isPassed = true;
-        info->addTrueAllocatable(area);
-      } else {
-        info->addFalseAllocatable(area);
-      }
-    } else {
-      isPassed = arb->getResult()->isPreHidden(area);
-    }
+    isPassed = executeFor(info, arb, ruleObj);
   }
 #ifdef RBA_USE_LOG
   if (ruleObj != nullptr) {
-    const RBAAllocatable* area = dynamic_cast<const RBAAllocatable*>(ruleObj
-        ->getRawObject());
+    const RBAAllocatable* area = ruleObj->getRawObject()->toAllocatable();
     if (info->isExceptionBeforeArbitrate() == true) {
       LOG_arbitrateConstraintLogicLogLine(
           "      [" + area->getElementName() + getSymbol()
@@ -107,6 +93,32 @@ RBAIsHidden::executeCore(RBAConstraintInfo* info,
   return isPassed;
 }
 
+/**
+ * Evaluate the expression with ruleObj as the object of the operand
+ */
+bool
+RBAIsHidden::executeFor(RBAConstraintInfo* const info,
+                        RBAArbitratorImpl* const arb,
+                        const RBARuleObject* const ruleObj) const
+{
+  bool isPassed {false};
+  const RBAAllocatable* const area {ruleObj->getRawObject()->toAllocatable()};
+  info->addOperandAllocatable(area);
+  if (ruleObj->isPrevious() == false) {
+    if (area->isHiddenChecked() == false) {
+      info->setExceptionBeforeArbitrate(true);
+    } else if (area->isHidden() == true) {
+      isPassed = true;
+      info->addTrueAllocatable(area);
+    } else {
+      info->addFalseAllocatable(area);
+    }
+  } else {
+    isPassed = arb->getResult()->isPreHidden(area);
+  }
+  return isPassed;
+}
+
 #ifdef RBA_USE_LOG
 const std::string
 RBAIsHidden::getSymbol() const
@@ -54,10 +54,64 @@ RBAIsVisible::executeCore(RBAConstraintInfo* info,
     {getLhsOperand()->getReferenceObject(leftInfo, arb)};
   const RBAContent* content {nullptr};
   if (ruleObj != nullptr) {
-    content = dynamic_cast<const RBAContent*>(ruleObj->getRawObject());
+    content = ruleObj->getRawObject()->toContent();
   }
   if (leftInfo->isExceptionBeforeArbitrate() || (content == nullptr)) {
     info->setExceptionBeforeArbitrate(true);
+  } else {
+    isPassed = executeFor(info, arb, ruleObj);
+  }
+#ifdef RBA_USE_LOG
+  if (info->isExceptionBeforeArbitrate() == true) {
+    if(content == nullptr) {
+      LOG_arbitrateConstraintLogicLogLine(
+          "      Content[NULL] is not Visible");
+    } else {
+      LOG_arbitrateConstraintLogicLogLine(
+          "      " + getPreMsg(ruleObj->isPrevious()) + "Content["
+          + content->getElementName() + "] is before arbitrate skip");
+    }
+    LOG_coverageConstraintExpressionLog(LOG_getCoverageExpressionText(),
+                                        RBAExecuteResult::SKIP);
+  } else if (isPassed == true) {
+    const RBAContentState* contentState;
+    if (ruleObj->isPrevious() == true) {
+      contentState = arb->getResult()->getPreActiveState(content);
+    } else {
+      contentState = arb->getResult()->getActiveState(content);
+    }
+    LOG_arbitrateConstraintLogicLogLine(
+        "      " + getPreMsg(ruleObj->isPrevious()) + "Content["
+        + content->getElementName() + "::" + contentState->getElementName()
+        + "] is Visible");
+    LOG_coverageConstraintExpressionLog(LOG_getCoverageExpressionText(),
+                                        RBAExecuteResult::TRUE);
+  } else {
+    LOG_arbitrateConstraintLogicLogLine(
+        "      " + getPreMsg(ruleObj->isPrevious()) + "Content["
+        + content->getElementName() + "] is not Visible");
+    LOG_coverageConstraintExpressionLog(LOG_getCoverageExpressionText(),
+                                        RBAExecuteResult::FALSE);
+  }
+#endif
+  // Remove itself from the constraint hierarchy for coverage.
+  LOG_removeHierarchy();
+  return isPassed;
+}
+
+/**
+ * Evaluate the expression with ruleObj as the object of the operand
+ */
+bool
+RBAIsVisible::executeFor(RBAConstraintInfo* const info,
+                         RBAArbitratorImpl* const arb,
+                         const RBARuleObject* const ruleObj) const
+{
+  bool isPassed {false};
+  const RBAContent* const content
+    {ruleObj->getRawObject()->toContent()};
+  if (content == nullptr) {
+    info->setExceptionBeforeArbitrate(true);
   } else if (ruleObj->isPrevious() == false) {
     const RBAContentState* const contentState
       {arb->getResult()->getActiveState(content)};
@@ -102,41 +156,6 @@ RBAIsVisible::executeCore(RBAConstraintInfo* info,
       }
     }
   }
-#ifdef RBA_USE_LOG
-  if (info->isExceptionBeforeArbitrate() == true) {
-    if(content == nullptr) {
-      LOG_arbitrateConstraintLogicLogLine(
-          "      Content[NULL] is not Visible");
-    } else {
-      LOG_arbitrateConstraintLogicLogLine(
-          "      " + getPreMsg(ruleObj->isPrevious()) + "Content["
-          + content->getElementName() + "] is before arbitrate skip");
-    }
-    LOG_coverageConstraintExpressionLog(LOG_getCoverageExpressionText(),
-                                        RBAExecuteResult::SKIP);
-  } else if (isPassed == true) {
-    const RBAContentState* contentState;
-    if (ruleObj->isPrevious() == true) {
-      contentState = arb->getResult()->getPreActiveState(content);
-    } else {
-      contentState = arb->getResult()->getActiveState(content);
-    }
-    LOG_arbitrateConstraintLogicLogLine(
-        "      " + getPreMsg(ruleObj->isPrevious()) + "Content["
-        + content->getElementName() + "::" + contentState->getElementName()
-        + "] is Visible");
-    LOG_coverageConstraintExpressionLog(LOG_getCoverageExpressionText(),
-                                        RBAExecuteResult::TRUE);
-  } else {
-    LOG_arbitrateConstraintLogicLogLine(
-        "      " + getPreMsg(ruleObj->isPrevious()) + "Content["
-        + content->getElementName() + "] is not Visible");
-    LOG_coverageConstraintExpressionLog(LOG_getCoverageExpressionText(),
-                                        RBAExecuteResult::FALSE);
-  }
-#endif
-  // Remove itself from the constraint hierarchy for coverage.
-  LOG_removeHierarchy();
   return isPassed;
 }
 
@@ -0,0 +1,225 @@
+/**
+ * Copyright (c) 2019 DENSO CORPORATION.
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/// @file  rbaalloccount.cpp
+/// @brief Allocation counter
+///
+/// Counts the memory allocations of each execute() for random requests
+/// of RBAModel.json, with the reuse of the result sets and of the result
+/// enabled, and fails if an execute() allocates more than the bound.
+///
+/// The bound of an execute() is the bound per allocatable (-b, default
+/// DEFAULT_BOUND) times the number of the areas and the zones plus the
+/// number of the allocatables that the execute() re-arbitrated.
+/// The executes of the warm-up, while the kept result sets are being
+/// filled, are not counted.
+/// An execute() is not free of allocations: the view actions of the
+/// result, the constraint information and the rollback still allocate.
+///
+/// usage: rbaalloccount <RBAModel.json> [-n executes]
+///                      [-w warm-up executes] [-s seed] [-b bound]
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <string>
+#include <vector>
+#include "RBAArbitrator.hpp"
+#include "RBAJsonParser.hpp"
+#include "RBAModel.hpp"
+#include "RBAScene.hpp"
+#include "RBASoundContentState.hpp"
+#include "RBAViewContentState.hpp"
+
+namespace
+{
+
+// Allocations per arbitrated allocatable that an execute() may make
+const std::uint64_t DEFAULT_BOUND {256U};
+
+std::atomic<bool> counting {false};
+std::atomic<std::uint64_t> allocations {0U};
+
+void* allocate(const std::size_t size)
+{
+  if(counting.load(std::memory_order_relaxed)) {
+    static_cast<void>(allocations.fetch_add(1U, std::memory_order_relaxed));
+  }
+  return std::malloc((size == 0U) ? 1U : size);
+}
+
+}
+
+void* operator new(std::size_t size)
+{
+  void* const p {allocate(size)};
+  if(p == nullptr) {
+    throw std::bad_alloc();
+  }
+  return p;
+}
+
+void* operator new[](std::size_t size)
+{
+  return ::operator new(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+  return allocate(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+  return allocate(size);
+}
+
+void operator delete(void* p) noexcept
+{
+  std::free(p);
+}
+
+void operator delete[](void* p) noexcept
+{
+  std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept
+{
+  std::free(p);
+}
+
+void operator delete[](void* p, std::size_t) noexcept
+{
+  std::free(p);
+}
+
+void operator delete(void* p, const std::nothrow_t&) noexcept
+{
+  std::free(p);
+}
+
+void operator delete[](void* p, const std::nothrow_t&) noexcept
+{
+  std::free(p);
+}
+
+int main(int argc, char* argv[])
+{
+  std::uint64_t executes {10000U};
+  std::uint64_t warmUp {1000U};
+  std::uint64_t seed {1U};
+  std::uint64_t bound {DEFAULT_BOUND};
+  bool isValid {argc >= 2};
+  for(int i {2}; (i < argc) && isValid; i += 2) {
+    if(((i + 1) < argc) && (std::strlen(argv[i]) == 2U)
+       && (argv[i][0] == '-')) {
+      const std::uint64_t value {std::strtoull(argv[i + 1], nullptr, 10)};
+      switch(argv[i][1]) {
+      case 'n':
+        executes = value;
+        break;
+      case 'w':
+        warmUp = value;
+        break;
+      case 's':
+        seed = value;
+        break;
+      case 'b':
+        bound = value;
+        break;
+      default:
+        isValid = false;
+        break;
+      }
+    } else {
+      isValid = false;
+    }
+  }
+  if(!isValid || (executes == 0U) || (bound == 0U)) {
+    std::cerr << "usage: " << argv[0]
+              << " <RBAModel.json> [-n executes]"
+              << " [-w warm-up executes] [-s seed] [-b bound]" << std::endl;
+    return 2;
+  }
+
+  rba::RBAJsonParser parser;
+  std::unique_ptr<rba::RBAModel> model {parser.parse(argv[1])};
+  if(model == nullptr) {
+    std::cerr << "ERROR: Could not read " << argv[1] << std::endl;
+    return 1;
+  }
+  std::vector<std::string> contexts;
+  for(const rba::RBAViewContentState* const state : model->getViewContentStates()) {
+    contexts.push_back(state->getUniqueName());
+  }
+  for(const rba::RBASoundContentState* const state : model->getSoundContentStates()) {
+    contexts.push_back(state->getUniqueName());
+  }
+  for(const rba::RBAScene* const scene : model->getScenes()) {
+    contexts.push_back(scene->getName());
+  }
+  if(contexts.empty()) {
+    std::cerr << "ERROR: No content state and no scene in " << argv[1]
+              << std::endl;
+    return 1;
+  }
+  const std::uint64_t allocatableCount
+    {model->getAreas().size() + model->getZones().size()};
+
+  rba::RBAArbitrator arb {model.get()};
+  arb.setObjectPool(true);
+  std::unique_ptr<rba::RBAResult> result;
+  std::uint64_t random {seed};
+  std::uint64_t total {0U};
+  std::uint64_t maxAllocations {0U};
+  std::uint64_t exceeded {0U};
+  for(std::uint64_t i {0U}; i < (warmUp + executes); i++) {
+    random = (random * 6364136223846793005ULL) + 1442695040888963407ULL;
+    const std::string& context {contexts[(random >> 33U) % contexts.size()]};
+    const bool require {((random >> 20U) % 3U) != 0U};
+    allocations.store(0U);
+    counting.store(true);
+    arb.execute(context, require, result);
+    counting.store(false);
+    if(i < warmUp) {
+      continue;
+    }
+    const std::uint64_t count {allocations.load()};
+    const std::uint64_t limit {bound * (allocatableCount
+        + static_cast<std::uint64_t>(arb.getReArbitrationCount()))};
+    total += count;
+    maxAllocations = std::max(maxAllocations, count);
+    if(count > limit) {
+      if(exceeded == 0U) {
+        std::cout << "FAIL execute " << (i - warmUp) << " " << context
+                  << " " << require << ": " << count
+                  << " allocations, bound " << limit << std::endl;
+      }
+      exceeded++;
+    }
+  }
+  std::cout << executes << " executes, " << (total / executes)
+            << " allocations on average, " << maxAllocations
+            << " at most, " << exceeded << " over the bound" << std::endl;
+
+  return (exceeded == 0U) ? 0 : 1;
+}
@@ -0,0 +1,61 @@
+/**
+ * Copyright (c) 2019 DENSO CORPORATION.
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/// @file  rbaconstraintgen.cpp
+/// @brief Constraint code generator
+///
+/// Generates C++ source of the constraints of RBAModel.json.
+/// The source is built into a shared object that
+/// rba::RBAArbitrator::loadConstraintPlugin() loads.
+///
+/// usage: rbaconstraintgen <RBAModel.json> <output.cpp>
+
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include "RBAJsonParser.hpp"
+#include "RBAModelImpl.hpp"
+#include "RBAConstraintCodeGenerator.hpp"
+
+int main(int argc, char* argv[])
+{
+  if(argc != 3) {
+    std::cerr << "usage: " << argv[0]
+              << " <RBAModel.json> <output.cpp>" << std::endl;
+    return 2;
+  }
+
+  rba::RBAJsonParser parser;
+  std::unique_ptr<rba::RBAModel> model {parser.parse(argv[1])};
+  rba::RBAModelImpl* const modelImpl
+    {dynamic_cast<rba::RBAModelImpl*>(model.get())};
+  if(modelImpl == nullptr) {
+    std::cerr << "ERROR: Could not parse " << argv[1] << std::endl;
+    return 1;
+  }
+
+  rba::RBAConstraintCodeGenerator generator {modelImpl};
+  generator.generate();
+  std::ofstream ofs {argv[2], std::ios::out | std::ios::trunc};
+  ofs << generator.getSource();
+  ofs.close();
+  if(ofs.fail()) {
+    std::cerr << "ERROR: Could not write " << argv[2] << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
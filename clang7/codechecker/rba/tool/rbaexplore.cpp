@@ -0,0 +1,108 @@
+/**
+ * Copyright (c) 2019 DENSO CORPORATION.
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/// @file  rbaexplore.cpp
+/// @brief State explorer
+///
+/// Runs random or all request sequences of RBAModel.json on all cores,
+/// and reports the constraints that arbitration does not satisfy with
+/// a minimized trace, the deepest re-arbitration and the slowest request.
+/// The traces are printed in the format of the scenario file of rbascenario.
+///
+/// usage: rbaexplore <RBAModel.json> [-n traces] [-l length]
+///                   [-s seed] [-p max property value] [-t threads] [-e]
+
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include "RBAStateExplorer.hpp"
+
+namespace
+{
+
+void printTrace(const std::vector<std::string>& trace)
+{
+  for(const std::string& line : trace) {
+    std::cout << "  " << line << std::endl;
+  }
+}
+
+}
+
+int main(int argc, char* argv[])
+{
+  rba::RBAExplorationOption option;
+  bool isValid {argc >= 2};
+  for(int i {2}; (i < argc) && isValid; i++) {
+    if(std::strcmp(argv[i], "-e") == 0) {
+      option.exhaustive = true;
+    } else if(((i + 1) < argc) && (std::strlen(argv[i]) == 2U)
+              && (argv[i][0] == '-')) {
+      const std::uint64_t value {std::strtoull(argv[i + 1], nullptr, 10)};
+      switch(argv[i][1]) {
+      case 'n':
+        option.traceCount = value;
+        break;
+      case 'l':
+        option.traceLength = static_cast<std::uint32_t>(value);
+        break;
+      case 's':
+        option.seed = value;
+        break;
+      case 'p':
+        option.maxPropertyValue = static_cast<std::int32_t>(value);
+        break;
+      case 't':
+        option.threads = static_cast<std::uint32_t>(value);
+        break;
+      default:
+        isValid = false;
+        break;
+      }
+      i++;
+    } else {
+      isValid = false;
+    }
+  }
+  if(!isValid) {
+    std::cerr << "usage: " << argv[0]
+              << " <RBAModel.json> [-n traces] [-l length]"
+              << " [-s seed] [-p max property value] [-t threads] [-e]"
+              << std::endl;
+    return 2;
+  }
+
+  rba::RBAStateExplorer explorer;
+  if(!explorer.load(argv[1])) {
+    return 1;
+  }
+  const rba::RBAExplorationReport report {explorer.explore(option)};
+
+  std::cout << report.traceCount << " traces, " << report.stepCount
+            << " requests" << std::endl;
+  for(const rba::RBAConstraintViolation& violation : report.violations) {
+    std::cout << "VIOLATION " << (violation.runtime ? "online" : "offline")
+              << " constraint " << violation.constraint << std::endl;
+    printTrace(violation.trace);
+  }
+  std::cout << "DEEPEST re-arbitration nest " << report.deepestNest << std::endl;
+  printTrace(report.deepestTrace);
+  std::cout << "SLOWEST request " << report.slowestMicroseconds << " us" << std::endl;
+  printTrace(report.slowestTrace);
+
+  return report.violations.empty() ? 0 : 1;
+}
@@ -0,0 +1,67 @@
+/**
+ * Copyright (c) 2019 DENSO CORPORATION.
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/// @file  rbascenario.cpp
+/// @brief Scenario runner
+///
+/// Runs the request scenarios of a scenario file against RBAModel.json
+/// on all cores and reports the result of each scenario.
+/// The format of the scenario file is described in RBAScenarioRunner.hpp.
+///
+/// usage: rbascenario <RBAModel.json> <scenario file> [threads]
+
+#include <cstdlib>
+#include <iostream>
+#include "RBAScenarioRunner.hpp"
+
+int main(int argc, char* argv[])
+{
+  if((argc != 3) && (argc != 4)) {
+    std::cerr << "usage: " << argv[0]
+              << " <RBAModel.json> <scenario file> [threads]"
+              << std::endl;
+    return 2;
+  }
+  std::uint32_t threads {0U};
+  if(argc == 4) {
+    threads = static_cast<std::uint32_t>(std::strtoul(argv[3], nullptr, 10));
+  }
+
+  rba::RBAScenarioRunner runner;
+  if(!runner.load(argv[1], argv[2])) {
+    return 1;
+  }
+
+  std::size_t failed {0U};
+  std::int64_t elapsed {0};
+  const std::vector<rba::RBAScenarioReport> reports {runner.run(threads)};
+  for(const rba::RBAScenarioReport& report : reports) {
+    if(report.passed) {
+      std::cout << "PASS " << report.name;
+    } else {
+      std::cout << "FAIL " << report.name << " step " << report.failedStep
+                << ": " << report.divergence;
+      failed++;
+    }
+    std::cout << " (" << report.elapsedMicroseconds << " us)" << std::endl;
+    elapsed += report.elapsedMicroseconds;
+  }
+  std::cout << reports.size() << " scenarios, " << failed << " failed, "
+            << elapsed << " us" << std::endl;
+
+  return (failed == 0U) ? 0 : 1;
+}